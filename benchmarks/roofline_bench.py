@@ -0,0 +1,81 @@
+#!/usr/bin/env python
+# coding=utf8
+#
+# Copyright (c) 2026 agent
+#
+# This file is part of CL2QCD.
+#
+# CL2QCD is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# CL2QCD is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+
+# Runs the roofline benchmark over several lattice sizes and merges the
+# per-size JSON reports into a single file. All arguments following the
+# options are passed on to the executable, e.g. --fermionAction=rooted_stagg.
+
+from subprocess import *
+import json
+import os
+import sys
+import optparse # use old optparse, as LOEWE-CSC only has python 2.6
+
+EXECUTABLE = "roofline_benchmark"
+
+default_space_dims = [8, 12, 16, 24, 32]
+default_time_dims = [8, 12, 16, 24, 32]
+
+def main():
+
+	parser = optparse.OptionParser(usage='%prog [options] [-- executable options]')
+	parser.add_option('-s', '--nspace', action='append', type='int', help='Spacial extend of the lattice to use. Can be specified multiple times.')
+	parser.add_option('-t', '--ntime', action='append', type='int', help='Temporal extend of the lattice to use. Can be specified multiple times.')
+	parser.add_option('-d', '--device', type=int, help='The device to benchmark.')
+	parser.add_option('-o', '--output', default='roofline.json', help='The file to write the merged results to.')
+	parser.add_option('-v', '--verbose', action='store_true', default=False, help='Show output of the executable.')
+
+	(options, args) = parser.parse_args()
+
+	space_dims = options.nspace if options.nspace else default_space_dims
+	time_dims = options.ntime if options.ntime else default_time_dims
+
+	runs = []
+	for ns in space_dims:
+		for nt in time_dims:
+			print('\tbenchmarking {0}^3 x {1} lattice'.format(ns, nt))
+			cmd = ['./' + EXECUTABLE, '--nSpace={0}'.format(ns), '--nTime={0}'.format(nt)] + args
+			if options.device != None:
+				cmd += ['--device={0}'.format(options.device)]
+
+			if options.verbose:
+				subject = Popen(cmd)
+			else:
+				subject = Popen(cmd, stdout=PIPE)
+				for line in subject.stdout:
+					pass
+			subject.wait()
+
+			if subject.returncode != 0:
+				print('\tProgram terminated with exit code %i' % subject.returncode)
+				continue
+
+			report = '{0}_{1}x{2}.json'.format(EXECUTABLE, ns, nt)
+			with open(report) as f:
+				runs.append(json.load(f))
+			os.remove(report)
+
+	with open(options.output, 'w') as f:
+		json.dump({'runs': runs}, f, indent=2)
+	print('\tresults of {0} runs written to {1}'.format(len(runs), options.output))
+
+
+if __name__ == '__main__':
+	sys.exit(main())
@@ -98,7 +98,7 @@ function(add_unit_test)
                 if("${add_unit_test_NAME}" STREQUAL "" )
                     message( FATAL_ERROR "SOURCE_FILES not deducible since NAME not givent to CMake function \"add_unit_test\", aborting!" )
                 else("${add_unit_test_NAME}" STREQUAL "" )
-                    string(REGEX REPLACE "_(REC12|CPU|GPU)" "" add_unit_test_SOURCE_FILES "${add_unit_test_NAME}")
+                    string(REGEX REPLACE "_(REC12|REC8|CPU|GPU)" "" add_unit_test_SOURCE_FILES "${add_unit_test_NAME}")
                     string(REGEX REPLACE ".*/" "" add_unit_test_SOURCE_FILES "${add_unit_test_SOURCE_FILES}")
                     string(APPEND add_unit_test_SOURCE_FILES "_test.cpp")
                 endif()
@@ -111,7 +111,7 @@ function(add_unit_test)
         if( "${add_unit_test_NAME}" STREQUAL "" )
             message( FATAL_ERROR "EXECUTABLE name not specified and not deducible in CMake function \"add_unit_test\", aborting!" )
         else( "${add_unit_test_NAME}" STREQUAL "" )
-            string(REGEX REPLACE "_(REC12|CPU|GPU)" "" add_unit_test_EXECUTABLE "${add_unit_test_NAME}")
+            string(REGEX REPLACE "_(REC12|REC8|CPU|GPU)" "" add_unit_test_EXECUTABLE "${add_unit_test_NAME}")
             string(REPLACE "/" "_" add_unit_test_EXECUTABLE "${add_unit_test_EXECUTABLE}")
             string(APPEND add_unit_test_EXECUTABLE "_test")
         endif()
@@ -202,6 +202,7 @@ namespace common {
     enum solver { cg = 1, bicgstab, bicgstab_save };
     enum sourcetypes { point = 1, volume, timeslice, zslice };
     enum sourcecontents { one = 1, z4, gaussian, z2 };
+    enum halotransfer { auto_select = 1, ocl_copy, async_ocl_copy, dgma, direct_copy };
 }  // namespace common
 #endif
 
@@ -58,10 +58,21 @@ typedef struct {
 
 /**
  * The type used for storing spinors on the device.
+ *
+ * In SOA layout the fields can be stored in single precision, while the kernels keep computing in hmc_float. The
+ * conversion is then done on every load and store, see getSpinor_eo and get_su3vec_from_field_eo.
  */
 #ifdef _USE_SOA_
-typedef hmc_complex spinorStorageType;
-typedef hmc_complex staggeredStorageType;
+#    ifdef _USE_SINGLEPREC_FERMION_STORAGE_
+typedef struct {
+    float re;
+    float im;
+} fermionStorageComplex __attribute__((aligned(8)));
+#    else
+typedef hmc_complex fermionStorageComplex;
+#    endif
+typedef fermionStorageComplex spinorStorageType;
+typedef fermionStorageComplex staggeredStorageType;
 #else
 typedef spinor spinorStorageType;
 typedef su3vec staggeredStorageType;
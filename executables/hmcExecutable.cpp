@@ -21,6 +21,7 @@
 
 #include "hmcExecutable.hpp"
 
+#include "../hardware/device.hpp"
 #include "../physics/observables/wilsonTwoFlavourChiralCondensate.hpp"
 
 hmcExecutable::hmcExecutable(int argc, const char* argv[]) : generationExecutable(argc, argv, "hmc")
@@ -28,6 +29,12 @@ hmcExecutable::hmcExecutable(int argc, const char* argv[]) : generationExecutabl
     initializationTimer.reset();
     printParametersToScreenAndFile();
     setIterationParameters();
+    // build all programs needed along the trajectories at once instead of one by one on first use
+    system->buildCode({std::mem_fn(&hardware::Device::getRealCode), std::mem_fn(&hardware::Device::getComplexCode),
+                       std::mem_fn(&hardware::Device::getSpinorCode), std::mem_fn(&hardware::Device::getFermionCode),
+                       std::mem_fn(&hardware::Device::getGaugemomentumCode),
+                       std::mem_fn(&hardware::Device::getMolecularDynamicsCode),
+                       std::mem_fn(&hardware::Device::getBufferCode)});
     initializationTimer.add();
 }
 
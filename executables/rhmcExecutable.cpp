@@ -22,11 +22,14 @@
 
 #include "rhmcExecutable.hpp"
 
+#include "../hardware/device.hpp"
+
 static int getRationalApproximationNumerator(double numTastes, int numTastesDecimalDigits);
 static int getRationalApproximationDenominator(std::string whichRationalApproximation, int numTastesDecimalDigits,
                                                int numPseudoFermions);
 
-rhmcExecutable::rhmcExecutable(int argc, const char* argv[]) : generationExecutable(argc, argv, "rhmc")
+rhmcExecutable::rhmcExecutable(int argc, const char* argv[])
+    : generationExecutable(argc, argv, "rhmc"), spectralBounds(*system, *interfacesHandler)
 {
     using namespace physics::algorithms;
 
@@ -34,6 +37,13 @@ rhmcExecutable::rhmcExecutable(int argc, const char* argv[]) : generationExecuta
     initializationTimer.reset();
     printParametersToScreenAndFile();
     setIterationParameters();
+    // build all programs needed along the trajectories at once instead of one by one on first use
+    system->buildCode({std::mem_fn(&hardware::Device::getRealCode),
+                       std::mem_fn(&hardware::Device::getSpinorStaggeredCode),
+                       std::mem_fn(&hardware::Device::getFermionStaggeredCode),
+                       std::mem_fn(&hardware::Device::getGaugemomentumCode),
+                       std::mem_fn(&hardware::Device::getMolecularDynamicsCode),
+                       std::mem_fn(&hardware::Device::getBufferCode)});
     initializationTimer.add();
     if (parameters.get_read_rational_approximations_from_file()) {
         logger.info() << "Reading and checking Rational Approximations...";
@@ -140,7 +150,8 @@ void rhmcExecutable::generateAccordingToSpecificAlgorithm()
 {
     const double randomNumber = prng->get_double();
     observables = physics::algorithms::perform_rhmc_step(*approx_hb, *approx_md, *approx_met, gaugefield, iteration,
-                                                         randomNumber, *prng, *system, *interfacesHandler);
+                                                         randomNumber, *prng, *system, *interfacesHandler,
+                                                         spectralBounds);
     acceptanceRate += observables.accept;
 }
 
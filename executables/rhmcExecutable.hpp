@@ -70,6 +70,8 @@ class rhmcExecutable : public generationExecutable {
 
   private:
     physics::algorithms::Rational_Approximation *approx_hb, *approx_md, *approx_met;
+    // eigenvalue bounds and eigenvectors carried from one trajectory to the next
+    physics::algorithms::SpectralBoundsEstimator spectralBounds;
     void checkRhmcParameters(const meta::Inputparameters& p);
 };
 
@@ -0,0 +1,352 @@
+/** @file
+ * Implementation of the rooflineBenchmark class
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "rooflineBenchmark.hpp"
+
+#include "../hardware/code/fermions.hpp"
+#include "../hardware/code/fermions_staggered.hpp"
+#include "../hardware/code/gaugefield.hpp"
+#include "../hardware/code/gaugemomentum.hpp"
+#include "../hardware/code/heatbath.hpp"
+#include "../hardware/code/molecular_dynamics.hpp"
+#include "../hardware/code/spinors.hpp"
+#include "../hardware/code/spinors_staggered.hpp"
+
+/**
+ * Size of the buffers copied to measure the bandwidth roof, large enough not to fit in any cache.
+ */
+static const size_t copy_buffer_bytes = 64 * 1024 * 1024;
+
+rooflineBenchmark::rooflineBenchmark(int argc, const char* argv[]) : benchmarkExecutable(argc, argv)
+{
+    if (system->get_devices().size() != 1) {
+        throw Print_Error_Message("There must be exactly one device chosen for this benchmark to be performed. "
+                                  "Aborting...\n",
+                                  __FILE__, __LINE__);
+    }
+
+    const hmc_float one          = 1.;
+    const hmc_complex complexOne = {1., 0.};
+    const int noTimeslice        = -1;
+    realScalar1.reset(new hardware::buffers::Plain<hmc_float>(1, device));
+    realScalar2.reset(new hardware::buffers::Plain<hmc_float>(1, device));
+    realScalar3.reset(new hardware::buffers::Plain<hmc_float>(1, device));
+    complexScalar1.reset(new hardware::buffers::Plain<hmc_complex>(1, device));
+    complexScalar2.reset(new hardware::buffers::Plain<hmc_complex>(1, device));
+    complexScalar3.reset(new hardware::buffers::Plain<hmc_complex>(1, device));
+    noFixedTimeslices.reset(new hardware::buffers::Plain<int>(1, device));
+    realScalar1->load(&one);
+    complexScalar1->load(&complexOne);
+    complexScalar2->load(&complexOne);
+    noFixedTimeslices->load(&noTimeslice);
+
+    addGaugeKernels();
+    const auto kernelParameters = system->getOpenClParameters();
+    if (kernelParameters->getUseEo()) {
+        switch (kernelParameters->getFermact()) {
+            case common::action::wilson:
+            case common::action::twistedmass:
+                addWilsonKernels();
+                break;
+            case common::action::rooted_stagg:
+                addStaggeredKernels();
+                break;
+            default:
+                break;
+        }
+    } else {
+        logger.warn() << "Only the even-odd preconditioned fermion kernels are benchmarked, set useEo to include them.";
+    }
+}
+
+void rooflineBenchmark::addGaugeKernels()
+{
+    const auto kernelParameters = system->getOpenClParameters();
+    const auto gf               = gaugefield->get_buffers().at(0);
+    const auto prngBuffer       = prng->get_buffers().at(0);
+    gaugemomenta1.reset(new physics::lattices::Gaugemomenta(
+        *system, interfacesHandler->getInterface<physics::lattices::Gaugemomenta>()));
+    gaugemomenta2.reset(new physics::lattices::Gaugemomenta(
+        *system, interfacesHandler->getInterface<physics::lattices::Gaugemomenta>()));
+    const auto gm1 = gaugemomenta1->get_buffers().at(0);
+    const auto gm2 = gaugemomenta2->get_buffers().at(0);
+
+    const auto gaugefieldCode = device->getGaugefieldCode();
+    kernelCases.push_back({"Gaugefield", "plaquette", gaugefieldCode, [=]() {
+                               gaugefieldCode->plaquette_device(gf, realScalar1.get(), realScalar2.get(),
+                                                                realScalar3.get());
+                           }});
+    kernelCases.push_back({"Gaugefield", "polyakov", gaugefieldCode,
+                           [=]() { gaugefieldCode->polyakov_device(gf, complexScalar3.get()); }});
+    if (kernelParameters->getUseRectangles()) {
+        kernelCases.push_back({"Gaugefield", "rectangles", gaugefieldCode,
+                               [=]() { gaugefieldCode->rectangles_device(gf, realScalar2.get()); }});
+    }
+    if (kernelParameters->getUseSmearing()) {
+        smearedLinks.reset(new hardware::buffers::SU3(gf->get_elements(), device));
+        const auto smeared = smearedLinks.get();
+        kernelCases.push_back({"Gaugefield", "stout_smear", gaugefieldCode,
+                               [=]() { gaugefieldCode->stout_smear_device(gf, smeared); }});
+    }
+
+    const auto gaugemomentumCode = device->getGaugemomentumCode();
+    kernelCases.push_back({"Gaugemomentum", "generate_gaussian_gaugemomenta", gaugemomentumCode,
+                           [=]() { gaugemomentumCode->generate_gaussian_gaugemomenta_device(gm1, prngBuffer); }});
+    kernelCases.push_back({"Gaugemomentum", "set_zero_gaugemomentum", gaugemomentumCode,
+                           [=]() { gaugemomentumCode->set_zero_gaugemomentum(gm2); }});
+    kernelCases.push_back({"Gaugemomentum", "gaugemomentum_squarenorm", gaugemomentumCode, [=]() {
+                               gaugemomentumCode->set_float_to_gaugemomentum_squarenorm_device(gm1, realScalar2.get());
+                           }});
+    kernelCases.push_back({"Gaugemomentum", "gaugemomentum_saxpy", gaugemomentumCode,
+                           [=]() { gaugemomentumCode->saxpy_device(gm1, gm2, realScalar1.get(), gm2); }});
+
+    // the update with a vanishing step size leaves the gaugefield unchanged
+    const auto mdCode = device->getMolecularDynamicsCode();
+    kernelCases.push_back({"Molecular_Dynamics", "md_update_gaugefield", mdCode,
+                           [=]() { mdCode->md_update_gaugefield_device(gm1, gf, 0.); }});
+    kernelCases.push_back(
+        {"Molecular_Dynamics", "gauge_force", mdCode, [=]() { mdCode->gauge_force_device(gf, gm2); }});
+    if (kernelParameters->getUseRectangles()) {
+        kernelCases.push_back({"Molecular_Dynamics", "gauge_force_tlsym", mdCode,
+                               [=]() { mdCode->gauge_force_tlsym_device(gf, gm2); }});
+    }
+
+    // the heatbath changes the gaugefield, hence it comes last among the gauge kernels
+    const auto heatbathCode = device->getHeatbathCode();
+    const auto fixed        = noFixedTimeslices.get();
+    kernelCases.push_back({"Heatbath", "heatbath_even", heatbathCode,
+                           [=]() { heatbathCode->run_heatbath(gf, prngBuffer, *fixed, EVEN, 1); }});
+    kernelCases.push_back({"Heatbath", "heatbath_odd", heatbathCode,
+                           [=]() { heatbathCode->run_heatbath(gf, prngBuffer, *fixed, ODD, 1); }});
+    kernelCases.push_back({"Heatbath", "overrelax_even", heatbathCode,
+                           [=]() { heatbathCode->run_overrelax(gf, prngBuffer, *fixed, EVEN, 1); }});
+    kernelCases.push_back({"Heatbath", "overrelax_odd", heatbathCode,
+                           [=]() { heatbathCode->run_overrelax(gf, prngBuffer, *fixed, ODD, 1); }});
+}
+
+void rooflineBenchmark::addWilsonKernels()
+{
+    const auto kernelParameters = system->getOpenClParameters();
+    const auto gf               = gaugefield->get_buffers().at(0);
+    const auto prngBuffer       = prng->get_buffers().at(0);
+    const auto gm               = gaugemomenta2->get_buffers().at(0);
+    spinorfield1.reset(new physics::lattices::Spinorfield_eo(
+        *system, interfacesHandler->getInterface<physics::lattices::Spinorfield_eo>()));
+    spinorfield2.reset(new physics::lattices::Spinorfield_eo(
+        *system, interfacesHandler->getInterface<physics::lattices::Spinorfield_eo>()));
+    spinorfield3.reset(new physics::lattices::Spinorfield_eo(
+        *system, interfacesHandler->getInterface<physics::lattices::Spinorfield_eo>()));
+    const auto x   = spinorfield1->get_buffers().at(0);
+    const auto y   = spinorfield2->get_buffers().at(0);
+    const auto out = spinorfield3->get_buffers().at(0);
+
+    const auto spinorCode = device->getSpinorCode();
+    kernelCases.push_back({"Spinors", "generate_gaussian_spinorfield_eo", spinorCode,
+                           [=]() { spinorCode->generate_gaussian_spinorfield_eo_device(x, prngBuffer); }});
+    kernelCases.push_back({"Spinors", "set_eoprec_spinorfield_cold", spinorCode,
+                           [=]() { spinorCode->set_eoprec_spinorfield_cold_device(y); }});
+    kernelCases.push_back({"Spinors", "set_zero_spinorfield_eoprec", spinorCode,
+                           [=]() { spinorCode->set_zero_spinorfield_eoprec_device(out); }});
+    kernelCases.push_back({"Spinors", "sax_eoprec", spinorCode,
+                           [=]() { spinorCode->sax_eoprec_device(x, complexScalar1.get(), out); }});
+    kernelCases.push_back({"Spinors", "saxpy_eoprec", spinorCode,
+                           [=]() { spinorCode->saxpy_eoprec_device(x, y, complexScalar1.get(), out); }});
+    kernelCases.push_back({"Spinors", "saxsbypz_eoprec", spinorCode, [=]() {
+                               spinorCode->saxsbypz_eoprec_device(x, y, out, complexScalar1.get(),
+                                                                  complexScalar2.get(), out);
+                           }});
+    kernelCases.push_back({"Spinors", "scalar_product_eoprec", spinorCode, [=]() {
+                               spinorCode->set_complex_to_scalar_product_eoprec_device(x, y, complexScalar3.get());
+                           }});
+    kernelCases.push_back({"Spinors", "global_squarenorm_eoprec", spinorCode, [=]() {
+                               spinorCode->set_float_to_global_squarenorm_eoprec_device(x, realScalar2.get());
+                           }});
+    if (kernelParameters->getUseMergeKernelsSpinor()) {
+        kernelCases.push_back({"Spinors", "saxpy_AND_squarenorm_eo", spinorCode, [=]() {
+                                   spinorCode->saxpy_AND_squarenorm_eo_device(x, y, complexScalar1.get(), out,
+                                                                              complexScalar3.get());
+                               }});
+        kernelCases.push_back({"Spinors", "cg_update_x_r_AND_squarenorm_eo", spinorCode, [=]() {
+                                   spinorCode->cg_update_x_r_AND_squarenorm_eo_device(
+                                       out, y, x, x, complexScalar1.get(), complexScalar2.get(), complexScalar3.get());
+                               }});
+        kernelCases.push_back({"Spinors", "cg_update_p_eo", spinorCode, [=]() {
+                                   spinorCode->cg_update_p_eo_device(out, y, complexScalar1.get(),
+                                                                     complexScalar2.get());
+                               }});
+    }
+
+    const auto fermionCode = device->getFermionCode();
+    kernelCases.push_back(
+        {"Fermions", "dslash_eo", fermionCode, [=]() { fermionCode->dslash_eo_device(x, out, gf, EVEN); }});
+    kernelCases.push_back({"Fermions", "gamma5_eo", fermionCode, [=]() { fermionCode->gamma5_eo_device(out); }});
+    if (kernelParameters->getFermact() == common::action::twistedmass) {
+        kernelCases.push_back({"Fermions", "M_tm_sitediagonal", fermionCode,
+                               [=]() { fermionCode->M_tm_sitediagonal_device(x, out); }});
+        kernelCases.push_back({"Fermions", "M_tm_inverse_sitediagonal", fermionCode,
+                               [=]() { fermionCode->M_tm_inverse_sitediagonal_device(x, out); }});
+        if (kernelParameters->getUseMergeKernelsFermion()) {
+            kernelCases.push_back({"Fermions", "dslash_AND_M_tm_inverse_sitediagonal_eo", fermionCode, [=]() {
+                                       fermionCode->dslash_AND_M_tm_inverse_sitediagonal_eo_device(x, out, gf, EVEN);
+                                   }});
+        }
+    }
+
+    const auto mdCode = device->getMolecularDynamicsCode();
+    kernelCases.push_back({"Molecular_Dynamics", "fermion_force_eo", mdCode,
+                           [=]() { mdCode->fermion_force_eo_device(x, y, gf, gm, EVEN); }});
+}
+
+void rooflineBenchmark::addStaggeredKernels()
+{
+    const auto gf         = gaugefield->get_buffers().at(0);
+    const auto prngBuffer = prng->get_buffers().at(0);
+    const auto gm         = gaugemomenta2->get_buffers().at(0);
+    staggeredfield1.reset(new physics::lattices::Staggeredfield_eo(
+        *system, interfacesHandler->getInterface<physics::lattices::Staggeredfield_eo>()));
+    staggeredfield2.reset(new physics::lattices::Staggeredfield_eo(
+        *system, interfacesHandler->getInterface<physics::lattices::Staggeredfield_eo>()));
+    staggeredfield3.reset(new physics::lattices::Staggeredfield_eo(
+        *system, interfacesHandler->getInterface<physics::lattices::Staggeredfield_eo>()));
+    const auto x   = staggeredfield1->get_buffers().at(0);
+    const auto y   = staggeredfield2->get_buffers().at(0);
+    const auto out = staggeredfield3->get_buffers().at(0);
+
+    const auto spinorCode = device->getSpinorStaggeredCode();
+    kernelCases.push_back({"Spinors_staggered", "set_gaussian_spinorfield_stagg_eoprec", spinorCode,
+                           [=]() { spinorCode->set_gaussian_spinorfield_eoprec_device(x, prngBuffer); }});
+    kernelCases.push_back({"Spinors_staggered", "set_cold_spinorfield_stagg_eoprec", spinorCode,
+                           [=]() { spinorCode->set_cold_spinorfield_eoprec_device(y); }});
+    kernelCases.push_back({"Spinors_staggered", "set_zero_spinorfield_stagg_eoprec", spinorCode,
+                           [=]() { spinorCode->set_zero_spinorfield_eoprec_device(out); }});
+    kernelCases.push_back({"Spinors_staggered", "sax_cplx_staggered_eoprec", spinorCode,
+                           [=]() { spinorCode->sax_eoprec_device(x, complexScalar1.get(), out); }});
+    kernelCases.push_back({"Spinors_staggered", "saxpy_cplx_staggered_eoprec", spinorCode,
+                           [=]() { spinorCode->saxpy_eoprec_device(x, y, complexScalar1.get(), out); }});
+    kernelCases.push_back({"Spinors_staggered", "saxpby_cplx_staggered_eoprec", spinorCode, [=]() {
+                               spinorCode->saxpby_eoprec_device(x, y, complexScalar1.get(), complexScalar2.get(),
+                                                                out);
+                           }});
+    kernelCases.push_back({"Spinors_staggered", "saxpbypz_cplx_staggered_eoprec", spinorCode, [=]() {
+                               spinorCode->saxpbypz_eoprec_device(x, y, out, complexScalar1.get(),
+                                                                  complexScalar2.get(), out);
+                           }});
+    kernelCases.push_back({"Spinors_staggered", "scalar_product_staggered_eoprec", spinorCode, [=]() {
+                               spinorCode->set_complex_to_scalar_product_eoprec_device(x, y, complexScalar3.get());
+                           }});
+    kernelCases.push_back({"Spinors_staggered", "global_squarenorm_staggered_eoprec", spinorCode, [=]() {
+                               spinorCode->set_float_to_global_squarenorm_eoprec_device(x, realScalar2.get());
+                           }});
+
+    const auto fermionCode = device->getFermionStaggeredCode();
+    kernelCases.push_back({"Fermions_staggered", "D_KS_eo", fermionCode,
+                           [=]() { fermionCode->D_KS_eo_device(x, out, gf, EVEN); }});
+
+    const auto mdCode = device->getMolecularDynamicsCode();
+    kernelCases.push_back({"Molecular_Dynamics", "fermion_staggered_partial_force_eo", mdCode,
+                           [=]() { mdCode->fermion_staggered_partial_force_device(gf, x, y, gm, EVEN); }});
+}
+
+void rooflineBenchmark::benchmarkAllKernels()
+{
+    performanceTimer.reset();
+    logger.info() << "Measure the bandwidth roof..";
+    const double peakBandwidth = measureCopyBandwidth();
+    logger.info() << "Device-internal copy bandwidth: " << peakBandwidth << " GB/s";
+
+    logger.info() << "Perform " << benchmarkSteps << " benchmarking steps for each of " << kernelCases.size()
+                  << " kernels.";
+    std::vector<KernelResult> results;
+    for (const auto& kernelCase : kernelCases) {
+        const double time = measureKernel(kernelCase);
+        results.push_back({&kernelCase, time, kernelCase.code->get_flop_size(kernelCase.kernel),
+                           kernelCase.code->get_read_write_size(kernelCase.kernel)});
+        logger.info() << kernelCase.module << "::" << kernelCase.kernel << ": " << time << " mus, "
+                      << results.back().flop / time / 1e3 << " GFLOPS, " << results.back().bytes / time / 1e3
+                      << " GB/s";
+    }
+    logger.info() << "Benchmarking done";
+
+    writeResults(results, peakBandwidth);
+    performanceTimer.add();
+}
+
+double rooflineBenchmark::measureKernel(const KernelCase& kernelCase) const
+{
+    // ensure that the kernel is already built
+    kernelCase.enqueue();
+    device->synchronize();
+
+    klepsydra::Monotonic timer;
+    for (int iteration = 0; iteration < benchmarkSteps; ++iteration) {
+        kernelCase.enqueue();
+    }
+    device->synchronize();
+    return static_cast<double>(timer.getTime()) / benchmarkSteps;
+}
+
+double rooflineBenchmark::measureCopyBandwidth() const
+{
+    const size_t elems = copy_buffer_bytes / sizeof(hmc_float);
+    const hardware::buffers::Plain<hmc_float> in(elems, device);
+    const hardware::buffers::Plain<hmc_float> out(elems, device);
+    hardware::buffers::copyData(&out, &in);
+    device->synchronize();
+
+    klepsydra::Monotonic timer;
+    for (int iteration = 0; iteration < benchmarkSteps; ++iteration) {
+        hardware::buffers::copyData(&out, &in);
+    }
+    device->synchronize();
+    return 2. * in.get_bytes() * benchmarkSteps / timer.getTime() / 1e3;
+}
+
+void rooflineBenchmark::writeResults(const std::vector<KernelResult>& results, const double peakBandwidth) const
+{
+    const std::string filename = std::string(ownName) + "_" + std::to_string(parameters.get_nspace()) + "x" +
+                                 std::to_string(parameters.get_ntime()) + ".json";
+    std::ofstream file(filename);
+    if (!file) {
+        throw File_Exception(filename);
+    }
+
+    file << "{\n";
+    file << "  \"device\": \"" << device->get_name() << "\",\n";
+    file << "  \"precision\": " << parameters.get_precision() << ",\n";
+    file << "  \"nspace\": " << parameters.get_nspace() << ",\n";
+    file << "  \"ntime\": " << parameters.get_ntime() << ",\n";
+    file << "  \"peak_bandwidth\": " << peakBandwidth << ",\n";
+    file << "  \"kernels\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& result = results[i];
+        const double gflops = result.flop / result.time / 1e3;
+        const double gbps   = result.bytes / result.time / 1e3;
+        file << (i ? ",\n" : "\n");
+        file << "    {\"module\": \"" << result.kernelCase->module << "\", \"kernel\": \""
+             << result.kernelCase->kernel << "\", \"time_us\": " << result.time << ", \"flop\": " << result.flop
+             << ", \"bytes\": " << result.bytes << ", \"GFLOPS\": " << gflops << ", \"GBps\": " << gbps
+             << ", \"arithmetic_intensity\": "
+             << (result.bytes ? static_cast<double>(result.flop) / result.bytes : 0.)
+             << ", \"peak_bandwidth_fraction\": " << gbps / peakBandwidth << "}";
+    }
+    file << "\n  ]\n}\n";
+    logger.info() << "Roofline data written to " << filename;
+}
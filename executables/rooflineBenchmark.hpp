@@ -0,0 +1,101 @@
+/** @file
+ * Declaration of the rooflineBenchmark class
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ROOFLINEBENCHMARK_H_
+#define ROOFLINEBENCHMARK_H_
+
+#include "../hardware/buffers/plain.hpp"
+#include "../hardware/buffers/su3.hpp"
+#include "../hardware/code/opencl_module.hpp"
+#include "../physics/lattices/gaugemomenta.hpp"
+#include "../physics/lattices/spinorfield_eo.hpp"
+#include "../physics/lattices/staggeredfield_eo.hpp"
+#include "benchmarkExecutable.hpp"
+
+#include <functional>
+#include <memory>
+
+/**
+ * Benchmark of all kernels built for the chosen action and options, placing each of them on a roofline.
+ *
+ * Each kernel is timed on its own on a single device and its achieved performance and bandwidth are derived from
+ * the flop and byte models of its hardware::code module (get_flop_size and get_read_write_size). The bandwidth roof
+ * is measured by device-internal buffer copies. The results are written as JSON to <executable>_<NS>x<NT>.json.
+ */
+class rooflineBenchmark : public benchmarkExecutable {
+  public:
+    rooflineBenchmark(int argc, const char* argv[]);
+
+    /**
+     * Time every registered kernel, print the results and write them to the JSON file.
+     */
+    void benchmarkAllKernels();
+
+  protected:
+    struct KernelCase {
+        std::string module;
+        std::string kernel;  // the name used by the flop and byte models
+        const hardware::code::Opencl_Module* code;
+        std::function<void()> enqueue;
+    };
+    struct KernelResult {
+        const KernelCase* kernelCase;
+        double time;  // in microseconds per call
+        uint64_t flop;
+        size_t bytes;
+    };
+
+    std::vector<KernelCase> kernelCases;
+
+    std::unique_ptr<const physics::lattices::Spinorfield_eo> spinorfield1;
+    std::unique_ptr<const physics::lattices::Spinorfield_eo> spinorfield2;
+    std::unique_ptr<const physics::lattices::Spinorfield_eo> spinorfield3;
+    std::unique_ptr<const physics::lattices::Staggeredfield_eo> staggeredfield1;
+    std::unique_ptr<const physics::lattices::Staggeredfield_eo> staggeredfield2;
+    std::unique_ptr<const physics::lattices::Staggeredfield_eo> staggeredfield3;
+    std::unique_ptr<const physics::lattices::Gaugemomenta> gaugemomenta1;
+    std::unique_ptr<const physics::lattices::Gaugemomenta> gaugemomenta2;
+    std::unique_ptr<const hardware::buffers::SU3> smearedLinks;
+    std::unique_ptr<const hardware::buffers::Plain<hmc_float>> realScalar1;
+    std::unique_ptr<const hardware::buffers::Plain<hmc_float>> realScalar2;
+    std::unique_ptr<const hardware::buffers::Plain<hmc_float>> realScalar3;
+    std::unique_ptr<const hardware::buffers::Plain<hmc_complex>> complexScalar1;
+    std::unique_ptr<const hardware::buffers::Plain<hmc_complex>> complexScalar2;
+    std::unique_ptr<const hardware::buffers::Plain<hmc_complex>> complexScalar3;
+    std::unique_ptr<const hardware::buffers::Plain<int>> noFixedTimeslices;
+
+    void addGaugeKernels();
+    void addWilsonKernels();
+    void addStaggeredKernels();
+
+    /**
+     * Average time of one call of the kernel in microseconds, after one warm-up call.
+     */
+    double measureKernel(const KernelCase& kernelCase) const;
+    /**
+     * Bandwidth of device-internal buffer copies in GB/s, counting the bytes read and written.
+     */
+    double measureCopyBandwidth() const;
+
+    void writeResults(const std::vector<KernelResult>& results, const double peakBandwidth) const;
+};
+
+#endif /* ROOFLINEBENCHMARK_H_ */
@@ -53,7 +53,9 @@ void su3heatbathExecutable::setIterationParameters()
 {
     generationExecutable::setIterationParameters();
     nextToLastGenerationTraj += parameters.get_heatbathsteps();
-    overrelaxSteps = parameters.get_overrelaxsteps();
+    overrelaxSteps             = parameters.get_overrelaxsteps();
+    multilevelSublatticeExtent = parameters.get_multilevel_sublattice_extent();
+    multilevelUpdates          = parameters.get_multilevel_updates();
 }
 
 void su3heatbathExecutable::thermalizeAccordingToSpecificAlgorithm()
@@ -65,3 +67,34 @@ void su3heatbathExecutable::generateAccordingToSpecificAlgorithm()
 {
     physics::algorithms::su3heatbath(*gaugefield, *prng, overrelaxSteps);
 }
+
+void su3heatbathExecutable::performOnlineMeasurements()
+{
+    generationExecutable::performOnlineMeasurements();
+    if (multilevelSublatticeExtent > 0 && ((iteration + 1) % writeFrequency) == 0) {
+        measureMultilevelPolyakovloopAndWriteToFile();
+    }
+}
+
+void su3heatbathExecutable::measureMultilevelPolyakovloopAndWriteToFile()
+{
+    const std::vector<hmc_complex> loops = physics::algorithms::multilevel_polyakov_loops(
+        *gaugefield, *prng, multilevelSublatticeExtent, multilevelUpdates, overrelaxSteps);
+    hmc_complex polyakov = hmc_complex_zero;
+    for (const auto& loop : loops) {
+        polyakov.re += loop.re;
+        polyakov.im += loop.im;
+    }
+    polyakov.re /= loops.size();
+    polyakov.im /= loops.size();
+    logger.info() << "\tmultilevel Polyakov loop:\t" << std::setprecision(15) << polyakov.re << "\t" << polyakov.im;
+
+    const std::string filename =
+        parameters.get_gauge_obs_prefix() + "Multilevel" + parameters.get_gauge_obs_postfix();
+    outputToFile.open(filename.c_str(), std::ios::out | std::ios::app);
+    if (!outputToFile.is_open())
+        throw File_Exception(filename);
+    outputToFile << iteration << "\t" << std::scientific << std::setprecision(15) << polyakov.re << "\t"
+                 << polyakov.im << "\t" << sqrt(polyakov.re * polyakov.re + polyakov.im * polyakov.im) << std::endl;
+    outputToFile.close();
+}
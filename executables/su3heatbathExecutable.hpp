@@ -21,6 +21,7 @@
 #ifndef SU3HEATBATHEXECUTABLE_H_
 #define SU3HEATBATHEXECUTABLE_H_
 
+#include "../physics/algorithms/multilevel.hpp"
 #include "../physics/algorithms/su3heatbath.hpp"
 #include "generationExecutable.hpp"
 
@@ -30,6 +31,8 @@ class su3heatbathExecutable : public generationExecutable {
 
   private:
     int overrelaxSteps;
+    unsigned int multilevelSublatticeExtent;
+    unsigned int multilevelUpdates;
 
     /*
      * Thermalize the system using the heatbath algorithm.
@@ -41,6 +44,13 @@ class su3heatbathExecutable : public generationExecutable {
      */
     void generateAccordingToSpecificAlgorithm();
 
+    /*
+     * Measure the gauge observables and, if requested, the Polyakov loop using the multilevel algorithm.
+     */
+    void performOnlineMeasurements() override;
+
+    void measureMultilevelPolyakovloopAndWriteToFile();
+
     void writeSu3heatbathLogfile();
 
     void printParametersToScreenAndFile();
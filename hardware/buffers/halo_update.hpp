@@ -111,39 +111,50 @@ void hardware::buffers::update_halo(std::vector<BUFFER*> buffers, const hardware
         const unsigned VOL4D_LOCAL = get_vol4d(main_device->getLocalLatticeExtents()) * ELEMS_PER_SITE;
         const size_t num_buffers   = buffers.size();
 
-        // host buffers for intermediate data storage (no direct device to device copy)
-        std::vector<T*> upper_boundaries;
-        upper_boundaries.reserve(num_buffers);
-        std::vector<T*> lower_boundaries;
-        lower_boundaries.reserve(num_buffers);
+        // the boundaries are moved using the transfer links of the system, which keep their intermediate storage (if
+        // any) between calls, such that no memory is allocated and no data goes through the host here
+        const size_t region[] = {HALO_ELEMS * sizeof(T), 1, 1};
+
+        // copy inside of boundaries into the transfers
         for (size_t i = 0; i < num_buffers; ++i) {
-            upper_boundaries.push_back(new T[HALO_ELEMS]);
-            lower_boundaries.push_back(new T[HALO_ELEMS]);
+            const auto buffer = buffers[i];
+            const size_t upper_origin[] = {(VOL4D_LOCAL - HALO_ELEMS) * sizeof(T), 0, 0};
+            auto const up_transfer = system.get_transfer(i, upper_grid_neighbour(i, GRID_SIZE), UP_TRANSFER);
+            up_transfer->load(buffer, upper_origin, region, 0, 0, SynchronizationEvent());
+            const size_t lower_origin[] = {0, 0, 0};
+            auto const down_transfer = system.get_transfer(i, lower_grid_neighbour(i, GRID_SIZE), DOWN_TRANSFER);
+            down_transfer->load(buffer, lower_origin, region, 0, 0, SynchronizationEvent());
         }
 
-        // copy inside of boundaries to host
+        for (auto* device : system.get_devices()) {
+            device->flush();
+        }
+
+        // trigger transfers (might be a NOOP)
         for (size_t i = 0; i < num_buffers; ++i) {
-            const auto buffer = buffers[i];
-            buffer->dump(upper_boundaries[i], HALO_ELEMS, VOL4D_LOCAL - HALO_ELEMS);
-            buffer->dump(lower_boundaries[i], HALO_ELEMS, 0);
+            system.get_transfer(i, upper_grid_neighbour(i, GRID_SIZE), UP_TRANSFER)->transfer();
+            system.get_transfer(i, lower_grid_neighbour(i, GRID_SIZE), DOWN_TRANSFER)->transfer();
         }
 
-        // copy data from host to halo (of coure getting what the neighbour stored
+        // copy data from the transfers to the halo (of course getting what the neighbour stored)
+        std::vector<SynchronizationEvent> events;
+        events.reserve(2 * num_buffers);
         for (size_t i = 0; i < num_buffers; ++i) {
             const auto buffer = buffers[i];
             // our lower halo is the upper bounary of our lower neighbour
             // its storage location is wrapped around to be the last chunk of data in our buffer, that is after local
             // data and upper halo
-            buffer->load(upper_boundaries[lower_grid_neighbour(i, GRID_SIZE)], HALO_ELEMS, VOL4D_LOCAL + HALO_ELEMS);
+            const size_t lower_halo_origin[] = {(VOL4D_LOCAL + HALO_ELEMS) * sizeof(T), 0, 0};
+            auto const up_transfer = system.get_transfer(lower_grid_neighbour(i, GRID_SIZE), i, UP_TRANSFER);
+            events.push_back(up_transfer->dump(buffer, lower_halo_origin, region, 0, 0, SynchronizationEvent()));
             // our upper halo is the lower bounary of our upper neighbour, it's stored right after our local data
-            buffer->load(lower_boundaries[upper_grid_neighbour(i, GRID_SIZE)], HALO_ELEMS, VOL4D_LOCAL);
+            const size_t upper_halo_origin[] = {VOL4D_LOCAL * sizeof(T), 0, 0};
+            auto const down_transfer = system.get_transfer(upper_grid_neighbour(i, GRID_SIZE), i, DOWN_TRANSFER);
+            events.push_back(down_transfer->dump(buffer, upper_halo_origin, region, 0, 0, SynchronizationEvent()));
         }
 
-        // clean up host
-        for (size_t i = 0; i < num_buffers; ++i) {
-            delete[] upper_boundaries[i];
-            delete[] lower_boundaries[i];
-        }
+        // this function is synchroneous, like the host-based copies it replaces
+        hardware::wait(events);
     }
 }
 
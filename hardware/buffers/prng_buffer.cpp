@@ -53,7 +53,7 @@ size_t hardware::buffers::get_prng_buffer_size(const hardware::Device* device, c
     if (useSameRandomNumbers) {
         return 1.;
     } else {
-#ifdef USE_PRNG_RANLUX
+#if defined(USE_PRNG_RANLUX) || defined(USE_PRNG_PHILOX)
         // make num of random states equal to default num of global threads
         // TODO make this somewhat more automatic (avoid code duplication)
         if (device->get_device_type() == CL_DEVICE_TYPE_GPU) {
@@ -47,6 +47,10 @@ namespace hardware {
 #ifdef USE_PRNG_RANLUX
             typedef cl_float4 prng_state_t[7];
             static_assert(sizeof(prng_state_t) == 7 * sizeof(cl_float4), "PRNG state type mockup is of wrong size.");
+#elif defined(USE_PRNG_PHILOX)
+            // key (seed and stream) and block counter, cf. philox.cl
+            typedef cl_uint prng_state_t[4];
+            static_assert(sizeof(prng_state_t) == sizeof(cl_uint4), "PRNG state type mockup is of wrong size.");
 #else  // USE_PRNG_XXX
 #    error No implemented PRNG selected
 #endif  // USE_PRNG_XXX
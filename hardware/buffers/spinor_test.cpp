@@ -29,9 +29,11 @@
 #define BOOST_TEST_MODULE hardware::buffers::Spinor
 #include "../../meta/type_ops.hpp"
 #include "../../meta/util.hpp"
+#include "../device.hpp"
 #include "../interfaceMockups.hpp"
 #include "../system.hpp"
 
+#include <algorithm>
 #include <boost/test/unit_test.hpp>
 
 BOOST_AUTO_TEST_CASE(initialization)
@@ -102,3 +104,70 @@ BOOST_AUTO_TEST_CASE(copy)
         delete[] buf2;
     }
 }
+
+static void checkStorageTypeSize(const hardware::buffers::Spinor& buffer, const size_t expectedStorageTypeSize)
+{
+    // the halo update copies get_lane_count() slices of get_lane_stride() elements of get_storage_type_size() bytes
+    BOOST_CHECK_EQUAL(buffer.get_storage_type_size(), expectedStorageTypeSize);
+    if (buffer.is_soa()) {
+        BOOST_CHECK_EQUAL(buffer.get_lane_stride() * buffer.get_lane_count() * buffer.get_storage_type_size(),
+                          buffer.get_bytes());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(storage_type_size)
+{
+    using namespace hardware;
+    using namespace hardware::buffers;
+
+    LatticeExtents lE(4, 4);
+    const hardware::HardwareParametersMockup hardwareParameters(lE);
+    const hardware::code::OpenClKernelParametersMockup kernelParameters(lE);
+    hardware::System system(hardwareParameters, kernelParameters);
+    for (Device* device : system.get_devices()) {
+        Spinor dummy(lE, device);
+        checkStorageTypeSize(dummy, dummy.is_soa() ? sizeof(hmc_complex) : sizeof(spinor));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(single_precision_storage)
+{
+    using namespace hardware;
+    using namespace hardware::buffers;
+
+    LatticeExtents lE(4, 4);
+    const hardware::HardwareParametersMockupWithGpusOnly hardwareParameters(lE.getNs(), lE.getNt());
+    const hardware::code::OpenClKernelParametersMockupForSinglePrecisionFermionStorage kernelParameters(lE);
+    try {
+        hardware::System system(hardwareParameters, kernelParameters);
+        const size_t elems = system.getHardwareParameters()->getLatticeVolume() / 2;
+        for (Device* device : system.get_devices()) {
+            spinor* buf  = new spinor[elems];
+            spinor* buf2 = new spinor[elems];
+            Spinor dummy(lE, device);
+            BOOST_REQUIRE(dummy.is_soa());
+            BOOST_REQUIRE(device->usesSinglePrecisionFermionStorage());
+            checkStorageTypeSize(dummy, sizeof(cl_float2));
+
+            fill(buf, elems, 1);
+            fill(buf2, elems, 2);
+            dummy.load(buf);
+            dummy.dump(buf2);
+            const hmc_float* in  = reinterpret_cast<const hmc_float*>(buf);
+            const hmc_float* out = reinterpret_cast<const hmc_float*>(buf2);
+            for (size_t i = 0; i < elems * sizeof(spinor) / sizeof(hmc_float); ++i) {
+                BOOST_REQUIRE_CLOSE(in[i], out[i], 1.e-4);
+            }
+            // values drawn with drand48 are not representable in single precision
+            BOOST_CHECK(!std::equal(buf, buf + elems, buf2));
+
+            delete[] buf;
+            delete[] buf2;
+        }
+    } catch (hardware::OpenclException& exception) {
+        if (!checkIfNoOpenCLDevicesWereFound(exception)) {
+            throw;
+        }
+        broadcastMessage_warn("System does not seem to contain GPU devices, skipping single precision storage test!");
+    }
+}
@@ -30,7 +30,11 @@
 #include <stdexcept>
 
 typedef hmc_complex soa_storage_t;
-const size_t soa_storage_lanes = 9;
+
+static size_t get_soa_storage_lanes(const hardware::Device* device)
+{
+    return device->getNumberOfStoredLinkElements();
+}
 
 static size_t calculate_su3_buffer_size(size_t elems, const hardware::Device* device);
 
@@ -63,7 +67,7 @@ static size_t calculate_su3_buffer_size(const size_t elems, const hardware::Devi
     using namespace hardware::buffers;
     if (check_SU3_for_SOA(device)) {
         size_t stride = get_SU3_buffer_stride(elems, device);
-        return stride * soa_storage_lanes * sizeof(soa_storage_t);
+        return stride * get_soa_storage_lanes(device) * sizeof(soa_storage_t);
     } else {
         return elems * sizeof(Matrixsu3);
     }
@@ -71,7 +75,7 @@ static size_t calculate_su3_buffer_size(const size_t elems, const hardware::Devi
 
 size_t hardware::buffers::get_SU3_buffer_stride(const size_t elems, const Device* device)
 {
-    return device->recommendStride(elems, sizeof(soa_storage_t), soa_storage_lanes);
+    return device->recommendStride(elems, sizeof(soa_storage_t), get_soa_storage_lanes(device));
 }
 
 size_t hardware::buffers::SU3::get_elements() const noexcept
@@ -160,10 +164,10 @@ size_t hardware::buffers::SU3::get_storage_type_size() const noexcept
 
 size_t hardware::buffers::SU3::get_lane_stride() const noexcept
 {
-    return soa ? (get_bytes() / sizeof(soa_storage_t) / soa_storage_lanes) : 0;
+    return soa ? (get_bytes() / sizeof(soa_storage_t) / get_soa_storage_lanes(get_device())) : 0;
 }
 
 size_t hardware::buffers::SU3::get_lane_count() const noexcept
 {
-    return soa ? soa_storage_lanes : 1;
+    return soa ? get_soa_storage_lanes(get_device()) : 1;
 }
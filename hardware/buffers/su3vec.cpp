@@ -31,6 +31,11 @@
 #include <stdexcept>
 
 typedef hmc_complex soa_storage_t;
+
+static size_t get_soa_storage_type_size(const hardware::Device* device)
+{
+    return device->usesSinglePrecisionFermionStorage() ? sizeof(cl_float2) : sizeof(soa_storage_t);
+}
 const size_t soa_storage_lanes = 3;
 
 static size_t calculate_su3vec_buffer_size(const size_t elems, const hardware::Device* device);
@@ -64,7 +69,7 @@ static size_t calculate_su3vec_buffer_size(const size_t elems, const hardware::D
     using namespace hardware::buffers;
     if (check_su3vec_for_SOA(device)) {
         size_t stride = get_su3vec_buffer_stride(elems, device);
-        return stride * soa_storage_lanes * sizeof(soa_storage_t);
+        return stride * soa_storage_lanes * get_soa_storage_type_size(device);
     } else {
         return elems * sizeof(su3vec);
     }
@@ -72,7 +77,7 @@ static size_t calculate_su3vec_buffer_size(const size_t elems, const hardware::D
 
 size_t hardware::buffers::get_su3vec_buffer_stride(const size_t elems, const Device* device)
 {
-    return device->recommendStride(elems, sizeof(soa_storage_t), soa_storage_lanes);
+    return device->recommendStride(elems, get_soa_storage_type_size(device), soa_storage_lanes);
 }
 
 size_t hardware::buffers::SU3vec::get_elements() const noexcept
@@ -155,12 +160,12 @@ hardware::SynchronizationEvent hardware::buffers::Spinor::dumpRect_rawAsync(void
 
 size_t hardware::buffers::SU3vec::get_storage_type_size() const noexcept
 {
-    return soa ? sizeof(soa_storage_t) : sizeof(su3vec);
+    return soa ? get_soa_storage_type_size(get_device()) : sizeof(su3vec);
 }
 
 size_t hardware::buffers::SU3vec::get_lane_stride() const noexcept
 {
-    return soa ? (get_bytes() / sizeof(soa_storage_t) / soa_storage_lanes) : 0;
+    return soa ? (get_bytes() / get_soa_storage_type_size(get_device()) / soa_storage_lanes) : 0;
 }
 
 size_t hardware::buffers::SU3vec::get_lane_count() const noexcept
@@ -26,6 +26,7 @@
 
 #include "../../host_functionality/logger.hpp"
 #include "../device.hpp"
+#include "flopUtilities.hpp"
 #include "prng.hpp"
 #include "spinors.hpp"
 
@@ -47,9 +48,13 @@ void hardware::code::Correlator::fill_kernels()
     if (kernelParameters->getSourceType() == common::point)
         create_point_source = createKernel("create_point_source")
                               << basic_correlator_code << prng_code << "spinorfield_point_source.cl";
-    else if (kernelParameters->getSourceType() == common::volume)
+    else if (kernelParameters->getSourceType() == common::volume) {
         create_volume_source = createKernel("create_volume_source")
                                << basic_correlator_code << prng_code << "spinorfield_volume_source.cl";
+        create_volume_sources = createKernel("create_volume_sources")
+                                << basic_correlator_code << prng_code << "spinorfield_volume_source.cl"
+                                << "spinorfield_volume_sources_batched.cl";
+    }
     else if (kernelParameters->getSourceType() == common::timeslice)
         create_timeslice_source = createKernel("create_timeslice_source")
                                   << basic_correlator_code << prng_code << "spinorfield_timeslice_source.cl";
@@ -118,6 +123,8 @@ void hardware::code::Correlator::fill_kernels()
                     correlator_ax = createKernel("correlator_ax_t") << basic_correlator_code << filename_tmp;
                     correlator_ay = createKernel("correlator_ay_t") << basic_correlator_code << filename_tmp;
                     correlator_az = createKernel("correlator_az_t") << basic_correlator_code << filename_tmp;
+                    correlator_all = createKernel("correlator_all_t")
+                                     << basic_correlator_code << "fermionobservables_correlators_stochastic_all.cl";
                     break;
                 case 3:
                     correlator_ps = createKernel("correlator_ps_z") << basic_correlator_code << filename_tmp;
@@ -181,6 +188,10 @@ void hardware::code::Correlator::clear_kernels()
         clerr = clReleaseKernel(correlator_avps);
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clReleaseKernel", __FILE__, __LINE__);
+    if (correlator_all)
+        clerr = clReleaseKernel(correlator_all);
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clReleaseKernel", __FILE__, __LINE__);
     if (create_point_source) {
         clerr = clReleaseKernel(create_point_source);
         if (clerr != CL_SUCCESS)
@@ -191,6 +202,11 @@ void hardware::code::Correlator::clear_kernels()
         if (clerr != CL_SUCCESS)
             throw Opencl_Error(clerr, "clReleaseKernel", __FILE__, __LINE__);
     }
+    if (create_volume_sources) {
+        clerr = clReleaseKernel(create_volume_sources);
+        if (clerr != CL_SUCCESS)
+            throw Opencl_Error(clerr, "clReleaseKernel", __FILE__, __LINE__);
+    }
     if (create_timeslice_source) {
         clerr = clReleaseKernel(create_timeslice_source);
         if (clerr != CL_SUCCESS)
@@ -210,7 +226,11 @@ void hardware::code::Correlator::get_work_sizes(const cl_kernel kernel, size_t*
 
     // LZ: should be valid for all kernels for correlators, i.e. for names that look like correlator_??_?
     string kernelname = get_kernel_name(kernel);
-    if (kernelname.find("correlator") == 0) {
+    if (kernelname == "correlator_all_t") {
+        // one work-group per timeslice, the work-items of which share the sites
+        *num_groups = get_device()->getLocalLatticeExtents().getNt();
+        *gs         = *ls * *num_groups;
+    } else if (kernelname.find("correlator") == 0) {
         if (get_device()->get_device_type() == CL_DEVICE_TYPE_GPU) {
             *ls         = kernelParameters->getNs();
             *gs         = *ls;
@@ -254,6 +274,9 @@ cl_kernel hardware::code::Correlator::get_correlator_kernel(string which) const
     if (which.compare("avps") == 0) {
         return correlator_avps;
     }
+    if (which.compare("all") == 0) {
+        return correlator_all;
+    }
     throw Print_Error_Message("get_correlator_kernel failed, no appropriate kernel found");
     return 0;
 }
@@ -326,6 +349,45 @@ void hardware::code::Correlator::create_volume_source_device(const hardware::buf
     }
 }
 
+void hardware::code::Correlator::create_volume_sources_device(const hardware::buffers::Plain<spinor>* inout1,
+                                                              const hardware::buffers::Plain<spinor>* inout2,
+                                                              const hardware::buffers::Plain<spinor>* inout3,
+                                                              const hardware::buffers::Plain<spinor>* inout4,
+                                                              const hardware::buffers::PRNGBuffer* prng) const
+{
+    // query work-sizes for kernel
+    size_t ls2, gs2;
+    cl_uint num_groups;
+    this->get_work_sizes(create_volume_sources, &ls2, &gs2, &num_groups);
+    // set arguments
+    const std::vector<const hardware::buffers::Plain<spinor>*> sources{inout1, inout2, inout3, inout4};
+    int clerr;
+    for (cl_uint i = 0; i < sources.size(); ++i) {
+        clerr = clSetKernelArg(create_volume_sources, i, sizeof(cl_mem), sources[i]->get_cl_buffer());
+        if (clerr != CL_SUCCESS)
+            throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+    }
+
+    clerr = clSetKernelArg(create_volume_sources, 4, sizeof(cl_mem), prng->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    get_device()->enqueue_kernel(create_volume_sources, gs2, ls2);
+
+    if (logger.beDebug()) {
+        hardware::buffers::Plain<hmc_float> sqn_tmp(1, get_device());
+        hmc_float sqn;
+        for (auto source : sources) {
+            get_device()->getSpinorCode()->set_float_to_global_squarenorm_device(source, &sqn_tmp);
+            sqn_tmp.dump(&sqn);
+            logger.debug() << "\t|source|^2:\t" << sqn;
+            if (sqn != sqn) {
+                throw Print_Error_Message("calculation of source gave nan! Aborting...", __FILE__, __LINE__);
+            }
+        }
+    }
+}
+
 void hardware::code::Correlator::create_timeslice_source_device(const hardware::buffers::Plain<spinor>* inout,
                                                                 const hardware::buffers::PRNGBuffer* prng,
                                                                 const int timeslice) const
@@ -499,6 +561,41 @@ void hardware::code::Correlator::correlator(
 
     get_device()->enqueue_kernel(correlator_kernel, gs2, ls2);
 }
+void hardware::code::Correlator::all_correlators(const hardware::buffers::Plain<hmc_float>* correlators,
+                                                 const hardware::buffers::Plain<spinor>* in1,
+                                                 const hardware::buffers::Plain<spinor>* in2,
+                                                 const hardware::buffers::Plain<spinor>* in3,
+                                                 const hardware::buffers::Plain<spinor>* in4) const
+{
+    int clerr;
+    // query work-sizes for kernel
+    size_t ls2, gs2;
+    cl_uint num_groups;
+    this->get_work_sizes(correlator_all, &ls2, &gs2, &num_groups);
+    // set arguments
+    clerr = clSetKernelArg(correlator_all, 0, sizeof(cl_mem), correlators->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+    clerr = clSetKernelArg(correlator_all, 1, sizeof(cl_mem), in1->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+    clerr = clSetKernelArg(correlator_all, 2, sizeof(cl_mem), in2->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+    clerr = clSetKernelArg(correlator_all, 3, sizeof(cl_mem), in3->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+    clerr = clSetKernelArg(correlator_all, 4, sizeof(cl_mem), in4->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+    // one partial sum per channel and work-item
+    clerr = clSetKernelArg(correlator_all, 5, sizeof(hmc_float) * 8 * ls2, static_cast<void*>(nullptr));
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    get_device()->enqueue_kernel(correlator_all, gs2, ls2);
+}
+
 size_t hardware::code::Correlator::get_read_write_size(const std::string& in) const
 {
     // Depending on the compile-options, one has different sizes...
@@ -515,6 +612,9 @@ size_t hardware::code::Correlator::get_read_write_size(const std::string& in) co
     if (in == "create_volume_source") {
         return module_metric_not_implemented<size_t>();
     }
+    if (in == "create_volume_sources") {
+        return module_metric_not_implemented<size_t>();
+    }
     if (in == "create_timeslice_source") {
         return module_metric_not_implemented<size_t>();
     }
@@ -601,6 +701,10 @@ size_t hardware::code::Correlator::get_read_write_size(const std::string& in) co
             size_buffer = kernelParameters->getNt();
         return num_sources * S * D * 12 * C + size_buffer * D;
     }
+    if (in == "correlator_all_t") {
+        // this kernel reads 4 spinors per site and adds to 8 * NTIME real numbers
+        return 4 * S * D * 12 * C + 8 * 2 * kernelParameters->getNt() * D;
+    }
 
     return 0;
 }
@@ -614,6 +718,9 @@ uint64_t hardware::code::Correlator::get_flop_size(const std::string& in) const
     if (in == "create_volume_source") {
         return module_metric_not_implemented<uint64_t>();
     }
+    if (in == "create_volume_sources") {
+        return module_metric_not_implemented<uint64_t>();
+    }
     if (in == "create_timeslice_source") {
         return module_metric_not_implemented<uint64_t>();
     }
@@ -644,6 +751,12 @@ uint64_t hardware::code::Correlator::get_flop_size(const std::string& in) const
     if (in == "correlator_az_z") {
         return module_metric_not_implemented<uint64_t>();
     }
+    if (in == "correlator_all_t") {
+        // per site 16 su3vec squarenorms, 8 su3vec scalar products (of which the real part is used) and 4 * 16 + 6 * 8
+        // real additions
+        const size_t S = kernelParameters->getSpinorFieldSize();
+        return S * (16 * getFlopSu3VecSquareNorm() + 8 * getFlopSu3VecTimesSu3Vec() + 4 * 16 + 6 * 8);
+    }
 
     return 0;
 }
@@ -655,6 +768,8 @@ void hardware::code::Correlator::print_profiling(const std::string& filename, in
         Opencl_Module::print_profiling(filename, create_point_source);
     if (create_volume_source)
         Opencl_Module::print_profiling(filename, create_volume_source);
+    if (create_volume_sources)
+        Opencl_Module::print_profiling(filename, create_volume_sources);
     if (create_timeslice_source)
         Opencl_Module::print_profiling(filename, create_timeslice_source);
     if (create_zslice_source)
@@ -675,6 +790,8 @@ void hardware::code::Correlator::print_profiling(const std::string& filename, in
         Opencl_Module::print_profiling(filename, correlator_ay);
     if (correlator_az)
         Opencl_Module::print_profiling(filename, correlator_az);
+    if (correlator_all)
+        Opencl_Module::print_profiling(filename, correlator_all);
 }
 
 hardware::code::Correlator::Correlator(const hardware::code::OpenClKernelParametersInterface& kernelParameters,
@@ -682,6 +799,7 @@ hardware::code::Correlator::Correlator(const hardware::code::OpenClKernelParamet
     : Opencl_Module(kernelParameters, device)
     , create_point_source(0)
     , create_volume_source(0)
+    , create_volume_sources(0)
     , create_timeslice_source(0)
     , create_zslice_source(0)
     , correlator_ps(0)
@@ -693,6 +811,7 @@ hardware::code::Correlator::Correlator(const hardware::code::OpenClKernelParamet
     , correlator_ay(0)
     , correlator_az(0)
     , correlator_avps(0)
+    , correlator_all(0)
     , pbp_std(0)
     , pbp_tm_one_end(0)
 {
@@ -56,6 +56,16 @@ namespace hardware {
             void create_volume_source_device(const hardware::buffers::Plain<spinor>* inout,
                                              const hardware::buffers::PRNGBuffer* prng) const;
 
+            /**
+             * Fill four volume sources in one kernel launch.
+             * The sources are the same as the ones of four subsequent calls of create_volume_source_device.
+             */
+            void create_volume_sources_device(const hardware::buffers::Plain<spinor>* inout1,
+                                              const hardware::buffers::Plain<spinor>* inout2,
+                                              const hardware::buffers::Plain<spinor>* inout3,
+                                              const hardware::buffers::Plain<spinor>* inout4,
+                                              const hardware::buffers::PRNGBuffer* prng) const;
+
             void create_timeslice_source_device(const hardware::buffers::Plain<spinor>* inout,
                                                 const hardware::buffers::PRNGBuffer* prng, const int timeslice) const;
 
@@ -81,9 +91,20 @@ namespace hardware {
                        const hardware::buffers::Plain<spinor>* in4,
                        const hardware::buffers::Plain<spinor>* source4) const;
 
+            /**
+             * Calculate the correlators of all channels (ps, sc, vx, vy, vz, ax, ay, az) in a single pass over the
+             * four given fields. The result holds one block of NT entries per channel, in this order.
+             * Only available for stochastic sources and correlators in t-direction, cf. get_correlator_kernel("all").
+             */
+            void all_correlators(const hardware::buffers::Plain<hmc_float>* correlators,
+                                 const hardware::buffers::Plain<spinor>* in1,
+                                 const hardware::buffers::Plain<spinor>* in2,
+                                 const hardware::buffers::Plain<spinor>* in3,
+                                 const hardware::buffers::Plain<spinor>* in4) const;
+
             /**
              * Get kernel for correlator indicated by which
-             * @param[in] which string that identifies the correlator (ps or sc, vx, vy, vz, ax, ay, az)
+             * @param[in] which string that identifies the correlator (ps or sc, vx, vy, vz, ax, ay, az, all)
              * @return correlator_kernel
              */
             cl_kernel get_correlator_kernel(std::string which) const;
@@ -142,6 +163,7 @@ namespace hardware {
 
             cl_kernel create_point_source;
             cl_kernel create_volume_source;
+            cl_kernel create_volume_sources;
             cl_kernel create_timeslice_source;
             cl_kernel create_zslice_source;
 
@@ -159,6 +181,8 @@ namespace hardware {
             cl_kernel correlator_az;
             // axial-vector pseudoscalar correlator
             cl_kernel correlator_avps;
+            // all of the above but avps at once
+            cl_kernel correlator_all;
             // chiral condensate
             cl_kernel pbp_std;
             cl_kernel pbp_tm_one_end;
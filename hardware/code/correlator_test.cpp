@@ -277,6 +277,14 @@ struct ColorwiseCorrelatorTester : public CorrelatorTester {
     }
 };
 
+struct AllCorrelatorsTester : public CorrelatorTester {
+    AllCorrelatorsTester(const ParameterCollection pC, const ReferenceValues rV, const CorrelatorTestParameters tP)
+        : CorrelatorTester("all", pC, rV, tP)
+    {
+        code->all_correlators(result, spinorfields.at(0), spinorfields.at(1), spinorfields.at(2), spinorfields.at(3));
+    }
+};
+
 template<class TesterClass>
 void callTest(const KernelIdentifier kI, const LatticeExtents lE, const CorrelatorDirection cD,
               const SpinorFillTypes sF, const ReferenceValues rV)
@@ -379,6 +387,25 @@ void testAzCorrelator(const LatticeExtents lE, const CorrelatorDirection cD, con
     callTest<ColorwiseCorrelatorTester>("az", lE, cD, sF, rV);
 }
 
+/**
+ * The fused kernel exists for stochastic sources only, its result holds one block of NT entries per channel in the
+ * order ps, sc, vx, vy, vz, ax, ay, az.
+ */
+void testAllCorrelators(const LatticeExtents lE, const SpinorFillTypes sF, const std::vector<double> channelValues)
+{
+    ReferenceValues rV;
+    for (const double value : channelValues) {
+        rV.insert(rV.end(), lE.getNt(), value);
+    }
+    CorrelatorTestParameters parametersForThisTest(lE, CorrelatorDirection::temporal, sF);
+    hardware::HardwareParametersMockup hardwareParameters(parametersForThisTest.ns, parametersForThisTest.nt, false);
+    hardware::code::OpenClKernelParametersMockupForCorrelators kernelParameters(
+        parametersForThisTest.ns, parametersForThisTest.nt, parametersForThisTest.kappa,
+        parametersForThisTest.direction, common::sourcetypes::volume);
+    ParameterCollection parameterCollection{hardwareParameters, kernelParameters};
+    AllCorrelatorsTester(parameterCollection, rV, parametersForThisTest);
+}
+
 BOOST_AUTO_TEST_SUITE(SRC_VOLUME)
 
     BOOST_AUTO_TEST_CASE(SRC_VOLUME_1) { testVolumeSource(LatticeExtents{4, 4}, common::sourcecontents::one, 12); }
@@ -878,3 +905,32 @@ BOOST_AUTO_TEST_SUITE(CORRELATOR_AVPS_T)
     }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(CORRELATOR_ALL_T)
+
+    BOOST_AUTO_TEST_CASE(zero1)
+    {
+        testAllCorrelators(LatticeExtents{ns4, nt8},
+                           SpinorFillTypes{SpinorFillType::zero, SpinorFillType::zero, SpinorFillType::zero,
+                                           SpinorFillType::zero},
+                           {0., 0., 0., 0., 0., 0., 0., 0.});
+    }
+
+    BOOST_AUTO_TEST_CASE(nonZero1)
+    {
+        testAllCorrelators(LatticeExtents{ns8, nt4},
+                           SpinorFillTypes{SpinorFillType::one, SpinorFillType::one, SpinorFillType::one,
+                                           SpinorFillType::one},
+                           {192., 0., 192., 0., 0., 0., 0., 0.});
+    }
+
+    BOOST_AUTO_TEST_CASE(nonZero2)
+    {
+        // the values of the individual kernels are 1872 (sc), 144 (ax), -144 (ay) and -432 (az), cf. above
+        testAllCorrelators(LatticeExtents{ns4, nt8},
+                           SpinorFillTypes{SpinorFillType::ascendingReal, SpinorFillType::oneZero, SpinorFillType::one,
+                                           SpinorFillType::one},
+                           {2720., 1872., 480., -384., -960., 144., -144., -432.});
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
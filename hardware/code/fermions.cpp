@@ -28,11 +28,15 @@
 #include "flopUtilities.hpp"
 #include "spinors.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <stdexcept>
 
 using namespace std;
 
+constexpr size_t hardware::code::Fermions::DSLASH_EO_MULTI_MAX_RHS;
+
 void hardware::code::Fermions::fill_kernels()
 {
     sources = get_basic_sources() << "operations_geometry.cl"
@@ -94,6 +98,9 @@ void hardware::code::Fermions::fill_kernels()
         _dslash_eo_inner = createKernel("dslash_eo_inner") << sources << "fermionmatrix.cl"
                                                            << "fermionmatrix_eo.cl"
                                                            << "fermionmatrix_eo_dslash.cl";
+        dslash_eo_multi = createKernel("dslash_eo_multi") << sources << "fermionmatrix.cl"
+                                                          << "fermionmatrix_eo.cl"
+                                                          << "fermionmatrix_eo_dslash.cl";
         gamma5_eo = createKernel("gamma5_eo") << sources << "fermionmatrix.cl"
                                               << "fermionmatrix_eo_gamma5.cl";
         // merged kernels
@@ -107,6 +114,26 @@ void hardware::code::Fermions::fill_kernels()
                 << sources << "fermionmatrix.cl"
                 << "fermionmatrix_eo.cl"
                 << "fermionmatrix_eo_dslash_AND_M_tm_inverse_sitediagonal_minus.cl";
+            _dslash_AND_M_tm_inverse_sitediagonal_eo_inner =
+                createKernel("dslash_AND_M_tm_inverse_sitediagonal_eo_inner")
+                << sources << "fermionmatrix.cl"
+                << "fermionmatrix_eo.cl"
+                << "fermionmatrix_eo_dslash_AND_M_tm_inverse_sitediagonal.cl";
+            _dslash_AND_M_tm_inverse_sitediagonal_eo_boundary =
+                createKernel("dslash_AND_M_tm_inverse_sitediagonal_eo_boundary")
+                << sources << "fermionmatrix.cl"
+                << "fermionmatrix_eo.cl"
+                << "fermionmatrix_eo_dslash_AND_M_tm_inverse_sitediagonal.cl";
+            _dslash_AND_M_tm_inverse_sitediagonal_minus_eo_inner =
+                createKernel("dslash_AND_M_tm_inverse_sitediagonal_minus_eo_inner")
+                << sources << "fermionmatrix.cl"
+                << "fermionmatrix_eo.cl"
+                << "fermionmatrix_eo_dslash_AND_M_tm_inverse_sitediagonal_minus.cl";
+            _dslash_AND_M_tm_inverse_sitediagonal_minus_eo_boundary =
+                createKernel("dslash_AND_M_tm_inverse_sitediagonal_minus_eo_boundary")
+                << sources << "fermionmatrix.cl"
+                << "fermionmatrix_eo.cl"
+                << "fermionmatrix_eo_dslash_AND_M_tm_inverse_sitediagonal_minus.cl";
             M_tm_sitediagonal_AND_gamma5_eo = createKernel("M_tm_sitediagonal_AND_gamma5_eo")
                                               << sources << "fermionmatrix.cl"
                                               << "fermionmatrix_eo.cl"
@@ -120,6 +147,18 @@ void hardware::code::Fermions::fill_kernels()
                                                                       << "fermionmatrix_saxpy_AND_gamma5_eo.cl";
         }
     }
+
+    // saxpy_AND_gamma5_eo is excluded since get_work_sizes caps its local work size
+    for (const cl_kernel kernel :
+         {M_wilson, M_tm_plus, M_tm_minus, gamma5, M_tm_sitediagonal, M_tm_inverse_sitediagonal,
+          M_tm_sitediagonal_minus, M_tm_inverse_sitediagonal_minus, dslash_eo, _dslash_eo_boundary, _dslash_eo_inner,
+          dslash_eo_multi, gamma5_eo, dslash_AND_M_tm_inverse_sitediagonal_eo,
+          dslash_AND_M_tm_inverse_sitediagonal_minus_eo, _dslash_AND_M_tm_inverse_sitediagonal_eo_inner,
+          _dslash_AND_M_tm_inverse_sitediagonal_eo_boundary, _dslash_AND_M_tm_inverse_sitediagonal_minus_eo_inner,
+          _dslash_AND_M_tm_inverse_sitediagonal_minus_eo_boundary, M_tm_sitediagonal_AND_gamma5_eo,
+          M_tm_sitediagonal_minus_AND_gamma5_eo}) {
+        register_tunable_kernel(kernel);
+    }
 }
 
 void hardware::code::Fermions::clear_kernels()
@@ -165,6 +204,11 @@ void hardware::code::Fermions::clear_kernels()
             if (clerr != CL_SUCCESS)
                 throw Opencl_Error(clerr, "clReleaseKernel", __FILE__, __LINE__);
         }
+        if (dslash_eo_multi) {
+            clerr = clReleaseKernel(dslash_eo_multi);
+            if (clerr != CL_SUCCESS)
+                throw Opencl_Error(clerr, "clReleaseKernel", __FILE__, __LINE__);
+        }
         if (gamma5_eo) {
             clerr = clReleaseKernel(gamma5_eo);
             if (clerr != CL_SUCCESS)
@@ -208,6 +252,26 @@ void hardware::code::Fermions::clear_kernels()
                 if (clerr != CL_SUCCESS)
                     throw Opencl_Error(clerr, "clReleaseKernel", __FILE__, __LINE__);
             }
+            if (_dslash_AND_M_tm_inverse_sitediagonal_eo_inner) {
+                clerr = clReleaseKernel(_dslash_AND_M_tm_inverse_sitediagonal_eo_inner);
+                if (clerr != CL_SUCCESS)
+                    throw Opencl_Error(clerr, "clReleaseKernel", __FILE__, __LINE__);
+            }
+            if (_dslash_AND_M_tm_inverse_sitediagonal_eo_boundary) {
+                clerr = clReleaseKernel(_dslash_AND_M_tm_inverse_sitediagonal_eo_boundary);
+                if (clerr != CL_SUCCESS)
+                    throw Opencl_Error(clerr, "clReleaseKernel", __FILE__, __LINE__);
+            }
+            if (_dslash_AND_M_tm_inverse_sitediagonal_minus_eo_inner) {
+                clerr = clReleaseKernel(_dslash_AND_M_tm_inverse_sitediagonal_minus_eo_inner);
+                if (clerr != CL_SUCCESS)
+                    throw Opencl_Error(clerr, "clReleaseKernel", __FILE__, __LINE__);
+            }
+            if (_dslash_AND_M_tm_inverse_sitediagonal_minus_eo_boundary) {
+                clerr = clReleaseKernel(_dslash_AND_M_tm_inverse_sitediagonal_minus_eo_boundary);
+                if (clerr != CL_SUCCESS)
+                    throw Opencl_Error(clerr, "clReleaseKernel", __FILE__, __LINE__);
+            }
             if (M_tm_sitediagonal_AND_gamma5_eo) {
                 clerr = clReleaseKernel(M_tm_sitediagonal_AND_gamma5_eo);
                 if (clerr != CL_SUCCESS)
@@ -547,80 +611,154 @@ void hardware::code::Fermions::dslash_eo_inner(const hardware::buffers::Spinor*
     get_device()->enqueue_kernel(_dslash_eo_inner, gs2, ls2);
 }
 
-void hardware::code::Fermions::dslash_AND_M_tm_inverse_sitediagonal_eo_device(const hardware::buffers::Spinor* in,
-                                                                              const hardware::buffers::Spinor* out,
-                                                                              const hardware::buffers::SU3* gf,
-                                                                              int evenodd, hmc_float kappa,
-                                                                              hmc_float mubar) const
+void hardware::code::Fermions::dslash_eo_multi_device(const std::vector<const hardware::buffers::Spinor*>& in,
+                                                      const std::vector<const hardware::buffers::Spinor*>& out,
+                                                      const hardware::buffers::SU3* gf, int evenodd,
+                                                      hmc_float kappa) const
 {
-    cl_int eo = evenodd;
+    if (in.size() != out.size() || in.empty() || in.size() > DSLASH_EO_MULTI_MAX_RHS) {
+        throw std::invalid_argument("Invalid number of buffers passed to dslash_eo_multi");
+    }
+
+    // get kappa
+    hmc_float kappa_tmp;
+    if (kappa == ARG_DEF)
+        kappa_tmp = kernelParameters->getKappa();
+    else
+        kappa_tmp = kappa;
+
+    cl_int eo      = evenodd;
+    cl_int num_rhs = in.size();
     // query work-sizes for kernel
     size_t ls2, gs2;
     cl_uint num_groups;
-    this->get_work_sizes(dslash_AND_M_tm_inverse_sitediagonal_eo, &ls2, &gs2, &num_groups);
-    // set arguments
-    int clerr = clSetKernelArg(dslash_AND_M_tm_inverse_sitediagonal_eo, 0, sizeof(cl_mem), in->get_cl_buffer());
-    if (clerr != CL_SUCCESS)
-        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+    this->get_work_sizes(dslash_eo_multi, &ls2, &gs2, &num_groups);
+    // set arguments, unused slots are filled with the first buffers, the kernel does not touch them
+    int clerr = CL_SUCCESS;
+    for (size_t i = 0; i < DSLASH_EO_MULTI_MAX_RHS; ++i) {
+        const size_t buf = (i < in.size()) ? i : 0;
+        clerr            = clSetKernelArg(dslash_eo_multi, i, sizeof(cl_mem), in[buf]->get_cl_buffer());
+        if (clerr != CL_SUCCESS)
+            throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
 
-    clerr = clSetKernelArg(dslash_AND_M_tm_inverse_sitediagonal_eo, 1, sizeof(cl_mem), out->get_cl_buffer());
-    if (clerr != CL_SUCCESS)
-        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+        clerr = clSetKernelArg(dslash_eo_multi, DSLASH_EO_MULTI_MAX_RHS + i, sizeof(cl_mem),
+                               out[buf]->get_cl_buffer());
+        if (clerr != CL_SUCCESS)
+            throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+    }
 
-    clerr = clSetKernelArg(dslash_AND_M_tm_inverse_sitediagonal_eo, 2, sizeof(cl_mem), gf->get_cl_buffer());
+    clerr = clSetKernelArg(dslash_eo_multi, 2 * DSLASH_EO_MULTI_MAX_RHS, sizeof(cl_mem), gf->get_cl_buffer());
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
 
-    clerr = clSetKernelArg(dslash_AND_M_tm_inverse_sitediagonal_eo, 3, sizeof(cl_int), &eo);
+    clerr = clSetKernelArg(dslash_eo_multi, 2 * DSLASH_EO_MULTI_MAX_RHS + 1, sizeof(cl_int), &num_rhs);
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
 
-    clerr = clSetKernelArg(dslash_AND_M_tm_inverse_sitediagonal_eo, 4, sizeof(hmc_float), &kappa);
+    clerr = clSetKernelArg(dslash_eo_multi, 2 * DSLASH_EO_MULTI_MAX_RHS + 2, sizeof(cl_int), &eo);
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
 
-    clerr = clSetKernelArg(dslash_AND_M_tm_inverse_sitediagonal_eo, 5, sizeof(hmc_float), &mubar);
+    clerr = clSetKernelArg(dslash_eo_multi, 2 * DSLASH_EO_MULTI_MAX_RHS + 3, sizeof(hmc_float), &kappa_tmp);
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
 
-    get_device()->enqueue_kernel(dslash_AND_M_tm_inverse_sitediagonal_eo, gs2, ls2);
+    get_device()->enqueue_kernel(dslash_eo_multi, gs2, ls2);
+}
+
+void hardware::code::Fermions::dslash_AND_M_tm_inverse_sitediagonal_eo_device(const hardware::buffers::Spinor* in,
+                                                                              const hardware::buffers::Spinor* out,
+                                                                              const hardware::buffers::SU3* gf,
+                                                                              int evenodd, hmc_float kappa,
+                                                                              hmc_float mubar) const
+{
+    enqueue_dslash_AND_M_tm_inverse_sitediagonal(dslash_AND_M_tm_inverse_sitediagonal_eo, in, out, gf, evenodd, kappa,
+                                                 mubar);
+}
+
+void hardware::code::Fermions::dslash_AND_M_tm_inverse_sitediagonal_eo_inner(const hardware::buffers::Spinor* in,
+                                                                             const hardware::buffers::Spinor* out,
+                                                                             const hardware::buffers::SU3* gf,
+                                                                             int evenodd, hmc_float kappa,
+                                                                             hmc_float mubar) const
+{
+    enqueue_dslash_AND_M_tm_inverse_sitediagonal(_dslash_AND_M_tm_inverse_sitediagonal_eo_inner, in, out, gf, evenodd,
+                                                 kappa, mubar);
+}
+
+void hardware::code::Fermions::dslash_AND_M_tm_inverse_sitediagonal_eo_boundary(const hardware::buffers::Spinor* in,
+                                                                                const hardware::buffers::Spinor* out,
+                                                                                const hardware::buffers::SU3* gf,
+                                                                                int evenodd, hmc_float kappa,
+                                                                                hmc_float mubar) const
+{
+    enqueue_dslash_AND_M_tm_inverse_sitediagonal(_dslash_AND_M_tm_inverse_sitediagonal_eo_boundary, in, out, gf,
+                                                 evenodd, kappa, mubar);
 }
 
 void hardware::code::Fermions::dslash_AND_M_tm_inverse_sitediagonal_minus_eo_device(
     const hardware::buffers::Spinor* in, const hardware::buffers::Spinor* out, const hardware::buffers::SU3* gf,
     int evenodd, hmc_float kappa, hmc_float mubar) const
 {
+    enqueue_dslash_AND_M_tm_inverse_sitediagonal(dslash_AND_M_tm_inverse_sitediagonal_minus_eo, in, out, gf, evenodd,
+                                                 kappa, mubar);
+}
+
+void hardware::code::Fermions::dslash_AND_M_tm_inverse_sitediagonal_minus_eo_inner(
+    const hardware::buffers::Spinor* in, const hardware::buffers::Spinor* out, const hardware::buffers::SU3* gf,
+    int evenodd, hmc_float kappa, hmc_float mubar) const
+{
+    enqueue_dslash_AND_M_tm_inverse_sitediagonal(_dslash_AND_M_tm_inverse_sitediagonal_minus_eo_inner, in, out, gf,
+                                                 evenodd, kappa, mubar);
+}
+
+void hardware::code::Fermions::dslash_AND_M_tm_inverse_sitediagonal_minus_eo_boundary(
+    const hardware::buffers::Spinor* in, const hardware::buffers::Spinor* out, const hardware::buffers::SU3* gf,
+    int evenodd, hmc_float kappa, hmc_float mubar) const
+{
+    enqueue_dslash_AND_M_tm_inverse_sitediagonal(_dslash_AND_M_tm_inverse_sitediagonal_minus_eo_boundary, in, out, gf,
+                                                 evenodd, kappa, mubar);
+}
+
+void hardware::code::Fermions::enqueue_dslash_AND_M_tm_inverse_sitediagonal(
+    const cl_kernel kernel, const hardware::buffers::Spinor* in, const hardware::buffers::Spinor* out,
+    const hardware::buffers::SU3* gf, int evenodd, hmc_float kappa, hmc_float mubar) const
+{
+    // get kappa and mu
+    hmc_float kappa_tmp = (kappa == ARG_DEF) ? kernelParameters->getKappa() : kappa;
+    hmc_float mubar_tmp = (mubar == ARG_DEF) ? kernelParameters->getMuBar() : mubar;
+
     cl_int eo = evenodd;
     // query work-sizes for kernel
     size_t ls2, gs2;
     cl_uint num_groups;
-    this->get_work_sizes(dslash_AND_M_tm_inverse_sitediagonal_minus_eo, &ls2, &gs2, &num_groups);
+    this->get_work_sizes(kernel, &ls2, &gs2, &num_groups);
     // set arguments
-    int clerr = clSetKernelArg(dslash_AND_M_tm_inverse_sitediagonal_minus_eo, 0, sizeof(cl_mem), in->get_cl_buffer());
+    int clerr = clSetKernelArg(kernel, 0, sizeof(cl_mem), in->get_cl_buffer());
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
 
-    clerr = clSetKernelArg(dslash_AND_M_tm_inverse_sitediagonal_minus_eo, 1, sizeof(cl_mem), out->get_cl_buffer());
+    clerr = clSetKernelArg(kernel, 1, sizeof(cl_mem), out->get_cl_buffer());
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
 
-    clerr = clSetKernelArg(dslash_AND_M_tm_inverse_sitediagonal_minus_eo, 2, sizeof(cl_mem), gf->get_cl_buffer());
+    clerr = clSetKernelArg(kernel, 2, sizeof(cl_mem), gf->get_cl_buffer());
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
 
-    clerr = clSetKernelArg(dslash_AND_M_tm_inverse_sitediagonal_minus_eo, 3, sizeof(cl_int), &eo);
+    clerr = clSetKernelArg(kernel, 3, sizeof(cl_int), &eo);
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
 
-    clerr = clSetKernelArg(dslash_AND_M_tm_inverse_sitediagonal_minus_eo, 4, sizeof(hmc_float), &kappa);
+    clerr = clSetKernelArg(kernel, 4, sizeof(hmc_float), &kappa_tmp);
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
 
-    clerr = clSetKernelArg(dslash_AND_M_tm_inverse_sitediagonal_minus_eo, 5, sizeof(hmc_float), &mubar);
+    clerr = clSetKernelArg(kernel, 5, sizeof(hmc_float), &mubar_tmp);
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
 
-    get_device()->enqueue_kernel(dslash_AND_M_tm_inverse_sitediagonal_minus_eo, gs2, ls2);
+    get_device()->enqueue_kernel(kernel, gs2, ls2);
 }
 
 void hardware::code::Fermions::M_tm_inverse_sitediagonal_device(const hardware::buffers::Spinor* in,
@@ -813,7 +951,7 @@ size_t hardware::code::Fermions::get_read_write_size(const std::string& in) cons
     // Depending on the compile-options, one has different sizes...
     size_t D = kernelParameters->getFloatSize();
     // this returns the number of entries in an su3-matrix
-    size_t R = kernelParameters->getMatSize();
+    size_t R = get_device()->getNumberOfStoredLinkElements();
     // this is the number of spinors in the system (or number of sites)
     size_t S   = kernelParameters->getSpinorFieldSize();
     size_t Seo = kernelParameters->getEoprecSpinorFieldSize();
@@ -862,6 +1000,9 @@ size_t hardware::code::Fermions::get_read_write_size(const std::string& in) cons
         const unsigned int dirs = 4;
         return (C * 12 * (2 * dirs + 1) + C * 2 * dirs * R) * D * Seo;
     }
+    if (in == "dslash_eo_multi") {
+        return get_read_write_size(in, DSLASH_EO_MULTI_MAX_RHS);
+    }
     if (in == "dslash_AND_M_tm_inverse_sitediagonal_eo") {
         // the dslash kernel reads 8 spinors, 8 su3matrices and writes 1 spinor:
         const unsigned int dirs = 4;
@@ -909,6 +1050,31 @@ static int flop_dslash_per_site()
     /// 1320 flop per site. This would correspond to have the kappa in the diagonal matrix still.
 }
 
+size_t hardware::code::Fermions::get_read_write_size(const std::string& in, size_t num_rhs) const
+{
+    if (in == "dslash_eo_multi") {
+        size_t D   = kernelParameters->getFloatSize();
+        size_t R   = get_device()->getNumberOfStoredLinkElements();
+        size_t Seo = kernelParameters->getEoprecSpinorFieldSize();
+        int C      = 2;
+        // for each of the fields passed this kernel reads 8 spinors and writes 1 spinor, the 8 su3matrices are read
+        // only once per call:
+        const unsigned int dirs = 4;
+        const size_t calls      = (num_rhs + DSLASH_EO_MULTI_MAX_RHS - 1) / DSLASH_EO_MULTI_MAX_RHS;
+        return (num_rhs * C * 12 * (2 * dirs + 1) + calls * C * 2 * dirs * R) * D * Seo;
+    }
+    return num_rhs * get_read_write_size(in);
+}
+
+uint64_t hardware::code::Fermions::get_flop_size(const std::string& in, size_t num_rhs) const
+{
+    if (in == "dslash_eo_multi") {
+        size_t Seo = kernelParameters->getEoprecSpinorFieldSize();
+        return num_rhs * Seo * flop_dslash_per_site();
+    }
+    return num_rhs * get_flop_size(in);
+}
+
 uint64_t hardware::code::Fermions::get_flop_size(const std::string& in) const
 {
     size_t S   = kernelParameters->getSpinorFieldSize();
@@ -952,6 +1118,9 @@ uint64_t hardware::code::Fermions::get_flop_size(const std::string& in) const
     if (in == "dslash_eo") {
         return Seo * flop_dslash_per_site();
     }
+    if (in == "dslash_eo_multi") {
+        return get_flop_size(in, DSLASH_EO_MULTI_MAX_RHS);
+    }
     if (in == "dslash_AND_M_tm_inverse_sitediagonal_eo") {
         return Seo * flop_dslash_per_site() + Seo * (NC * NDIM * getFlopComplexMult() + NC * NDIM * 2);
     }
@@ -989,8 +1158,13 @@ void hardware::code::Fermions::print_profiling(const std::string& filename, int
     Opencl_Module::print_profiling(filename, dslash_eo);
     Opencl_Module::print_profiling(filename, _dslash_eo_boundary);
     Opencl_Module::print_profiling(filename, _dslash_eo_inner);
+    Opencl_Module::print_profiling(filename, dslash_eo_multi);
     Opencl_Module::print_profiling(filename, dslash_AND_M_tm_inverse_sitediagonal_eo);
     Opencl_Module::print_profiling(filename, dslash_AND_M_tm_inverse_sitediagonal_minus_eo);
+    Opencl_Module::print_profiling(filename, _dslash_AND_M_tm_inverse_sitediagonal_eo_inner);
+    Opencl_Module::print_profiling(filename, _dslash_AND_M_tm_inverse_sitediagonal_eo_boundary);
+    Opencl_Module::print_profiling(filename, _dslash_AND_M_tm_inverse_sitediagonal_minus_eo_inner);
+    Opencl_Module::print_profiling(filename, _dslash_AND_M_tm_inverse_sitediagonal_minus_eo_boundary);
     Opencl_Module::print_profiling(filename, M_tm_sitediagonal_AND_gamma5_eo);
     Opencl_Module::print_profiling(filename, M_tm_sitediagonal_minus_AND_gamma5_eo);
     Opencl_Module::print_profiling(filename, saxpy_AND_gamma5_eo);
@@ -1010,8 +1184,13 @@ hardware::code::Fermions::Fermions(const hardware::code::OpenClKernelParametersI
     , dslash_eo(0)
     , _dslash_eo_boundary(0)
     , _dslash_eo_inner(0)
+    , dslash_eo_multi(0)
     , dslash_AND_M_tm_inverse_sitediagonal_eo(0)
     , dslash_AND_M_tm_inverse_sitediagonal_minus_eo(0)
+    , _dslash_AND_M_tm_inverse_sitediagonal_eo_inner(0)
+    , _dslash_AND_M_tm_inverse_sitediagonal_eo_boundary(0)
+    , _dslash_AND_M_tm_inverse_sitediagonal_minus_eo_inner(0)
+    , _dslash_AND_M_tm_inverse_sitediagonal_minus_eo_boundary(0)
     , M_tm_sitediagonal_AND_gamma5_eo(0)
     , M_tm_sitediagonal_minus_AND_gamma5_eo(0)
     , saxpy_AND_gamma5_eo(0)
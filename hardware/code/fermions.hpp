@@ -91,6 +91,24 @@ namespace hardware {
              */
             void dslash_eo_inner(const hardware::buffers::Spinor* in, const hardware::buffers::Spinor* out,
                                  const hardware::buffers::SU3* gf, int evenodd, hmc_float kappa = ARG_DEF) const;
+            /**
+             * Maximal number of spinorfields which can be passed to dslash_eo_multi_device at once.
+             */
+            static constexpr size_t DSLASH_EO_MULTI_MAX_RHS = 4;
+            /**
+             * Perform dslash_eo on the whole buffer for several spinorfields at once.
+             *
+             * Each link of the gaugefield is loaded only once per site and applied to all fields, which raises the
+             * arithmetic intensity compared to separate dslash_eo calls. The results agree bit by bit with the ones
+             * of dslash_eo_device.
+             *
+             * @param in At most DSLASH_EO_MULTI_MAX_RHS input buffers
+             * @param out Output buffers, one for each input buffer
+             */
+            void dslash_eo_multi_device(const std::vector<const hardware::buffers::Spinor*>& in,
+                                        const std::vector<const hardware::buffers::Spinor*>& out,
+                                        const hardware::buffers::SU3* gf, int evenodd,
+                                        hmc_float kappa = ARG_DEF) const;
             // merged:
             // void Aee_AND_gamma5_eo(const hardware::buffers::Spinor * in, const hardware::buffers::Spinor * out,
             //                        const hardware::buffers::SU3 * gf, hmc_float kappa = ARG_DEF,
@@ -108,6 +126,30 @@ namespace hardware {
                                                                       const hardware::buffers::SU3* gf, int evenodd,
                                                                       hmc_float kappa = ARG_DEF,
                                                                       hmc_float mubar = ARG_DEF) const;
+            /**
+             * Perform dslash_AND_M_tm_inverse_sitediagonal(_minus)_eo only on the inner sites which do not require the
+             * halo or only on the boundary sites that require it, respectively.
+             */
+            void dslash_AND_M_tm_inverse_sitediagonal_eo_inner(const hardware::buffers::Spinor* in,
+                                                               const hardware::buffers::Spinor* out,
+                                                               const hardware::buffers::SU3* gf, int evenodd,
+                                                               hmc_float kappa = ARG_DEF,
+                                                               hmc_float mubar = ARG_DEF) const;
+            void dslash_AND_M_tm_inverse_sitediagonal_eo_boundary(const hardware::buffers::Spinor* in,
+                                                                  const hardware::buffers::Spinor* out,
+                                                                  const hardware::buffers::SU3* gf, int evenodd,
+                                                                  hmc_float kappa = ARG_DEF,
+                                                                  hmc_float mubar = ARG_DEF) const;
+            void dslash_AND_M_tm_inverse_sitediagonal_minus_eo_inner(const hardware::buffers::Spinor* in,
+                                                                     const hardware::buffers::Spinor* out,
+                                                                     const hardware::buffers::SU3* gf, int evenodd,
+                                                                     hmc_float kappa = ARG_DEF,
+                                                                     hmc_float mubar = ARG_DEF) const;
+            void dslash_AND_M_tm_inverse_sitediagonal_minus_eo_boundary(const hardware::buffers::Spinor* in,
+                                                                        const hardware::buffers::Spinor* out,
+                                                                        const hardware::buffers::SU3* gf, int evenodd,
+                                                                        hmc_float kappa = ARG_DEF,
+                                                                        hmc_float mubar = ARG_DEF) const;
             void M_tm_sitediagonal_AND_gamma5_eo_device(const hardware::buffers::Spinor* in,
                                                         const hardware::buffers::Spinor* out,
                                                         hmc_float mubar = ARG_DEF) const;
@@ -139,6 +181,26 @@ namespace hardware {
              */
             virtual uint64_t get_flop_size(const std::string& in) const override;
 
+            /**
+             * Return amount of bytes read and written when a specific kernel is applied to num_rhs fields.
+             *
+             * Only dslash_eo_multi handles several fields per call, taking at most DSLASH_EO_MULTI_MAX_RHS of them.
+             * Further fields are counted as further calls. Any other kernel is counted as called once per field.
+             * For dslash_eo_multi, the single argument version assumes a call with DSLASH_EO_MULTI_MAX_RHS fields.
+             *
+             * @param in Name of the kernel under consideration.
+             * @param num_rhs Number of fields the kernel is applied to.
+             */
+            size_t get_read_write_size(const std::string& in, size_t num_rhs) const;
+
+            /**
+             * Return amount of Floating point operations performed when a specific kernel is applied to num_rhs fields.
+             *
+             * @param in Name of the kernel under consideration.
+             * @param num_rhs Number of fields the kernel is applied to.
+             */
+            uint64_t get_flop_size(const std::string& in, size_t num_rhs) const;
+
             ClSourcePackage get_sources() const noexcept;
 
           protected:
@@ -172,6 +234,15 @@ namespace hardware {
              * Virtual method, allows to clear additional kernels in inherited classes.
              */
             void clear_kernels();
+            /**
+             * Set the arguments of one of the dslash_AND_M_tm_inverse_sitediagonal kernels and enqueue it.
+             * The full, inner and boundary variants of both the plus and minus kernels share the same signature.
+             */
+            void enqueue_dslash_AND_M_tm_inverse_sitediagonal(const cl_kernel kernel,
+                                                              const hardware::buffers::Spinor* in,
+                                                              const hardware::buffers::Spinor* out,
+                                                              const hardware::buffers::SU3* gf, int evenodd,
+                                                              hmc_float kappa, hmc_float mubar) const;
 
             ////////////////////////////////////
             // kernels, sorted roughly by groups
@@ -188,8 +259,13 @@ namespace hardware {
             cl_kernel dslash_eo;
             cl_kernel _dslash_eo_boundary;
             cl_kernel _dslash_eo_inner;
+            cl_kernel dslash_eo_multi;
             cl_kernel dslash_AND_M_tm_inverse_sitediagonal_eo;
             cl_kernel dslash_AND_M_tm_inverse_sitediagonal_minus_eo;
+            cl_kernel _dslash_AND_M_tm_inverse_sitediagonal_eo_inner;
+            cl_kernel _dslash_AND_M_tm_inverse_sitediagonal_eo_boundary;
+            cl_kernel _dslash_AND_M_tm_inverse_sitediagonal_minus_eo_inner;
+            cl_kernel _dslash_AND_M_tm_inverse_sitediagonal_minus_eo_boundary;
             cl_kernel M_tm_sitediagonal_AND_gamma5_eo;
             cl_kernel M_tm_sitediagonal_minus_AND_gamma5_eo;
             cl_kernel saxpy_AND_gamma5_eo;
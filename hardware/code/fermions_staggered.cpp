@@ -174,7 +174,7 @@ size_t hardware::code::Fermions_staggered::get_read_write_size(const std::string
     // Depending on the compile-options, one has different sizes...
     size_t D = kernelParameters->getFloatSize();
     // this returns the number of entries in an su3-matrix
-    size_t R = kernelParameters->getMatSize();
+    size_t R = get_device()->getNumberOfStoredLinkElements();
     // this is the number of su3vec in the system (or number of sites)
     size_t S   = kernelParameters->getSpinorFieldSize();
     size_t Seo = kernelParameters->getEoprecSpinorFieldSize();
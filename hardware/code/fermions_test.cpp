@@ -23,8 +23,12 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE HARDWARE_CODE_FERMIONS
 
+#include "../../meta/type_ops.hpp"
 #include "FermionTester.hpp"
 
+#include <memory>
+#include <vector>
+
 /** todo:
  * - the way the reference values are passed is not nice, it should be somehow done automatically.
  *         Especially that one has to call the lattice volume explicitely is not nice
@@ -375,6 +379,58 @@ struct DslashEvenOddInnerTester : public FermionmatrixTesterWithSumAsKernelResul
     }
 };
 
+/*
+ * The first field is the one of the other dslash testers, the further ones alternate between a zero field and a copy of
+ * the first one, such that their results have to be zero or equal to the result of the first field.
+ */
+struct DslashEvenOddMultiTester : public FermionmatrixTesterWithSumAsKernelResult<EvenOddFermionmatrixTester> {
+    DslashEvenOddMultiTester(const ParameterCollection parameterCollection, const DslashEvenOddTestParameters& tP,
+                             const bool evenOrOddIn, const size_t numberOfFields)
+        : FermionmatrixTesterWithSumAsKernelResult<
+              EvenOddFermionmatrixTester>("dslash_eo_multi", parameterCollection, tP,
+                                          calculateReferenceValuesDslashEvenOdd(tP.latticeExtents,
+                                                                                calculateEvenOddSpinorfieldSize(
+                                                                                    tP.SpinorTestParameters::
+                                                                                        latticeExtents),
+                                                                                tP.fillTypes.at(0), tP.fillType,
+                                                                                tP.massParameters, tP.thetaT, tP.thetaS,
+                                                                                tP.chemPot))
+    {
+        EvenOddSpinorfieldCreator sf(tP.SpinorTestParameters::latticeExtents);
+        spinor* const zeroField = sf.createSpinorfield(SpinorFillType::zero);
+        spinor* const inField   = sf.createSpinorfield(tP.fillTypes.at(0));
+
+        std::vector<std::unique_ptr<const hardware::buffers::Spinor>> furtherFields;
+        std::vector<const hardware::buffers::Spinor*> inFields{in};
+        std::vector<const hardware::buffers::Spinor*> outFields{out};
+        for (size_t i = 1; i < numberOfFields; i++) {
+            furtherFields.emplace_back(new hardware::buffers::Spinor(elements, device));
+            furtherFields.back()->load((i % 2 == 0) ? inField : zeroField);
+            inFields.push_back(furtherFields.back().get());
+            furtherFields.emplace_back(new hardware::buffers::Spinor(elements, device));
+            furtherFields.back()->load(inField);  // to be overwritten
+            outFields.push_back(furtherFields.back().get());
+        }
+
+        code->dslash_eo_multi_device(inFields, outFields, gaugefieldBuffer, evenOrOddIn ? EVEN : ODD,
+                                     tP.massParameters.kappa);
+
+        std::vector<spinor> firstResult(elements);
+        std::vector<spinor> result(elements);
+        out->dump(firstResult.data());
+        for (size_t i = 1; i < numberOfFields; i++) {
+            outFields[i]->dump(result.data());
+            if (i % 2 == 0) {
+                BOOST_CHECK(result == firstResult);
+            } else {
+                BOOST_CHECK(std::vector<spinor>(zeroField, zeroField + elements) == result);
+            }
+        }
+        delete[] zeroField;
+        delete[] inField;
+    }
+};
+
 template<typename TesterClass, typename MassParameters, typename TestParameters, typename KernelParameterMockup>
 void callTest(const LatticeExtents latticeExtentsIn, const SpinorFillType spinorFillTypeIn,
               const GaugefieldFillType gaugefieldFillTypeIn, const MassParameters massParametersIn,
@@ -486,10 +542,11 @@ void testDslashEvenOdd(const LatticeExtents latticeExtentsIn, const SpinorFillTy
     DslashEvenOddTester tester(parameterCollection, parametersForThisTest, evenOrOddIn);
 }
 
-template<class TesterClass>
+template<class TesterClass, typename... FurtherTesterArguments>
 void callTestDslash(const LatticeExtents latticeExtentsIn, const SpinorFillType spinorFillTypeIn,
                     const GaugefieldFillType gaugefieldFillTypeIn, const WilsonMassParameters massParametersIn,
-                    const ThetaParameters thetaIn, ChemicalPotentials chemPotIn, const bool evenOrOddIn)
+                    const ThetaParameters thetaIn, ChemicalPotentials chemPotIn, const bool evenOrOddIn,
+                    const FurtherTesterArguments... furtherTesterArguments)
 {
     DslashEvenOddTestParameters parametersForThisTest(latticeExtentsIn, spinorFillTypeIn, gaugefieldFillTypeIn,
                                                       massParametersIn, thetaIn, chemPotIn);
@@ -500,7 +557,7 @@ void callTestDslash(const LatticeExtents latticeExtentsIn, const SpinorFillType
                          true, parametersForThisTest.massParameters.kappa, parametersForThisTest.thetaT,
                          parametersForThisTest.thetaS, parametersForThisTest.chemPot);
     ParameterCollection parameterCollection{hardwareParameters, kernelParameters};
-    TesterClass tester(parameterCollection, parametersForThisTest, evenOrOddIn);
+    TesterClass tester(parameterCollection, parametersForThisTest, evenOrOddIn, furtherTesterArguments...);
 }
 
 void testDslashEvenOddWithSpecificBCAndChemicalPotential(const LatticeExtents latticeExtentsIn,
@@ -536,6 +593,18 @@ void testDslashEvenOddInnerWithSpecificBCAndChemicalPotential(const LatticeExten
                                              thetaIn, chemPotIn, evenOrOddIn);
 }
 
+void testDslashEvenOddMultiWithSpecificBCAndChemicalPotential(const LatticeExtents latticeExtentsIn,
+                                                              const SpinorFillType spinorFillTypeIn,
+                                                              const GaugefieldFillType gaugefieldFillTypeIn,
+                                                              const WilsonMassParameters massParametersIn,
+                                                              const ThetaParameters thetaIn,
+                                                              ChemicalPotentials chemPotIn, const bool evenOrOddIn,
+                                                              const size_t numberOfFields = 1)
+{
+    callTestDslash<DslashEvenOddMultiTester>(latticeExtentsIn, spinorFillTypeIn, gaugefieldFillTypeIn, massParametersIn,
+                                             thetaIn, chemPotIn, evenOrOddIn, numberOfFields);
+}
+
 BOOST_AUTO_TEST_SUITE(M_WILSON)
 
     BOOST_AUTO_TEST_CASE(M_WILSON_1)
@@ -711,6 +780,51 @@ BOOST_AUTO_TEST_SUITE(DSLASH_EO_BOUNDARY)
     }
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(DSLASH_EO_MULTI)
+
+    BOOST_AUTO_TEST_CASE(DSLASH_EO_MULTI_BC_AND_CHEMPOT_1)
+    {
+        testDslashEvenOddMultiWithSpecificBCAndChemicalPotential(LatticeExtents{ns8, nt8},
+                                                                 SpinorFillType::ascendingComplex,
+                                                                 GaugefieldFillType::nonTrivial,
+                                                                 WilsonMassParameters{nonTrivialParameter},
+                                                                 ThetaParameters{nonTrivialParameter,
+                                                                                 nonTrivialParameter},
+                                                                 ChemicalPotentials{0., nonTrivialParameter}, true);
+    }
+
+    BOOST_AUTO_TEST_CASE(DSLASH_EO_MULTI_BC_AND_CHEMPOT_2)
+    {
+        testDslashEvenOddMultiWithSpecificBCAndChemicalPotential(LatticeExtents{ns12, nt12},
+                                                                 SpinorFillType::ascendingComplex,
+                                                                 GaugefieldFillType::nonTrivial,
+                                                                 WilsonMassParameters{nonTrivialParameter},
+                                                                 ThetaParameters{nonTrivialParameter,
+                                                                                 nonTrivialParameter},
+                                                                 ChemicalPotentials{nonTrivialParameter, 0.}, false);
+    }
+
+    BOOST_AUTO_TEST_CASE(DSLASH_EO_MULTI_BC_AND_CHEMPOT_3)
+    {
+        testDslashEvenOddMultiWithSpecificBCAndChemicalPotential(LatticeExtents{ns8, nt8},
+                                                                 SpinorFillType::ascendingComplex,
+                                                                 GaugefieldFillType::nonTrivial,
+                                                                 WilsonMassParameters{nonTrivialParameter},
+                                                                 ThetaParameters{nonTrivialParameter,
+                                                                                 nonTrivialParameter},
+                                                                 ChemicalPotentials{0., nonTrivialParameter}, true, 2);
+    }
+
+    BOOST_AUTO_TEST_CASE(DSLASH_EO_MULTI_BC_AND_CHEMPOT_4)
+    {
+        testDslashEvenOddMultiWithSpecificBCAndChemicalPotential(
+            LatticeExtents{ns12, nt12}, SpinorFillType::ascendingComplex, GaugefieldFillType::nonTrivial,
+            WilsonMassParameters{nonTrivialParameter}, ThetaParameters{nonTrivialParameter, nonTrivialParameter},
+            ChemicalPotentials{nonTrivialParameter, 0.}, false, hardware::code::Fermions::DSLASH_EO_MULTI_MAX_RHS);
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE(DSLASH_EO_INNER)
 
     BOOST_AUTO_TEST_CASE(DSLASH_EO_INNER_BC_AND_CHEMPOT_1)
@@ -66,6 +66,10 @@ void hardware::code::Gaugefield::fill_kernels()
     }
     convertGaugefieldToSOA   = createKernel("convertGaugefieldToSOA") << basic_opencl_code << "gaugefield_convert.cl";
     convertGaugefieldFromSOA = createKernel("convertGaugefieldFromSOA") << basic_opencl_code << "gaugefield_convert.cl";
+    convertGaugefieldToContractionCode = createKernel("convertGaugefieldToContractionCode")
+                                         << basic_opencl_code << "gaugefield_convert.cl";
+    convertGaugefieldFromContractionCode = createKernel("convertGaugefieldFromContractionCode")
+                                           << basic_opencl_code << "gaugefield_convert.cl";
 }
 
 void hardware::code::Gaugefield::clear_kernels()
@@ -117,6 +121,12 @@ void hardware::code::Gaugefield::clear_kernels()
     clerr = clReleaseKernel(convertGaugefieldFromSOA);
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clReleaseKernel", __FILE__, __LINE__);
+    clerr = clReleaseKernel(convertGaugefieldToContractionCode);
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clReleaseKernel", __FILE__, __LINE__);
+    clerr = clReleaseKernel(convertGaugefieldFromContractionCode);
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clReleaseKernel", __FILE__, __LINE__);
 }
 
 void hardware::code::Gaugefield::plaquette_device(const hardware::buffers::SU3* gf,
@@ -430,7 +440,7 @@ size_t hardware::code::Gaugefield::get_read_write_size(const std::string& in) co
 {
     // Depending on the compile-options, one has different sizes...
     size_t D = kernelParameters->getFloatSize();
-    size_t R = kernelParameters->getMatSize();
+    size_t R = get_device()->getNumberOfStoredLinkElements();
     // factor for complex numbers
     int C              = 2;
     const size_t VOL4D = kernelParameters->getLatticeVolume();
@@ -482,6 +492,10 @@ size_t hardware::code::Gaugefield::get_read_write_size(const std::string& in) co
     if (in == "convertGaugefieldFromSOA") {
         return 2 * kernelParameters->getLatticeVolume() * NDIM * R * C * D;
     }
+    if (in == "convertGaugefieldToContractionCode" || in == "convertGaugefieldFromContractionCode") {
+        // the contraction code always uses all NC * NC elements
+        return kernelParameters->getLatticeVolume() * NDIM * (R + NC * NC) * C * D;
+    }
     return 0;
 }
 
@@ -528,6 +542,8 @@ void hardware::code::Gaugefield::print_profiling(const std::string& filename, in
     Opencl_Module::print_profiling(filename, stout_smear);
     Opencl_Module::print_profiling(filename, convertGaugefieldToSOA);
     Opencl_Module::print_profiling(filename, convertGaugefieldFromSOA);
+    Opencl_Module::print_profiling(filename, convertGaugefieldToContractionCode);
+    Opencl_Module::print_profiling(filename, convertGaugefieldFromContractionCode);
 }
 
 void hardware::code::Gaugefield::importGaugefield(const hardware::buffers::SU3* gaugefield,
@@ -605,6 +621,42 @@ void hardware::code::Gaugefield::convertGaugefieldFromSOA_device(const hardware:
     get_device()->enqueue_kernel(convertGaugefieldFromSOA, gs2, ls2);
 }
 
+void hardware::code::Gaugefield::exportGaugefieldToContractionCode(const hardware::buffers::Plain<hmc_float>* dest,
+                                                                   const hardware::buffers::SU3* gaugefield) const
+{
+    size_t ls2, gs2;
+    cl_uint num_groups;
+    this->get_work_sizes(convertGaugefieldToContractionCode, &ls2, &gs2, &num_groups);
+
+    int clerr = clSetKernelArg(convertGaugefieldToContractionCode, 0, sizeof(cl_mem), dest->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    clerr = clSetKernelArg(convertGaugefieldToContractionCode, 1, sizeof(cl_mem), gaugefield->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    get_device()->enqueue_kernel(convertGaugefieldToContractionCode, gs2, ls2);
+}
+
+void hardware::code::Gaugefield::importGaugefieldFromContractionCode(
+    const hardware::buffers::SU3* gaugefield, const hardware::buffers::Plain<hmc_float>* src) const
+{
+    size_t ls2, gs2;
+    cl_uint num_groups;
+    this->get_work_sizes(convertGaugefieldFromContractionCode, &ls2, &gs2, &num_groups);
+
+    int clerr = clSetKernelArg(convertGaugefieldFromContractionCode, 0, sizeof(cl_mem), gaugefield->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    clerr = clSetKernelArg(convertGaugefieldFromContractionCode, 1, sizeof(cl_mem), src->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    get_device()->enqueue_kernel(convertGaugefieldFromContractionCode, gs2, ls2);
+}
+
 hardware::code::Gaugefield::Gaugefield(const hardware::code::OpenClKernelParametersInterface& kernelParameters,
                                        const hardware::Device* device)
     : Opencl_Module(kernelParameters, device), stout_smear(0), rectangles(0), rectangles_reduction(0)
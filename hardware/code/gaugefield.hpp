@@ -95,6 +95,21 @@ namespace hardware {
              */
             void virtual print_profiling(const std::string& filename, int number) const override;
 
+            /**
+             * Return amount of Floating point operations performed by a specific kernel per call.
+             * NOTE: this is meant to be the "netto" amount in order to be comparable.
+             *
+             * @param in Name of the kernel under consideration.
+             */
+            virtual uint64_t get_flop_size(const std::string& in) const override;
+
+            /**
+             * Return amount of bytes read and written by a specific kernel per call.
+             *
+             * @param in Name of the kernel under consideration.
+             */
+            virtual size_t get_read_write_size(const std::string& in) const override;
+
             /**
              * This applies stout smearing to a gaugefield
              */
@@ -120,6 +135,26 @@ namespace hardware {
              */
             void exportGaugefield(Matrixsu3* const dest, const hardware::buffers::SU3* gaugefield) const;
 
+            /**
+             * Convert the local timeslices of the gaugefield to the array format of the contraction code.
+             *
+             * @param[out] dest Buffer of 2 * NC * NC * NDIM hmc_float per local site
+             * @param[in] gaugefield The gaugefield in the device specific format
+             */
+            void exportGaugefieldToContractionCode(const hardware::buffers::Plain<hmc_float>* dest,
+                                                   const hardware::buffers::SU3* gaugefield) const;
+
+            /**
+             * Set the local timeslices of the gaugefield from the array format of the contraction code.
+             *
+             * The halo is not touched and has to be updated afterwards.
+             *
+             * @param[out] gaugefield The gaugefield in the device specific format
+             * @param[in] src Buffer of 2 * NC * NC * NDIM hmc_float per local site
+             */
+            void importGaugefieldFromContractionCode(const hardware::buffers::SU3* gaugefield,
+                                                     const hardware::buffers::Plain<hmc_float>* src) const;
+
             /**
              * Get the code required to use the gaugefield from kernels.
              */
@@ -138,21 +173,6 @@ namespace hardware {
             virtual void
             get_work_sizes(const cl_kernel kernel, size_t* ls, size_t* gs, cl_uint* num_groups) const override;
 
-            /**
-             * Return amount of Floating point operations performed by a specific kernel per call.
-             * NOTE: this is meant to be the "netto" amount in order to be comparable.
-             *
-             * @param in Name of the kernel under consideration.
-             */
-            virtual uint64_t get_flop_size(const std::string& in) const override;
-
-            /**
-             * Return amount of bytes read and written by a specific kernel per call.
-             *
-             * @param in Name of the kernel under consideration.
-             */
-            virtual size_t get_read_write_size(const std::string& in) const override;
-
           public:
             /**
              * @param[in] params points to an instance of inputparameters
@@ -179,6 +199,8 @@ namespace hardware {
             cl_kernel polyakov_reduction;
             cl_kernel convertGaugefieldToSOA;
             cl_kernel convertGaugefieldFromSOA;
+            cl_kernel convertGaugefieldToContractionCode;
+            cl_kernel convertGaugefieldFromContractionCode;
 
             void convertGaugefieldToSOA_device(const hardware::buffers::SU3* out,
                                                const hardware::buffers::Plain<Matrixsu3>* in) const;
@@ -145,7 +145,7 @@ size_t hardware::code::Gaugemomentum::get_read_write_size(const std::string& in)
         // this kernel writes 1 ae
         return (A)*D * G;
     }
-    if (in == "set_zero_gaugemomentum;") {
+    if (in == "set_zero_gaugemomentum") {
         // this kernel writes 1 ae per link
         return G * D * A;
     }
@@ -177,7 +177,7 @@ uint64_t hardware::code::Gaugemomentum::get_flop_size(const std::string& in) con
         ///@todo ? I did not count the gaussian normal pair production, which is very complicated...
         return 0;
     }
-    if (in == "set_zero_gaugemomentum;") {
+    if (in == "set_zero_gaugemomentum") {
         // this kernel performs 0 mults
         return 0;
     }
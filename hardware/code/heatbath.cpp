@@ -53,6 +53,10 @@ void hardware::code::Heatbath::fill_kernels()
                                                     << "overrelax_even.cl";
     overrelax_odd = createKernel("overrelax_odd") << sources << "operations_heatbath.cl"
                                                   << "overrelax_odd.cl";
+
+    multilevel_accumulate_transporters = createKernel("multilevel_accumulate_transporters") << sources
+                                                                                            << "multilevel.cl";
+    register_tunable_kernel(multilevel_accumulate_transporters);
 }
 
 void hardware::code::Heatbath::clear_kernels()
@@ -74,107 +78,99 @@ void hardware::code::Heatbath::clear_kernels()
     clerr = clReleaseKernel(overrelax_odd);
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clReleaseKernel", __FILE__, __LINE__);
+
+    clerr = clReleaseKernel(multilevel_accumulate_transporters);
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clReleaseKernel", __FILE__, __LINE__);
 }
 
 void hardware::code::Heatbath::run_heatbath(const hardware::buffers::SU3* gaugefield,
                                             const hardware::buffers::PRNGBuffer* prng,
-                                            const hardware::buffers::Plain<int>& fixed_timeslices) const
+                                            const hardware::buffers::Plain<int>& fixed_timeslices, const int evenodd,
+                                            const cl_int mu) const
 {
     cl_int clerr = CL_SUCCESS;
 
-    logger.debug() << "Clearing Heatbath kernels...";
-
+    const cl_kernel kernel           = (evenodd == EVEN) ? heatbath_even : heatbath_odd;
     const cl_int fixed_timeslice_num = fixed_timeslices.get_elements();
 
     size_t global_work_size, ls;
     cl_uint num_groups;
-    this->get_work_sizes(heatbath_even, &ls, &global_work_size, &num_groups);
+    this->get_work_sizes(kernel, &ls, &global_work_size, &num_groups);
 
-    clerr = clSetKernelArg(heatbath_even, 0, sizeof(cl_mem), gaugefield->get_cl_buffer());
+    clerr = clSetKernelArg(kernel, 0, sizeof(cl_mem), gaugefield->get_cl_buffer());
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
-    clerr = clSetKernelArg(heatbath_even, 2, sizeof(cl_mem), prng->get_cl_buffer());
+    clerr = clSetKernelArg(kernel, 1, sizeof(cl_int), &mu);
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
-
-    clerr = clSetKernelArg(heatbath_even, 3, sizeof(cl_int), &fixed_timeslice_num);
-    if(clerr != CL_SUCCESS)
-        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
-    clerr = clSetKernelArg(heatbath_even, 4, sizeof(cl_mem), fixed_timeslices.get_cl_buffer());
-    if(clerr != CL_SUCCESS)
-        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
-
-    for (cl_int i = 0; i < NDIM; i++) {
-        clerr = clSetKernelArg(heatbath_even, 1, sizeof(cl_int), &i);
-        if (clerr != CL_SUCCESS)
-            throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
-        get_device()->enqueue_kernel(heatbath_even, global_work_size, ls);
-    }
-
-    this->get_work_sizes(heatbath_odd, &ls, &global_work_size, &num_groups);
-
-    clerr = clSetKernelArg(heatbath_odd, 0, sizeof(cl_mem), gaugefield->get_cl_buffer());
+    clerr = clSetKernelArg(kernel, 2, sizeof(cl_mem), prng->get_cl_buffer());
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
-    clerr = clSetKernelArg(heatbath_odd, 2, sizeof(cl_mem), prng->get_cl_buffer());
+    clerr = clSetKernelArg(kernel, 3, sizeof(cl_int), &fixed_timeslice_num);
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
-
-    clerr = clSetKernelArg(heatbath_odd, 3, sizeof(cl_int), &fixed_timeslice_num);
-    if(clerr != CL_SUCCESS)
-        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
-    clerr = clSetKernelArg(heatbath_odd, 4, sizeof(cl_mem), fixed_timeslices.get_cl_buffer());
-    if(clerr != CL_SUCCESS)
+    clerr = clSetKernelArg(kernel, 4, sizeof(cl_mem), fixed_timeslices.get_cl_buffer());
+    if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
 
-    for (cl_int i = 0; i < NDIM; i++) {
-        clerr = clSetKernelArg(heatbath_odd, 1, sizeof(cl_int), &i);
-        if (clerr != CL_SUCCESS)
-            throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
-        get_device()->enqueue_kernel(heatbath_odd, global_work_size, ls);
-    }
+    get_device()->enqueue_kernel(kernel, global_work_size, ls);
 }
 
 void hardware::code::Heatbath::run_overrelax(const hardware::buffers::SU3* gaugefield,
-                                             const hardware::buffers::PRNGBuffer* prng) const
+                                             const hardware::buffers::PRNGBuffer* prng,
+                                             const hardware::buffers::Plain<int>& fixed_timeslices, const int evenodd,
+                                             const cl_int mu) const
 {
     cl_int clerr = CL_SUCCESS;
 
+    const cl_kernel kernel           = (evenodd == EVEN) ? overrelax_even : overrelax_odd;
+    const cl_int fixed_timeslice_num = fixed_timeslices.get_elements();
+
     size_t global_work_size, ls;
     cl_uint num_groups;
-    this->get_work_sizes(overrelax_even, &ls, &global_work_size, &num_groups);
+    this->get_work_sizes(kernel, &ls, &global_work_size, &num_groups);
 
-    clerr = clSetKernelArg(overrelax_even, 0, sizeof(cl_mem), gaugefield->get_cl_buffer());
+    clerr = clSetKernelArg(kernel, 0, sizeof(cl_mem), gaugefield->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+    clerr = clSetKernelArg(kernel, 1, sizeof(cl_int), &mu);
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+    clerr = clSetKernelArg(kernel, 2, sizeof(cl_mem), prng->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+    clerr = clSetKernelArg(kernel, 3, sizeof(cl_int), &fixed_timeslice_num);
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
-    clerr = clSetKernelArg(overrelax_even, 2, sizeof(cl_mem), prng->get_cl_buffer());
+    clerr = clSetKernelArg(kernel, 4, sizeof(cl_mem), fixed_timeslices.get_cl_buffer());
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
 
-    for (cl_int i = 0; i < NDIM; i++) {
-        clerr = clSetKernelArg(overrelax_even, 1, sizeof(cl_int), &i);
-        if (clerr != CL_SUCCESS)
-            throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
-        get_device()->enqueue_kernel(overrelax_even, global_work_size, ls);
-    }
+    get_device()->enqueue_kernel(kernel, global_work_size, ls);
+}
 
-    this->get_work_sizes(overrelax_odd, &ls, &global_work_size, &num_groups);
+void hardware::code::Heatbath::accumulate_sublattice_transporters(
+    const hardware::buffers::Plain<Matrix3x3>* transporters, const hardware::buffers::SU3* gaugefield,
+    const cl_uint sublatticeExtent) const
+{
+    size_t ls, gs;
+    cl_uint num_groups;
+    this->get_work_sizes(multilevel_accumulate_transporters, &ls, &gs, &num_groups);
 
-    clerr = clSetKernelArg(overrelax_odd, 0, sizeof(cl_mem), gaugefield->get_cl_buffer());
+    int clerr =
+        clSetKernelArg(multilevel_accumulate_transporters, 0, sizeof(cl_mem), transporters->get_cl_buffer());
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
-    clerr = clSetKernelArg(overrelax_odd, 2, sizeof(cl_mem), prng->get_cl_buffer());
+    clerr = clSetKernelArg(multilevel_accumulate_transporters, 1, sizeof(cl_mem), gaugefield->get_cl_buffer());
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
-
+    clerr = clSetKernelArg(multilevel_accumulate_transporters, 2, sizeof(cl_uint), &sublatticeExtent);
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
-    for (cl_int i = 0; i < NDIM; i++) {
-        clerr = clSetKernelArg(overrelax_odd, 1, sizeof(cl_int), &i);
-        if (clerr != CL_SUCCESS)
-            throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
-        get_device()->enqueue_kernel(overrelax_odd, global_work_size, ls);
-    }
+
+    multilevel_sublattice_extent = sublatticeExtent;
+    get_device()->enqueue_kernel(multilevel_accumulate_transporters, gs, ls);
 }
 
 void hardware::code::Heatbath::get_work_sizes(const cl_kernel kernel, size_t* ls, size_t* gs, cl_uint* num_groups) const
@@ -207,7 +203,7 @@ size_t hardware::code::Heatbath::get_read_write_size(const std::string& in) cons
 {
     // Depending on the compile-options, one has different sizes...
     size_t D = kernelParameters->getFloatSize();
-    size_t R = kernelParameters->getMatSize();
+    size_t R = get_device()->getNumberOfStoredLinkElements();
     // factor for complex numbers
     int C              = 2;
     const size_t VOL4D = kernelParameters->getLatticeVolume();
@@ -216,6 +212,13 @@ size_t hardware::code::Heatbath::get_read_write_size(const std::string& in) cons
         // this kernel reads ingredients for 1 staple plus 1 su3matrix and writes 1 su3-matrix
         return VOL4D / 2 * C * D * R * (6 * (NDIM - 1) + 1 + 1);
     }
+    if (in == "multilevel_accumulate_transporters") {
+        // this kernel reads every temporal link once and reads and writes one 3x3 matrix per spatial site and
+        // sublattice
+        const size_t transporters = kernelParameters->getSpatialLatticeVolume() *
+                                    (kernelParameters->getNt() / multilevel_sublattice_extent);
+        return VOL4D * C * D * R + transporters * 2 * C * D * NC * NC;
+    }
     return 0;
 }
 
@@ -223,8 +226,8 @@ uint64_t hardware::code::Heatbath::get_flop_size(const std::string& in) const
 {
     const size_t VOL4D = kernelParameters->getLatticeVolume();
     // this is the same as in the function above
-    ///@NOTE: I do not distinguish between su3 and 3x3 matrices. This is a difference if one use e.g. REC12, but here
-    /// one wants to have the "netto" flops for comparability.
+    ///@NOTE: I do not distinguish between su3 and 3x3 matrices. This is a difference if one use e.g. REC12 or REC8, but
+    /// here one wants to have the "netto" flops for comparability.
     if ((in == "heatbath_even") || (in == "heatbath_odd")) {
         // this kernel calculates 1 staple (= 4*ND-1 su3_su3 + 2_ND-1 su3_add) plus NC*(2*su3_su3 80 flops for the su2
         // update)
@@ -239,6 +242,13 @@ uint64_t hardware::code::Heatbath::get_flop_size(const std::string& in) const
                (4 * (NDIM - 1) * getFlopSu3MatrixTimesSu3Matrix() + 2 * (NDIM - 1) * 18 +
                 NC * (2 * getFlopSu3MatrixTimesSu3Matrix() + 58));
     }
+    if (in == "multilevel_accumulate_transporters") {
+        // this kernel performs one su3_su3 per temporal link plus one 3x3 addition (18 flops) per spatial site and
+        // sublattice
+        const size_t transporters = kernelParameters->getSpatialLatticeVolume() *
+                                    (kernelParameters->getNt() / multilevel_sublattice_extent);
+        return VOL4D * getFlopSu3MatrixTimesSu3Matrix() + transporters * 18;
+    }
     return 0;
 }
 
@@ -249,11 +259,12 @@ void hardware::code::Heatbath::print_profiling(const std::string& filename, int
     Opencl_Module::print_profiling(filename, heatbath_odd);
     Opencl_Module::print_profiling(filename, overrelax_even);
     Opencl_Module::print_profiling(filename, overrelax_odd);
+    Opencl_Module::print_profiling(filename, multilevel_accumulate_transporters);
 }
 
 hardware::code::Heatbath::Heatbath(const hardware::code::OpenClKernelParametersInterface& kernelParameters,
                                    const hardware::Device* device)
-    : Opencl_Module(kernelParameters, device)
+    : Opencl_Module(kernelParameters, device), multilevel_sublattice_extent(1)
 {
     fill_kernels();
 }
@@ -48,17 +48,34 @@ namespace hardware {
             virtual ~Heatbath();
 
             /**
-             * Perform one heatbath step.
+             * Perform the heatbath update of the links in direction mu on the even or odd sites of this device.
+             *
+             * A full heatbath step consists of the updates of all directions on even and then on odd sites. As the
+             * staples reach into the halo, the halo of the gaugefield has to be updated between these calls if the
+             * lattice is distributed over several devices.
              */
-            void
-            run_heatbath(const hardware::buffers::SU3* gaugefield, const hardware::buffers::PRNGBuffer* prng,
-                         const hardware::buffers::Plain<int>& fixed_timeslices) const;
+            void run_heatbath(const hardware::buffers::SU3* gaugefield, const hardware::buffers::PRNGBuffer* prng,
+                              const hardware::buffers::Plain<int>& fixed_timeslices, const int evenodd,
+                              const cl_int mu) const;
 
             /**
-             * Perform one overrelaxation step.
+             * Perform the overrelaxation of the links in direction mu on the even or odd sites of this device.
+             *
+             * The same remark about the halo as for run_heatbath applies, as do the fixed timeslices.
              */
-            void
-            run_overrelax(const hardware::buffers::SU3* gaugefield, const hardware::buffers::PRNGBuffer* prng) const;
+            void run_overrelax(const hardware::buffers::SU3* gaugefield, const hardware::buffers::PRNGBuffer* prng,
+                               const hardware::buffers::Plain<int>& fixed_timeslices, const int evenodd,
+                               const cl_int mu) const;
+
+            /**
+             * Add the products of the temporal links through each sublattice of this device to the transporters.
+             *
+             * The local timeslices are split in sublattices of sublatticeExtent timeslices, the transporters have
+             * to hold one matrix per spatial site and sublattice, the sublattice being the slower index.
+             */
+            void accumulate_sublattice_transporters(const hardware::buffers::Plain<Matrix3x3>* transporters,
+                                                    const hardware::buffers::SU3* gaugefield,
+                                                    const cl_uint sublatticeExtent) const;
 
             /**
              * Add specific work_size determination for this child class
@@ -74,6 +91,21 @@ namespace hardware {
              */
             void virtual print_profiling(const std::string& filename, int number) const override;
 
+            /**
+             * Return amount of bytes read and written by a specific kernel per call.
+             *
+             * @param in Name of the kernel under consideration.
+             */
+            virtual size_t get_read_write_size(const std::string& in) const override;
+
+            /**
+             * Return amount of Floating point operations performed by a specific kernel per call.
+             * NOTE: this is meant to be the "netto" amount in order to be comparable.
+             *
+             * @param in Name of the kernel under consideration.
+             */
+            virtual uint64_t get_flop_size(const std::string& in) const override;
+
             /**
              * @todo: the constructor must be public at the moment in order to be called from OpenClCode class.
              *        It may be made private again in the future!
@@ -99,21 +131,10 @@ namespace hardware {
             cl_kernel heatbath_even;
             cl_kernel overrelax_odd;
             cl_kernel overrelax_even;
+            cl_kernel multilevel_accumulate_transporters;
 
-            /**
-             * Return amount of bytes read and written by a specific kernel per call.
-             *
-             * @param in Name of the kernel under consideration.
-             */
-            virtual size_t get_read_write_size(const std::string& in) const override;
-
-            /**
-             * Return amount of Floating point operations performed by a specific kernel per call.
-             * NOTE: this is meant to be the "netto" amount in order to be comparable.
-             *
-             * @param in Name of the kernel under consideration.
-             */
-            virtual uint64_t get_flop_size(const std::string& in) const override;
+            // the sublattice extent of the last accumulation, which determines the number of transporters
+            mutable cl_uint multilevel_sublattice_extent;
         };
 
     }  // namespace code
@@ -118,6 +118,13 @@ void hardware::code::Molecular_Dynamics::fill_kernels()
         stout_smear_fermion_force = createKernel("stout_smear_fermion_force")
                                     << basic_molecular_dynamics_code << "force_fermion_stout_smear.cl";
     }
+
+    // the multipass tlsym kernels use their own global work size and the smeared force uses local memory
+    for (const cl_kernel kernel : {fermion_force, md_update_gaugefield, gauge_force, gauge_force_tlsym,
+                                   fermion_force_eo_0, fermion_force_eo_1, fermion_force_eo_2, fermion_force_eo_3,
+                                   fermion_stagg_partial_force_eo}) {
+        register_tunable_kernel(kernel);
+    }
 }
 
 void hardware::code::Molecular_Dynamics::clear_kernels()
@@ -201,7 +208,7 @@ size_t hardware::code::Molecular_Dynamics::get_read_write_size(const std::string
     // Depending on the compile-options, one has different sizes...
     size_t D = kernelParameters->getFloatSize();
     // this returns the number of entries in an su3-matrix
-    size_t R = kernelParameters->getMatSize();
+    size_t R = get_device()->getNumberOfStoredLinkElements();
     // this is the number of spinors in the system (or number of sites)
     size_t S   = kernelParameters->getSpinorFieldSize();
     size_t Seo = kernelParameters->getEoprecSpinorFieldSize();
@@ -87,18 +87,6 @@ namespace hardware {
              */
             void virtual print_profiling(const std::string& filename, int number) const override;
 
-          protected:
-            /**
-             * comutes work-sizes for a kernel
-             * @todo autotune
-             * @param ls local-work-size
-             * @param gs global-work-size
-             * @param num_groups number of work groups
-             * @param name name of the kernel for possible autotune-usage, not yet used!!
-             */
-            virtual void
-            get_work_sizes(const cl_kernel kernel, size_t* ls, size_t* gs, cl_uint* num_groups) const override;
-
             /**
              * Return amount of bytes read and written by a specific kernel per call.
              *
@@ -114,6 +102,18 @@ namespace hardware {
              */
             virtual uint64_t get_flop_size(const std::string& in) const override;
 
+          protected:
+            /**
+             * comutes work-sizes for a kernel
+             * @todo autotune
+             * @param ls local-work-size
+             * @param gs global-work-size
+             * @param num_groups number of work groups
+             * @param name name of the kernel for possible autotune-usage, not yet used!!
+             */
+            virtual void
+            get_work_sizes(const cl_kernel kernel, size_t* ls, size_t* gs, cl_uint* num_groups) const override;
+
             /**
              * @todo: the constructor must be public at the moment in order to be called from OpenClCode class.
              *        It may be made private again in the future!
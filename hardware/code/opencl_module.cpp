@@ -143,6 +143,12 @@ static std::string collect_basic_options(const hardware::Device* device,
     if (kernelParameters.getUseRec12() == true) {
         options << " -D _USE_REC12_";
     }
+    if (kernelParameters.getUseRec8() == true) {
+        options << " -D _USE_REC8_";
+    }
+    if (device->usesSinglePrecisionFermionStorage()) {
+        options << " -D _USE_SINGLEPREC_FERMION_STORAGE_";
+    }
     if (kernelParameters.getUseEo()) {
         options << " -D EOPREC_SPINORFIELDSIZE_GLOBAL=" << kernelParameters.getEoprecSpinorFieldSize();
         options << " -D EOPREC_SPINORFIELDSIZE_LOCAL=" << get_vol4d(local_size) / 2;
@@ -240,6 +246,7 @@ hardware::code::Opencl_Module::Opencl_Module(const hardware::code::OpenClKernelP
     , device(deviceIn)
     , fundamental_sources(ClSourcePackage(collect_build_files(), collect_fundamental_options(kernelParameters)))
     , basic_sources(ClSourcePackage(collect_build_files(), collect_basic_options(device, kernelParameters)))
+    , tunable_kernels()
 {
 }
 
@@ -265,6 +272,13 @@ TmpClKernel hardware::code::Opencl_Module::createKernel(const char* const kernel
     return device->createKernel(kernel_name, build_opts);
 }
 
+void hardware::code::Opencl_Module::register_tunable_kernel(const cl_kernel kernel)
+{
+    if (kernel) {
+        tunable_kernels.insert(kernel);
+    }
+}
+
 void hardware::code::Opencl_Module::get_work_sizes(const cl_kernel kernel, size_t* ls, size_t* gs,
                                                    cl_uint* num_groups) const
 {
@@ -274,6 +288,10 @@ void hardware::code::Opencl_Module::get_work_sizes(const cl_kernel kernel, size_
     size_t local_work_size  = device->get_preferred_local_thread_num();
     size_t global_work_size = device->get_preferred_global_thread_num();
 
+    if (tunable_kernels.count(kernel)) {
+        device->getTunedWorkSizes(kernel, &local_work_size, &global_work_size);
+    }
+
     const cl_uint num_groups_tmp = (global_work_size + local_work_size - 1) / local_work_size;
     global_work_size             = local_work_size * num_groups_tmp;
 
@@ -42,6 +42,7 @@
 #include <cmath>
 #include <fstream>
 #include <limits>
+#include <set>
 #include <string>
 
 // predeclaration as headers only use pointers and friend to this
@@ -74,6 +75,21 @@ namespace hardware {
              */
             void virtual print_profiling(const std::string& filename, int number) const;
 
+            /**
+             * Return amount of Floating point operations performed by a specific kernel per call.
+             * NOTE: this is meant to be the "netto" amount in order to be comparable.
+             *
+             * @param in Name of the kernel under consideration.
+             */
+            virtual uint64_t get_flop_size(const std::string& in) const = 0;
+
+            /**
+             * Return amount of bytes read and written by a specific kernel per call.
+             *
+             * @param in Name of the kernel under consideration.
+             */
+            virtual size_t get_read_write_size(const std::string& in) const = 0;
+
             /**
              * Returns the sources for all children modules.
              */
@@ -87,7 +103,7 @@ namespace hardware {
 
             /**
              * comutes work-sizes for a kernel
-             * @todo autotune
+             * For kernels registered as tunable the device may replace the default sizes by autotuned ones.
              * @param ls local-work-size
              * @param gs global-work-size
              * @param num_groups number of work groups
@@ -96,21 +112,6 @@ namespace hardware {
              */
             virtual void get_work_sizes(const cl_kernel kernel, size_t* ls, size_t* gs, cl_uint* num_groups) const;
 
-            /**
-             * Return amount of Floating point operations performed by a specific kernel per call.
-             * NOTE: this is meant to be the "netto" amount in order to be comparable.
-             *
-             * @param in Name of the kernel under consideration.
-             */
-            virtual uint64_t get_flop_size(const std::string& in) const = 0;
-
-            /**
-             * Return amount of bytes read and written by a specific kernel per call.
-             *
-             * @param in Name of the kernel under consideration.
-             */
-            virtual size_t get_read_write_size(const std::string& in) const = 0;
-
             /**
              * Return the kernel name as a string
              * @param[in] kernel
@@ -130,6 +131,15 @@ namespace hardware {
              */
             TmpClKernel createKernel(const char* const kernel_name, std::string build_opts = "") const;
 
+            /**
+             * Allow the work sizes of the given kernel to be autotuned.
+             *
+             * Only kernels whose result does not depend on the work sizes, i.e. which neither use local memory nor
+             * the number of groups nor random numbers, and which are always enqueued with the sizes returned by
+             * get_work_sizes must be registered. Null kernels are ignored.
+             */
+            void register_tunable_kernel(const cl_kernel kernel);
+
             /**
              * Print the profiling information for the given kernel to the given file.
              *
@@ -151,6 +161,11 @@ namespace hardware {
              */
             ClSourcePackage fundamental_sources;
             ClSourcePackage basic_sources;
+
+            /**
+             * The kernels whose work sizes may be autotuned
+             */
+            std::set<cl_kernel> tunable_kernels;
         };
 
         template<typename T>
@@ -35,6 +35,9 @@ collect_build_options(const hardware::Device* device, const hardware::code::Open
 #ifdef USE_PRNG_RANLUX
     options << "-D USE_PRNG_RANLUX -D RANLUXCL_MAXWORKITEMS="
             << hardware::buffers::get_prng_buffer_size(device, params.getUseSameRndNumbers());
+#elif defined(USE_PRNG_PHILOX)
+    options << "-D USE_PRNG_PHILOX -D PRNG_NUMBER_OF_STATES="
+            << hardware::buffers::get_prng_buffer_size(device, params.getUseSameRndNumbers());
 #else  // USE_PRNG_XXX
 #    error No implemented PRNG selected
 #endif  // USE_PRNG_XXX
@@ -54,6 +57,14 @@ hardware::code::Prng::Prng(const hardware::code::OpenClKernelParametersInterface
                   << ClSourcePackage("-I " + std::string(SOURCEDIR) + " -D _INKERNEL_") << "globaldefs.hpp"
                   << "types.hpp"
                   << "opencl_header.cl" << prng_code << "random_ranlux_init.cl";
+#elif defined(USE_PRNG_PHILOX)
+    logger.debug() << "Creating PRNG kernels...";
+    prng_code   = ClSourcePackage(collect_build_options(get_device(), kernelParameters)) << "philox.cl"
+                                                                                       << "random.cl";
+    init_kernel = createKernel("prng_philox_init")
+                  << ClSourcePackage("-I " + std::string(SOURCEDIR) + " -D _INKERNEL_") << "globaldefs.hpp"
+                  << "types.hpp"
+                  << "opencl_header.cl" << prng_code << "random_philox_init.cl";
 #else  // USE_PRNG_XXX
 #    error No implemented PRNG selected
 #endif  // USE_PRNG_XXX
@@ -61,7 +72,7 @@ hardware::code::Prng::Prng(const hardware::code::OpenClKernelParametersInterface
 
 hardware::code::Prng::~Prng()
 {
-#ifdef USE_PRNG_RANLUX
+#if defined(USE_PRNG_RANLUX) || defined(USE_PRNG_PHILOX)
     logger.debug() << "Clearing PRNG kernels...";
     cl_int clerr = clReleaseKernel(init_kernel);
     if (clerr != CL_SUCCESS)
@@ -76,8 +87,9 @@ ClSourcePackage hardware::code::Prng::get_sources() const noexcept
     return prng_code;
 }
 
-#ifdef USE_PRNG_RANLUX
-void hardware::code::Prng::initialize(const hardware::buffers::PRNGBuffer* buffer, cl_uint seed) const
+#if defined(USE_PRNG_RANLUX) || defined(USE_PRNG_PHILOX)
+void hardware::code::Prng::initialize(const hardware::buffers::PRNGBuffer* buffer, cl_uint seed,
+                                      cl_uint deviceIndex) const
 {
     cl_int clerr;
     size_t ls, gs;
@@ -85,16 +97,25 @@ void hardware::code::Prng::initialize(const hardware::buffers::PRNGBuffer* buffe
     this->get_work_sizes(init_kernel, &ls, &gs, &num_groups);
     // we need a custom global size
     gs = buffer->get_elements();
+#    ifdef USE_PRNG_RANLUX
     if (seed > (10e9 / gs)) {  // see ranluxcl source as to why
         /// @todo upgrade to newer ranluxcl to avoid this restcition
         throw Invalid_Parameters("Host seed is too large!", "<< 10e9", (int)kernelParameters->getHostSeed());
     }
+    (void)deviceIndex;
+    const cl_uint bufferArgument = 1;
+#    else   // USE_PRNG_PHILOX
+    clerr = clSetKernelArg(init_kernel, 1, sizeof(cl_uint), &deviceIndex);
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+    const cl_uint bufferArgument = 2;
+#    endif  // USE_PRNG_XXX
     clerr = clSetKernelArg(init_kernel, 0, sizeof(cl_uint), &seed);
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
-    clerr = clSetKernelArg(init_kernel, 1, sizeof(cl_mem), buffer->get_cl_buffer());
+    clerr = clSetKernelArg(init_kernel, bufferArgument, sizeof(cl_mem), buffer->get_cl_buffer());
     if (clerr != CL_SUCCESS)
         throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
     get_device()->enqueue_kernel(init_kernel, gs, ls);
 }
-#endif /* USE_PRNG_RANLUX */
+#endif /* USE_PRNG_XXX */
@@ -52,12 +52,15 @@ namespace hardware {
 
             ClSourcePackage get_sources() const noexcept;
 
-#ifdef USE_PRNG_RANLUX
+#if defined(USE_PRNG_RANLUX) || defined(USE_PRNG_PHILOX)
             /**
              * Initialize the state of the PRNG with the given seed.
+             *
+             * The counter-based generator is to be given the same seed on all devices, which are then told apart by
+             * the index of the device. RANLUX ignores the index, it needs a different seed per device instead.
              */
-            void initialize(const hardware::buffers::PRNGBuffer* buffer, cl_uint seed) const;
-#endif /* USE_PRNG_RANLUX */
+            void initialize(const hardware::buffers::PRNGBuffer* buffer, cl_uint seed, cl_uint deviceIndex = 0) const;
+#endif /* USE_PRNG_XXX */
 
           protected:
             /**
@@ -88,7 +91,7 @@ namespace hardware {
              */
             ClSourcePackage prng_code;
 
-#ifdef USE_PRNG_RANLUX
+#if defined(USE_PRNG_RANLUX) || defined(USE_PRNG_PHILOX)
             cl_kernel init_kernel;
 #endif  // USE_PRNG_???
         };
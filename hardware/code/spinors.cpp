@@ -81,8 +81,13 @@ void hardware::code::Spinors::fill_kernels()
         if (kernelParameters->getUseMergeKernelsSpinor() == true) {
             saxpy_AND_squarenorm_eo = createKernel("saxpy_AND_squarenorm_eo")
                                       << basic_fermion_code << "spinorfield_eo_saxpy_AND_squarenorm.cl";
+            cg_update_x_r_AND_squarenorm_eo = createKernel("cg_update_x_r_AND_squarenorm_eo")
+                                              << basic_fermion_code << "spinorfield_eo_cg_update.cl";
+            cg_update_p_eo = createKernel("cg_update_p_eo") << basic_fermion_code << "spinorfield_eo_cg_update.cl";
         } else {
-            saxpy_AND_squarenorm_eo = 0;
+            saxpy_AND_squarenorm_eo         = 0;
+            cg_update_x_r_AND_squarenorm_eo = 0;
+            cg_update_p_eo                  = 0;
         }
     } else {
         generate_gaussian_spinorfield_eo = 0;
@@ -99,6 +104,8 @@ void hardware::code::Spinors::fill_kernels()
         convertSpinorfieldToSOA_eo       = 0;
         convertSpinorfieldFromSOA_eo     = 0;
         saxpy_AND_squarenorm_eo          = 0;
+        cg_update_x_r_AND_squarenorm_eo  = 0;
+        cg_update_p_eo                   = 0;
     }
     // Always build non eo-prec kernels
     generate_gaussian_spinorfield = createKernel("generate_gaussian_spinorfield")
@@ -111,6 +118,14 @@ void hardware::code::Spinors::fill_kernels()
     scalar_product       = createKernel("scalar_product") << basic_fermion_code << "spinorfield_scalar_product.cl";
     set_zero_spinorfield = createKernel("set_zero_spinorfield") << basic_fermion_code << "spinorfield_set_zero.cl";
     global_squarenorm    = createKernel("global_squarenorm") << basic_fermion_code << "spinorfield_squarenorm.cl";
+
+    // reductions and kernels using random numbers depend on the work sizes and must not be tuned
+    for (const cl_kernel kernel :
+         {set_spinorfield_cold, saxpy, saxpy_arg, sax, saxsbypz, set_zero_spinorfield, convert_from_eoprec,
+          convert_to_eoprec, set_eoprec_spinorfield_cold, saxpy_eoprec, saxpy_arg_eoprec, sax_eoprec,
+          saxsbypz_eoprec, set_zero_spinorfield_eoprec, cg_update_p_eo}) {
+        register_tunable_kernel(kernel);
+    }
 }
 
 void hardware::code::Spinors::clear_kernels()
@@ -171,6 +186,12 @@ void hardware::code::Spinors::clear_kernels()
             clerr = clReleaseKernel(saxpy_AND_squarenorm_eo);
             if (clerr != CL_SUCCESS)
                 throw Opencl_Error(clerr, "clReleaseKernel", __FILE__, __LINE__);
+            clerr = clReleaseKernel(cg_update_x_r_AND_squarenorm_eo);
+            if (clerr != CL_SUCCESS)
+                throw Opencl_Error(clerr, "clReleaseKernel", __FILE__, __LINE__);
+            clerr = clReleaseKernel(cg_update_p_eo);
+            if (clerr != CL_SUCCESS)
+                throw Opencl_Error(clerr, "clReleaseKernel", __FILE__, __LINE__);
         }
     }
     // Always build non eo-prec kernels
@@ -216,7 +237,7 @@ void hardware::code::Spinors::get_work_sizes(const cl_kernel kernel, size_t* ls,
 
     // Query specific sizes for kernels if needed
     if (kernel == scalar_product_eoprec || kernel == scalar_product || kernel == global_squarenorm ||
-        kernel == global_squarenorm_eoprec) {
+        kernel == global_squarenorm_eoprec || kernel == cg_update_x_r_AND_squarenorm_eo) {
         if (*ls > 64) {
             *ls         = 64;
             *num_groups = (*gs) / (*ls);
@@ -915,6 +936,103 @@ void hardware::code::Spinors::saxpy_AND_squarenorm_eo_device(const hardware::buf
     get_device()->enqueue_kernel(_global_squarenorm_reduction, 1, 1);
 }
 
+void hardware::code::Spinors::cg_update_x_r_AND_squarenorm_eo_device(
+    const hardware::buffers::Spinor* x, const hardware::buffers::Spinor* r, const hardware::buffers::Spinor* p,
+    const hardware::buffers::Spinor* v, const hardware::buffers::Plain<hmc_complex>* omega,
+    const hardware::buffers::Plain<hmc_complex>* rho, const hardware::buffers::Plain<hmc_complex>* sq_out) const
+{
+    hmc_complex zero = {0.f, 0.f};
+    sq_out->load(&zero);
+
+    // query work-sizes for kernel
+    size_t ls2, gs2;
+    cl_uint num_groups;
+    this->get_work_sizes(cg_update_x_r_AND_squarenorm_eo, &ls2, &gs2, &num_groups);
+
+    // init local buffer for reduction
+    hardware::buffers::Plain<hmc_float> tmp(num_groups, get_device());
+
+    // set arguments
+    int clerr = clSetKernelArg(cg_update_x_r_AND_squarenorm_eo, 0, sizeof(cl_mem), x->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    clerr = clSetKernelArg(cg_update_x_r_AND_squarenorm_eo, 1, sizeof(cl_mem), r->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    clerr = clSetKernelArg(cg_update_x_r_AND_squarenorm_eo, 2, sizeof(cl_mem), p->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    clerr = clSetKernelArg(cg_update_x_r_AND_squarenorm_eo, 3, sizeof(cl_mem), v->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    clerr = clSetKernelArg(cg_update_x_r_AND_squarenorm_eo, 4, sizeof(cl_mem), omega->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    clerr = clSetKernelArg(cg_update_x_r_AND_squarenorm_eo, 5, sizeof(cl_mem), rho->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    clerr = clSetKernelArg(cg_update_x_r_AND_squarenorm_eo, 6, sizeof(cl_mem), tmp);
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    clerr = clSetKernelArg(cg_update_x_r_AND_squarenorm_eo, 7, sizeof(hmc_float) * ls2, static_cast<void*>(nullptr));
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    get_device()->enqueue_kernel(cg_update_x_r_AND_squarenorm_eo, gs2, ls2);
+
+    clerr = clSetKernelArg(_global_squarenorm_reduction, 0, sizeof(cl_mem), sq_out->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    clerr = clSetKernelArg(_global_squarenorm_reduction, 1, sizeof(cl_mem), tmp);
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    cl_uint elems = tmp.get_elements();
+    clerr         = clSetKernelArg(_global_squarenorm_reduction, 2, sizeof(cl_uint), &elems);
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    get_device()->enqueue_kernel(_global_squarenorm_reduction, 1, 1);
+}
+
+void hardware::code::Spinors::cg_update_p_eo_device(const hardware::buffers::Spinor* p,
+                                                    const hardware::buffers::Spinor* r,
+                                                    const hardware::buffers::Plain<hmc_complex>* rho_next,
+                                                    const hardware::buffers::Plain<hmc_complex>* omega) const
+{
+    // query work-sizes for kernel
+    size_t ls2, gs2;
+    cl_uint num_groups;
+    this->get_work_sizes(cg_update_p_eo, &ls2, &gs2, &num_groups);
+
+    // set arguments
+    int clerr = clSetKernelArg(cg_update_p_eo, 0, sizeof(cl_mem), p->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    clerr = clSetKernelArg(cg_update_p_eo, 1, sizeof(cl_mem), r->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    clerr = clSetKernelArg(cg_update_p_eo, 2, sizeof(cl_mem), rho_next->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    clerr = clSetKernelArg(cg_update_p_eo, 3, sizeof(cl_mem), omega->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    get_device()->enqueue_kernel(cg_update_p_eo, gs2, ls2);
+}
+
 size_t hardware::code::Spinors::get_read_write_size(const std::string& in) const
 {
     // Depending on the compile-options, one has different sizes...
@@ -1032,6 +1150,15 @@ size_t hardware::code::Spinors::get_read_write_size(const std::string& in) const
         /// @NOTE: here, the local reduction is not taken into account
         return C * D * Seo * (12 * (2 + 1) + 2) + D * Seo * (1);
     }
+    if (in == "cg_update_x_r_AND_squarenorm_eo") {
+        // this kernel reads 4 spinors and 2 complex numbers and writes 2 spinors and 1 real number per site
+        /// @NOTE: here, the local reduction is not taken into account
+        return C * D * Seo * (12 * (4 + 2) + 2) + D * Seo * (1);
+    }
+    if (in == "cg_update_p_eo") {
+        // this kernel reads 2 spinors and 2 complex numbers and writes 1 spinor per site
+        return C * D * Seo * (12 * (2 + 1) + 2);
+    }
     return 0;
 }
 
@@ -1126,6 +1253,15 @@ uint64_t hardware::code::Spinors::get_flop_size(const std::string& in) const
         // the squarenorm kernel performs spinor_squarenorm on each site and then adds S-1 complex numbers
         return Seo * (NDIM * NC * (getFlopComplexMult() + 2)) + Seo * getFlopSpinorSquareNorm() + (S - 1) * 2;
     }
+    if (in == "cg_update_x_r_AND_squarenorm_eo") {
+        // this kernel performs two times spinor_times_complex and spinor_add on each site, the squarenorm of the
+        // residuum on each site and then adds S-1 complex numbers (the division giving alpha is neglected)
+        return Seo * (2 * NDIM * NC * (getFlopComplexMult() + 2)) + Seo * getFlopSpinorSquareNorm() + (Seo - 1) * 2;
+    }
+    if (in == "cg_update_p_eo") {
+        // this kernel performs on each site spinor_times_complex and spinor_add
+        return Seo * (NDIM * NC * (getFlopComplexMult() + 2));
+    }
 
     return 0;
 }
@@ -1154,6 +1290,8 @@ void hardware::code::Spinors::print_profiling(const std::string& filename, int n
     Opencl_Module::print_profiling(filename, convertSpinorfieldToSOA_eo);
     Opencl_Module::print_profiling(filename, convertSpinorfieldFromSOA_eo);
     Opencl_Module::print_profiling(filename, saxpy_AND_squarenorm_eo);
+    Opencl_Module::print_profiling(filename, cg_update_x_r_AND_squarenorm_eo);
+    Opencl_Module::print_profiling(filename, cg_update_p_eo);
     Opencl_Module::print_profiling(filename, generate_gaussian_spinorfield);
     Opencl_Module::print_profiling(filename, generate_gaussian_spinorfield_eo);
 }
@@ -115,6 +115,24 @@ namespace hardware {
                                                 const hardware::buffers::Plain<hmc_complex>* alpha,
                                                 const hardware::buffers::Spinor* out,
                                                 const hardware::buffers::Plain<hmc_complex>* sq_out) const;
+            /**
+             * The vector updates of one CG iteration with the squarenorm of the new residuum,
+             * x = x + alpha*p and r = r - alpha*v with alpha = omega/rho calculated on the device.
+             */
+            void cg_update_x_r_AND_squarenorm_eo_device(const hardware::buffers::Spinor* x,
+                                                        const hardware::buffers::Spinor* r,
+                                                        const hardware::buffers::Spinor* p,
+                                                        const hardware::buffers::Spinor* v,
+                                                        const hardware::buffers::Plain<hmc_complex>* omega,
+                                                        const hardware::buffers::Plain<hmc_complex>* rho,
+                                                        const hardware::buffers::Plain<hmc_complex>* sq_out) const;
+            /**
+             * The update of the search direction of one CG iteration,
+             * p = r + beta*p with beta = rho_next/omega calculated on the device.
+             */
+            void cg_update_p_eo_device(const hardware::buffers::Spinor* p, const hardware::buffers::Spinor* r,
+                                       const hardware::buffers::Plain<hmc_complex>* rho_next,
+                                       const hardware::buffers::Plain<hmc_complex>* omega) const;
 
             /**
              * Copy an even-odd preconditioned spinorfield to the given buffer.
@@ -216,6 +234,8 @@ namespace hardware {
 
             // merged kernels
             cl_kernel saxpy_AND_squarenorm_eo;
+            cl_kernel cg_update_x_r_AND_squarenorm_eo;
+            cl_kernel cg_update_p_eo;
 
             /**
              * @todo usage of this buffer is dangerous and should probably be semaphored
@@ -120,3 +120,150 @@ BOOST_AUTO_TEST_SUITE(SF_SAXPY_AND_SQUARENORM_EO)
         testSaxpyAndSquarenormEvenOdd(LatticeExtents{ns4, nt4}, hmc_complex{-1., -1.});
     }
 BOOST_AUTO_TEST_SUITE_END()
+
+static hmc_complex divideComplexNumbers(const hmc_complex numerator, const hmc_complex denominator)
+{
+    const hmc_float norm = denominator.re * denominator.re + denominator.im * denominator.im;
+    return hmc_complex{(numerator.re * denominator.re + numerator.im * denominator.im) / norm,
+                       (numerator.im * denominator.re - numerator.re * denominator.im) / norm};
+}
+
+const ReferenceValues calculateReferenceValues_cgUpdateXREvenOdd(const int latticeVolume, const hmc_complex omega,
+                                                                  const hmc_complex rho)
+{
+    // all fields are equal initially, hence r = (1 - alpha) * in and x = (1 + alpha) * in
+    const hmc_complex alpha = divideComplexNumbers(omega, rho);
+    return ReferenceValues{((1. - alpha.re) * (1. - alpha.re) + alpha.im * alpha.im) * latticeVolume *
+                               sumOfIntegersSquared(24),
+                           ((1. + alpha.re) * (1. + alpha.re) + alpha.im * alpha.im) * latticeVolume *
+                               sumOfIntegersSquared(24)};
+}
+
+const ReferenceValues calculateReferenceValues_cgUpdatePEvenOdd(const int latticeVolume, const hmc_complex rhoNext,
+                                                                 const hmc_complex omega)
+{
+    // p and r are equal initially, hence p = (1 + beta) * in
+    const hmc_complex beta = divideComplexNumbers(rhoNext, omega);
+    return ReferenceValues{((1. + beta.re) * (1. + beta.re) + beta.im * beta.im) * latticeVolume *
+                           sumOfIntegersSquared(24)};
+}
+
+struct CgUpdateEvenOddTestParameters : public SpinorTestParameters {
+    CgUpdateEvenOddTestParameters(const LatticeExtents lE, const hmc_complex numeratorIn,
+                                  const hmc_complex denominatorIn)
+        : TestParameters(lE)
+        , SpinorTestParameters(lE, SpinorFillTypes{SpinorFillType::ascendingComplex})
+        , numerator(numeratorIn)
+        , denominator(denominatorIn){};
+    const hmc_complex numerator;
+    const hmc_complex denominator;
+};
+
+struct CgUpdateXREvenOddTester : public EvenOddSpinorTester {
+    CgUpdateXREvenOddTester(const ParameterCollection& pC, const CgUpdateEvenOddTestParameters& tP)
+        : EvenOddSpinorTester("cg_update_x_r_AND_squarenorm_eo", pC, tP,
+                              calculateReferenceValues_cgUpdateXREvenOdd(calculateEvenOddSpinorfieldSize(
+                                                                             tP.latticeExtents),
+                                                                         tP.numerator, tP.denominator))
+    {
+        const hardware::buffers::Spinor x(tP.latticeExtents, device);
+        const hardware::buffers::Spinor r(tP.latticeExtents, device);
+        const hardware::buffers::Spinor p(tP.latticeExtents, device);
+        const hardware::buffers::Spinor v(tP.latticeExtents, device);
+        const hardware::buffers::Plain<hmc_complex> omega(1, device);
+        const hardware::buffers::Plain<hmc_complex> rho(1, device);
+        const hardware::buffers::Plain<hmc_complex> sqnorm(1, device);
+        const hardware::buffers::Plain<hmc_float> sqnormX(1, device);
+
+        EvenOddSpinorfieldCreator sf(tP.latticeExtents);
+        for (auto buffer : {&x, &r, &p, &v}) {
+            buffer->load(sf.createSpinorfield(tP.fillTypes.at(0)));
+        }
+        omega.load(&tP.numerator);
+        rho.load(&tP.denominator);
+
+        code->cg_update_x_r_AND_squarenorm_eo_device(&x, &r, &p, &v, &omega, &rho, &sqnorm);
+        code->set_float_to_global_squarenorm_eoprec_device(&x, &sqnormX);
+
+        hmc_complex cpu_res = {0., 0.};
+        sqnorm.dump(&cpu_res);
+        kernelResult[0] = cpu_res.re;
+        sqnormX.dump(&kernelResult[1]);
+    }
+};
+
+struct CgUpdatePEvenOddTester : public EvenOddSpinorTester {
+    CgUpdatePEvenOddTester(const ParameterCollection& pC, const CgUpdateEvenOddTestParameters& tP)
+        : EvenOddSpinorTester("cg_update_p_eo", pC, tP,
+                              calculateReferenceValues_cgUpdatePEvenOdd(calculateEvenOddSpinorfieldSize(
+                                                                            tP.latticeExtents),
+                                                                        tP.numerator, tP.denominator))
+    {
+        const hardware::buffers::Spinor p(tP.latticeExtents, device);
+        const hardware::buffers::Spinor r(tP.latticeExtents, device);
+        const hardware::buffers::Plain<hmc_complex> rhoNext(1, device);
+        const hardware::buffers::Plain<hmc_complex> omega(1, device);
+
+        EvenOddSpinorfieldCreator sf(tP.latticeExtents);
+        p.load(sf.createSpinorfield(tP.fillTypes.at(0)));
+        r.load(sf.createSpinorfield(tP.fillTypes.at(0)));
+        rhoNext.load(&tP.numerator);
+        omega.load(&tP.denominator);
+
+        code->cg_update_p_eo_device(&p, &r, &rhoNext, &omega);
+        calcSquarenormEvenOddAndStoreAsKernelResult(&p);
+    }
+};
+
+template<typename Tester>
+void testCgUpdateEvenOdd(const LatticeExtents lE, const hmc_complex numerator, const hmc_complex denominator)
+{
+    CgUpdateEvenOddTestParameters parametersForThisTest{lE, numerator, denominator};
+    hardware::HardwareParametersMockup hardwareParameters(parametersForThisTest.ns, parametersForThisTest.nt, true);
+    hardware::code::OpenClKernelParametersMockupForMergedSpinorKernels kernelParameters(parametersForThisTest.ns,
+                                                                                        parametersForThisTest.nt);
+    ParameterCollection parameterCollection{hardwareParameters, kernelParameters};
+    Tester(parameterCollection, parametersForThisTest);
+}
+
+BOOST_AUTO_TEST_SUITE(SF_CG_UPDATE_X_R_AND_SQUARENORM_EO)
+
+    BOOST_AUTO_TEST_CASE(SF_CG_UPDATE_X_R_AND_SQUARENORM_EO_1)
+    {
+        testCgUpdateEvenOdd<CgUpdateXREvenOddTester>(LatticeExtents{ns4, nt4}, hmc_complex{0., 0.},
+                                                     hmc_complex{1., 0.});
+    }
+
+    BOOST_AUTO_TEST_CASE(SF_CG_UPDATE_X_R_AND_SQUARENORM_EO_2)
+    {
+        testCgUpdateEvenOdd<CgUpdateXREvenOddTester>(LatticeExtents{ns4, nt4}, hmc_complex{1., 0.},
+                                                     hmc_complex{2., 0.});
+    }
+
+    BOOST_AUTO_TEST_CASE(SF_CG_UPDATE_X_R_AND_SQUARENORM_EO_3)
+    {
+        testCgUpdateEvenOdd<CgUpdateXREvenOddTester>(LatticeExtents{ns4, nt4}, hmc_complex{1., -1.},
+                                                     hmc_complex{0.5, 1.});
+    }
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(SF_CG_UPDATE_P_EO)
+
+    BOOST_AUTO_TEST_CASE(SF_CG_UPDATE_P_EO_1)
+    {
+        testCgUpdateEvenOdd<CgUpdatePEvenOddTester>(LatticeExtents{ns4, nt4}, hmc_complex{0., 0.},
+                                                    hmc_complex{1., 0.});
+    }
+
+    BOOST_AUTO_TEST_CASE(SF_CG_UPDATE_P_EO_2)
+    {
+        testCgUpdateEvenOdd<CgUpdatePEvenOddTester>(LatticeExtents{ns4, nt4}, hmc_complex{1., 0.},
+                                                    hmc_complex{2., 0.});
+    }
+
+    BOOST_AUTO_TEST_CASE(SF_CG_UPDATE_P_EO_3)
+    {
+        testCgUpdateEvenOdd<CgUpdatePEvenOddTester>(LatticeExtents{ns4, nt4}, hmc_complex{1., -1.},
+                                                    hmc_complex{0.5, 1.});
+    }
+BOOST_AUTO_TEST_SUITE_END()
@@ -35,6 +35,8 @@
 
 using namespace std;
 
+constexpr size_t hardware::code::Spinors_staggered::UPDATE_X_AND_PS_CGM_MAX_SHIFTS;
+
 void hardware::code::Spinors_staggered::fill_kernels()
 {
     if (kernelParameters->getFermact() != common::action::rooted_stagg) {
@@ -151,6 +153,8 @@ void hardware::code::Spinors_staggered::fill_kernels()
         sax_vectorized_and_squarenorm_eoprec = createKernel("sax_vectorized_and_squarenorm_eoprec")
                                                << basic_fermion_code
                                                << "spinorfield_staggered_eo_sax_AND_squarenorm.cl";
+        update_x_and_ps_cgm_eoprec = createKernel("update_x_and_ps_cgm_eoprec")
+                                     << basic_fermion_code << "spinorfield_staggered_eo_update_x_and_ps_cgm.cl";
     } else {
         convert_from_eoprec_stagg               = 0;
         convert_to_eoprec_stagg                 = 0;
@@ -181,6 +185,7 @@ void hardware::code::Spinors_staggered::fill_kernels()
         set_gaussian_spinorfield_stagg_eoprec   = 0;
         sax_vectorized_and_squarenorm_reduction = 0;
         sax_vectorized_and_squarenorm_eoprec    = 0;
+        update_x_and_ps_cgm_eoprec              = 0;
         // Scalar Product
         scalar_product_stagg = createKernel("scalar_product_staggered")
                                << basic_fermion_code << "spinorfield_staggered_scalar_product.cl";
@@ -315,6 +320,9 @@ void hardware::code::Spinors_staggered::clear_kernels()
         clerr = clReleaseKernel(sax_vectorized_and_squarenorm_eoprec);
         if (clerr != CL_SUCCESS)
             throw Opencl_Error(clerr, "clReleaseKernel", __FILE__, __LINE__);
+        clerr = clReleaseKernel(update_x_and_ps_cgm_eoprec);
+        if (clerr != CL_SUCCESS)
+            throw Opencl_Error(clerr, "clReleaseKernel", __FILE__, __LINE__);
     } else {
         // Scalar Product
         clerr = clReleaseKernel(scalar_product_stagg);
@@ -1578,6 +1586,68 @@ void hardware::code::Spinors_staggered::sax_vectorized_and_squarenorm_eoprec_dev
     sax_vectorized_squarenorm_reduction(out, &tmp, numeqs);
 }
 
+void hardware::code::Spinors_staggered::update_x_and_ps_cgm_eoprec_device(
+    const std::vector<const hardware::buffers::SU3vec*>& x, const std::vector<const hardware::buffers::SU3vec*>& ps,
+    const std::vector<int>& shift_indices, const hardware::buffers::SU3vec* r,
+    const hardware::buffers::Plain<hmc_float>* beta, const hardware::buffers::Plain<hmc_float>* zeta,
+    const hardware::buffers::Plain<hmc_float>* alpha) const
+{
+    if (x.size() != ps.size() || x.size() != shift_indices.size() || x.empty() ||
+        x.size() > UPDATE_X_AND_PS_CGM_MAX_SHIFTS) {
+        throw std::invalid_argument("Invalid number of buffers passed to update_x_and_ps_cgm_eoprec");
+    }
+
+    cl_int num_shifts = x.size();
+    // query work-sizes for kernel
+    size_t ls2, gs2;
+    cl_uint num_groups;
+    this->get_work_sizes(update_x_and_ps_cgm_eoprec, &ls2, &gs2, &num_groups);
+    // set arguments
+    int clerr = clSetKernelArg(update_x_and_ps_cgm_eoprec, 0, sizeof(cl_mem), r->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    clerr = clSetKernelArg(update_x_and_ps_cgm_eoprec, 1, sizeof(cl_mem), beta->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    clerr = clSetKernelArg(update_x_and_ps_cgm_eoprec, 2, sizeof(cl_mem), zeta->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    clerr = clSetKernelArg(update_x_and_ps_cgm_eoprec, 3, sizeof(cl_mem), alpha->get_cl_buffer());
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    // unused slots are filled with the first shift, the kernel does not touch them
+    const cl_uint first_field_arg = 4;
+    for (size_t i = 0; i < UPDATE_X_AND_PS_CGM_MAX_SHIFTS; ++i) {
+        const size_t shift = (i < x.size()) ? i : 0;
+        clerr              = clSetKernelArg(update_x_and_ps_cgm_eoprec, first_field_arg + i, sizeof(cl_mem),
+                                            x[shift]->get_cl_buffer());
+        if (clerr != CL_SUCCESS)
+            throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+        clerr = clSetKernelArg(update_x_and_ps_cgm_eoprec, first_field_arg + UPDATE_X_AND_PS_CGM_MAX_SHIFTS + i,
+                               sizeof(cl_mem), ps[shift]->get_cl_buffer());
+        if (clerr != CL_SUCCESS)
+            throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+        const cl_uint index_arg = first_field_arg + 2 * UPDATE_X_AND_PS_CGM_MAX_SHIFTS + i;
+        const cl_int index      = shift_indices[shift];
+        clerr                   = clSetKernelArg(update_x_and_ps_cgm_eoprec, index_arg, sizeof(cl_int), &index);
+        if (clerr != CL_SUCCESS)
+            throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+    }
+
+    clerr = clSetKernelArg(update_x_and_ps_cgm_eoprec, first_field_arg + 3 * UPDATE_X_AND_PS_CGM_MAX_SHIFTS,
+                           sizeof(cl_int), &num_shifts);
+    if (clerr != CL_SUCCESS)
+        throw Opencl_Error(clerr, "clSetKernelArg", __FILE__, __LINE__);
+
+    get_device()->enqueue_kernel(update_x_and_ps_cgm_eoprec, gs2, ls2);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -1726,6 +1796,11 @@ size_t hardware::code::Spinors_staggered::get_read_write_size(const std::string&
         // this kernel writes 1 su3vec
         return NC * C * D * Seo;
     }
+    if (in == "update_x_and_ps_cgm_eoprec") {
+        // per shift this kernel reads 3 su3vec, 3 real numbers and writes 2 su3vec per site (eo),
+        // the field r is read only once for all shifts, but here it is counted for each shift
+        return D * Seo * (C * NC * (3 + 2) + 3);
+    }
     if (in == "sax_vectorized_and_squarenorm_eoprec" || in == "sax_vectorized_and_squarenorm_reduction") {
         // This if should not be entered since here we do not have the number of eqs.
         // The calculation of bytes should be done in the cgm or wherever the kernel is used
@@ -1868,6 +1943,10 @@ uint64_t hardware::code::Spinors_staggered::get_flop_size(const std::string& in)
         ///@todo I did not count the gaussian normal pair production, which is very complicated...
         return NC * Seo;
     }
+    if (in == "update_x_and_ps_cgm_eoprec") {
+        // per shift this kernel performs on each site (eo) 3*su3vec_times_real and 2*su3vec_acc
+        return Seo * (NC * (6 + 4));
+    }
     if (in == "sax_vectorized_and_squarenorm_eoprec" || in == "sax_vectorized_and_squarenorm_reduction") {
         // This if should not be entered since here we do not have the number of eqs.
         // The calculation of flops should be done in the cgm or wherever the kernel is used
@@ -1920,6 +1999,7 @@ void hardware::code::Spinors_staggered::print_profiling(const std::string& filen
     Opencl_Module::print_profiling(filename, sax_real_vec_stagg_eoprec);
     Opencl_Module::print_profiling(filename, saxpy_real_vec_stagg_eoprec);
     Opencl_Module::print_profiling(filename, saxpby_real_vec_stagg_eoprec);
+    Opencl_Module::print_profiling(filename, update_x_and_ps_cgm_eoprec);
     // Opencl_Module::print_profiling(filename, sax_vectorized_and_squarenorm_eoprec);
     // Opencl_Module::print_profiling(filename, sax_vectorized_and_squarenorm_reduction);
 }
@@ -317,6 +317,32 @@ namespace hardware {
                                                      const hardware::buffers::Plain<hmc_float>* tmp_buf,
                                                      const int numeqs) const;
 
+            /**
+             * Maximal number of shifts which can be passed to update_x_and_ps_cgm_eoprec_device at once.
+             */
+            static constexpr size_t UPDATE_X_AND_PS_CGM_MAX_SHIFTS = 8;
+            /**
+             * This function performs the update of the solutions and of the auxiliary fields of the CG-M
+             * for several shifted systems in one kernel call, i.e. for each k
+             *     x[k]  = x[k] + beta[shift_indices[k]]*ps[k]
+             *     ps[k] = zeta[shift_indices[k]]*r + alpha[shift_indices[k]]*ps[k]
+             * The results agree bit by bit with the ones of the corresponding saxpy and saxpby calls.
+             * @param x The solution staggered fields (at most UPDATE_X_AND_PS_CGM_MAX_SHIFTS)
+             * @param ps The auxiliary staggered fields, one for each solution field
+             * @param shift_indices The indices of the shifts in the vectors of constants
+             * @param r The residuum staggered field
+             * @param beta The vector of constants beta of all shifts
+             * @param zeta The vector of constants zeta of all shifts
+             * @param alpha The vector of constants alpha of all shifts
+             */
+            void update_x_and_ps_cgm_eoprec_device(const std::vector<const hardware::buffers::SU3vec*>& x,
+                                                   const std::vector<const hardware::buffers::SU3vec*>& ps,
+                                                   const std::vector<int>& shift_indices,
+                                                   const hardware::buffers::SU3vec* r,
+                                                   const hardware::buffers::Plain<hmc_float>* beta,
+                                                   const hardware::buffers::Plain<hmc_float>* zeta,
+                                                   const hardware::buffers::Plain<hmc_float>* alpha) const;
+
             //////////////////////////////////
             //      Setting operations      //
             //////////////////////////////////
@@ -526,6 +552,7 @@ namespace hardware {
             // Mixed kernels
             cl_kernel sax_vectorized_and_squarenorm_eoprec;
             cl_kernel sax_vectorized_and_squarenorm_reduction;
+            cl_kernel update_x_and_ps_cgm_eoprec;
 
             /******************************************************/
             /****************  GENERAL KERNELS  *******************/
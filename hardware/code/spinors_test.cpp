@@ -117,6 +117,12 @@ struct LinearCombinationTestParameters : public SpinorTestParameters {
         , SpinorTestParameters(lE, sF)
         , complexCoefficients(cN)
         , numberOfSpinors(numberOfSpinorsIn){};
+    LinearCombinationTestParameters(const LatticeExtents lE, const SpinorFillTypes sF, const ComplexNumbers cN,
+                                    const size_t numberOfSpinorsIn, const double testPrecisionIn)
+        : TestParameters(lE, testPrecisionIn)
+        , SpinorTestParameters(lE, sF)
+        , complexCoefficients(cN)
+        , numberOfSpinors(numberOfSpinorsIn){};
     const ComplexNumbers complexCoefficients;
     const NumberOfSpinors numberOfSpinors;
 };
@@ -179,6 +185,22 @@ void performTest(LatticeExtents latticeExtendsIn)
     TesterClass(parameterCollection, parametersForThisTest);
 }
 
+/*
+ * On devices using the SOA layout the spinorfields are stored in single precision, such that every stored component
+ * is rounded and the results can only be compared within single precision accuracy (the tolerance is in percent).
+ */
+template<typename TesterClass>
+void performTestWithSinglePrecisionFermionStorage(const LatticeExtents latticeExtendsIn, const SpinorFillTypes sF,
+                                                  const ComplexNumbers alphaIn, const int numberOfSpinors)
+{
+    LinearCombinationTestParameters parametersForThisTest(latticeExtendsIn, sF, alphaIn, numberOfSpinors, 1.e-4);
+    hardware::HardwareParametersMockup hardwareParameters(latticeExtendsIn, true);
+    hardware::code::OpenClKernelParametersMockupForSinglePrecisionFermionStorage kernelParameters(latticeExtendsIn,
+                                                                                                  true);
+    ParameterCollection parameterCollection{hardwareParameters, kernelParameters};
+    TesterClass(parameterCollection, parametersForThisTest);
+}
+
 template<typename TesterClass, typename ParametersClass>
 void performTest(const LatticeExtents latticeExtendsIn, const int iterations, const bool needEvenOdd)
 {
@@ -625,6 +647,23 @@ void testEvenOddSaxpyArg(const LatticeExtents lE, const ComplexNumbers cN)
     performTest<SaxpyArgEvenOddTester>(lE, cN, 3, true);
 }
 
+void testEvenOddSquarenormWithSinglePrecisionStorage(const LatticeExtents lE, const SpinorFillTypes sF)
+{
+    performTestWithSinglePrecisionFermionStorage<SquarenormEvenOddTester>(lE, sF, ComplexNumbers{{1., 0.}}, 1);
+}
+
+void testEvenOddSaxpyWithSinglePrecisionStorage(const LatticeExtents lE, const ComplexNumbers cN)
+{
+    performTestWithSinglePrecisionFermionStorage<SaxpyEvenOddTester>(
+        lE, SpinorFillTypes{SpinorFillType::ascendingComplex}, cN, 3);
+}
+
+void testEvenOddSaxpyArgWithSinglePrecisionStorage(const LatticeExtents lE, const ComplexNumbers cN)
+{
+    performTestWithSinglePrecisionFermionStorage<SaxpyArgEvenOddTester>(
+        lE, SpinorFillTypes{SpinorFillType::ascendingComplex}, cN, 3);
+}
+
 void testNonEvenOddGaussianSpinorfield(const LatticeExtents lE, const int iterations)
 {
     performTest<NonEvenGaussianSpinorfieldTester, PrngSpinorTestParameters>(lE, iterations, false);
@@ -914,6 +953,33 @@ BOOST_AUTO_TEST_SUITE(SAXPY_EO)
 
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(SINGLE_PRECISION_STORAGE)
+
+    BOOST_AUTO_TEST_CASE(SQUARENORM_EO_SP_1)
+    {
+        testEvenOddSquarenormWithSinglePrecisionStorage(LatticeExtents{ns4, nt4},
+                                                        SpinorFillTypes{SpinorFillType::ascendingComplex});
+    }
+
+    BOOST_AUTO_TEST_CASE(SQUARENORM_EO_SP_2)
+    {
+        testEvenOddSquarenormWithSinglePrecisionStorage(LatticeExtents{ns8, nt12},
+                                                        SpinorFillTypes{SpinorFillType::one});
+    }
+
+    BOOST_AUTO_TEST_CASE(SAXPY_EO_SP_1)
+    {
+        testEvenOddSaxpyWithSinglePrecisionStorage(LatticeExtents{ns4, nt4}, ComplexNumbers{{nonTrivialParameter, 0.}});
+    }
+
+    BOOST_AUTO_TEST_CASE(SAXPY_EO_SP_2)
+    {
+        testEvenOddSaxpyArgWithSinglePrecisionStorage(LatticeExtents{ns8, nt8},
+                                                      ComplexNumbers{{nonTrivialParameter, -nonTrivialParameter}});
+    }
+
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE(SAXSBYPZ)
 
     BOOST_AUTO_TEST_CASE(SAXSBYPZ_1)
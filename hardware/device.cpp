@@ -25,6 +25,7 @@
 #include "device.hpp"
 
 #include "../host_functionality/logger.hpp"
+#include "../klepsydra/klepsydra.hpp"
 #include "openClCode.hpp"
 #include "system.hpp"
 
@@ -33,12 +34,14 @@ static bool retrieve_device_availability(cl_device_id device_id);
 // todo: lattice_grid_extent should not be a member of this class, but of system
 hardware::Device::Device(cl_context context, cl_device_id device_id, LatticeGridIndex lI, LatticeGrid lG,
                          const hardware::OpenClCode& builderIn,
-                         const hardware::HardwareParametersInterface& parametersIn)
+                         const hardware::HardwareParametersInterface& parametersIn, hardware::Tracer* const tracerIn)
     : DeviceInfo(device_id)
     , openClCodeBuilder(&builderIn)
     , hardwareParameters(&parametersIn)
     , context(context)
     , profiling_data()
+    , kernelTuner(parametersIn.useKernelAutotuning() ? new KernelTuner(*this) : nullptr)
+    , tracer(tracerIn)
     , gaugefield_code(nullptr)
     , prng_code(nullptr)
     , real_code(nullptr)
@@ -76,11 +79,15 @@ hardware::Device::Device(cl_context context, cl_device_id device_id, LatticeGrid
 
     cl_int err;
     logger.debug() << context << ' ' << device_id;
-    command_queue = clCreateCommandQueue(context, device_id,
-                                         hardwareParameters->enableProfiling() ? CL_QUEUE_PROFILING_ENABLE : 0, &err);
+    // the tracer relies on the profiling information of the events as well
+    const bool profileQueue = hardwareParameters->enableProfiling() || tracer;
+    command_queue = clCreateCommandQueue(context, device_id, profileQueue ? CL_QUEUE_PROFILING_ENABLE : 0, &err);
     if (err) {
         throw OpenclException(err, "clCreateCommandQueue", __FILE__, __LINE__);
     }
+    if (tracer) {
+        tracer->setDeviceName(latticeGridIndex.globalIndex, get_name());
+    }
 
     logger.trace() << "Initial memory usage (" << latticeGridIndex.x << "," << latticeGridIndex.y << ","
                    << latticeGridIndex.z << "," << latticeGridIndex.t << "): " << allocated_bytes
@@ -182,7 +189,7 @@ void hardware::Device::enqueue_kernel(cl_kernel kernel, size_t global_threads, s
     cl_event profiling_event;
     // we only want to pass the event if we are actually profiling
     // otherwise the API will write back data into a no longer valid object
-    cl_event* const profiling_event_p = hardwareParameters->enableProfiling() ? &profiling_event : 0;
+    cl_event* const profiling_event_p = (hardwareParameters->enableProfiling() || tracer) ? &profiling_event : 0;
 
     if (logger.beDebug()) {
         logger.trace() << "calling clEnqueueNDRangeKernel...";
@@ -203,6 +210,14 @@ void hardware::Device::enqueue_kernel(cl_kernel kernel, size_t global_threads, s
         }
     }
 
+    // time the kernel on its own if it is run with work sizes which are currently being tuned
+    const bool tuning = kernelTuner && kernelTuner->isMeasuring(kernel, global_threads, local_threads);
+    if (tuning) {
+        synchronize();
+    }
+    klepsydra::Monotonic timer;
+    const uint64_t enqueueTime = tracer ? tracer->getTime() : 0;
+
     // queue kernel
     cl_int clerr = clEnqueueNDRangeKernel(command_queue, kernel, 1, 0, &global_threads, &local_threads, 0, 0,
                                           profiling_event_p);
@@ -240,6 +255,23 @@ void hardware::Device::enqueue_kernel(cl_kernel kernel, size_t global_threads, s
 
         profiling_data[kernel].add(profiling_event);
     }
+    if (tracer) {
+        tracer->addKernel(latticeGridIndex.globalIndex, kernel, SynchronizationEvent(profiling_event), global_threads,
+                          local_threads, enqueueTime);
+        clReleaseEvent(profiling_event);
+    }
+
+    if (tuning) {
+        synchronize();
+        kernelTuner->addMeasurement(kernel, global_threads, local_threads, timer.getTime());
+    }
+}
+
+void hardware::Device::getTunedWorkSizes(const cl_kernel kernel, size_t* localThreads, size_t* globalThreads) const
+{
+    if (kernelTuner) {
+        kernelTuner->getWorkSizes(kernel, localThreads, globalThreads);
+    }
 }
 
 void hardware::Device::enqueueMarker(cl_event* event) const
@@ -338,6 +370,19 @@ bool hardware::Device::isProfilingEnabled() const noexcept
     return hardwareParameters->enableProfiling();
 }
 
+size_t hardware::Device::getNumberOfStoredLinkElements() const
+{
+    // AOS buffers always hold full Matrixsu3 structs, compression is only applied to SOA storage
+    return get_prefers_soa() ? openClCodeBuilder->getKernelParameters().getMatSize() : NC * NC;
+}
+
+bool hardware::Device::usesSinglePrecisionFermionStorage() const
+{
+    const auto& kernelParameters = openClCodeBuilder->getKernelParameters();
+    return get_prefers_soa() && kernelParameters.getPrecision() == 64 &&
+           kernelParameters.getUseSinglePrecFermionStorage();
+}
+
 void hardware::Device::flush() const
 {
     cl_int err = clFlush(command_queue);
@@ -361,136 +406,136 @@ hardware::ProfilingData hardware::Device::getProfilingData(const cl_kernel& kern
 
 const hardware::code::Gaugefield* hardware::Device::getGaugefieldCode() const
 {
-    if (!gaugefield_code) {
+    std::call_once(gaugefield_code_created, [this]() {
         // todo: do not use release here. real_code itself should rather be a smart pointer
         gaugefield_code = openClCodeBuilder->getCode_gaugefield(this).release();
-    }
+    });
     return gaugefield_code;
 }
 
 const hardware::code::Prng* hardware::Device::getPrngCode() const
 {
-    if (!prng_code) {
+    std::call_once(prng_code_created, [this]() {
         // todo: do not use release here. real_code itself should rather be a smart pointer
         prng_code = openClCodeBuilder->getCode_PRNG(this).release();
-    }
+    });
     return prng_code;
 }
 
 const hardware::code::Real* hardware::Device::getRealCode() const
 {
-    if (!real_code) {
+    std::call_once(real_code_created, [this]() {
         // todo: do not use release here. real_code itself should rather be a smart pointer
         real_code = openClCodeBuilder->getCode_real(this).release();
-    }
+    });
     return real_code;
 }
 
 const hardware::code::Complex* hardware::Device::getComplexCode() const
 {
-    if (!complex_code) {
+    std::call_once(complex_code_created, [this]() {
         // todo: do not use release here. real_code itself should rather be a smart pointer
         complex_code = openClCodeBuilder->getCode_complex(this).release();
-    }
+    });
     return complex_code;
 }
 
 const hardware::code::Spinors* hardware::Device::getSpinorCode() const
 {
-    if (!spinor_code) {
+    std::call_once(spinor_code_created, [this]() {
         // todo: do not use release here. real_code itself should rather be a smart pointer
         spinor_code = openClCodeBuilder->getCode_Spinors(this).release();
-    }
+    });
     return spinor_code;
 }
 
 const hardware::code::Spinors_staggered* hardware::Device::getSpinorStaggeredCode() const
 {
-    if (!spinor_staggered_code) {
+    std::call_once(spinor_staggered_code_created, [this]() {
         // todo: do not use release here. real_code itself should rather be a smart pointer
         spinor_staggered_code = openClCodeBuilder->getCode_Spinors_staggered(this).release();
-    }
+    });
     return spinor_staggered_code;
 }
 
 const hardware::code::Fermions* hardware::Device::getFermionCode() const
 {
-    if (!fermion_code) {
+    std::call_once(fermion_code_created, [this]() {
         // todo: do not use release here. real_code itself should rather be a smart pointer
         fermion_code = openClCodeBuilder->getCode_Fermions(this).release();
-    }
+    });
     return fermion_code;
 }
 
 const hardware::code::Fermions_staggered* hardware::Device::getFermionStaggeredCode() const
 {
-    if (!fermion_staggered_code) {
+    std::call_once(fermion_staggered_code_created, [this]() {
         // todo: do not use release here. real_code itself should rather be a smart pointer
         fermion_staggered_code = openClCodeBuilder->getCode_Fermions_staggered(this).release();
-    }
+    });
     return fermion_staggered_code;
 }
 
 const hardware::code::Gaugemomentum* hardware::Device::getGaugemomentumCode() const
 {
-    if (!gaugemomentum_code) {
+    std::call_once(gaugemomentum_code_created, [this]() {
         // todo: do not use release here. real_code itself should rather be a smart pointer
         gaugemomentum_code = openClCodeBuilder->getCode_Gaugemomentum(this).release();
-    }
+    });
     return gaugemomentum_code;
 }
 
 const hardware::code::Molecular_Dynamics* hardware::Device::getMolecularDynamicsCode() const
 {
-    if (!molecular_dynamics_code) {
+    std::call_once(molecular_dynamics_code_created, [this]() {
         // todo: do not use release here. real_code itself should rather be a smart pointer
         molecular_dynamics_code = openClCodeBuilder->getCode_Molecular_Dynamics(this).release();
-    }
+    });
     return molecular_dynamics_code;
 }
 
 const hardware::code::Correlator* hardware::Device::getCorrelatorCode() const
 {
-    if (!correlator_code) {
+    std::call_once(correlator_code_created, [this]() {
         // todo: do not use release here. real_code itself should rather be a smart pointer
         correlator_code = openClCodeBuilder->getCode_Correlator(this).release();
-    }
+    });
     return correlator_code;
 }
 
 const hardware::code::Correlator_staggered* hardware::Device::getCorrelatorStaggeredCode() const
 {
-    if (!correlator_staggered_code) {
+    std::call_once(correlator_staggered_code_created, [this]() {
         // todo: do not use release here. real_code itself should rather be a smart pointer
         correlator_staggered_code = openClCodeBuilder->getCode_Correlator_staggered(this).release();
-    }
+    });
     return correlator_staggered_code;
 }
 
 const hardware::code::Heatbath* hardware::Device::getHeatbathCode() const
 {
-    if (!heatbath_code) {
+    std::call_once(heatbath_code_created, [this]() {
         // todo: do not use release here. real_code itself should rather be a smart pointer
         heatbath_code = openClCodeBuilder->getCode_Heatbath(this).release();
-    }
+    });
     return heatbath_code;
 }
 
 const hardware::code::Kappa* hardware::Device::getKappaCode() const
 {
-    if (!kappa_code) {
+    std::call_once(kappa_code_created, [this]() {
         // todo: do not use release here. real_code itself should rather be a smart pointer
         kappa_code = openClCodeBuilder->getCode_Kappa(this).release();
-    }
+    });
     return kappa_code;
 }
 
 const hardware::code::Buffer* hardware::Device::getBufferCode() const
 {
-    if (!buffer_code) {
+    std::call_once(buffer_code_created, [this]() {
         // todo: do not use release here. real_code itself should rather be a smart pointer
         buffer_code = openClCodeBuilder->getCode_Buffer(this).release();
-    }
+    });
     return buffer_code;
 }
 
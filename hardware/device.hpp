@@ -29,11 +29,15 @@
 #include "../geometry/latticeGrid.hpp"
 #include "device_info.hpp"
 #include "hardwareParameters.hpp"
+#include "kernel_tuner.hpp"
 #include "opencl_compiler.hpp"
 #include "profiling_data.hpp"
 #include "size_4.hpp"
+#include "tracer.hpp"
 
 #include <map>
+#include <memory>
+#include <mutex>
 
 class MemObjectAllocationTracer;
 
@@ -105,7 +109,7 @@ namespace hardware {
          * Initialize an OpenCL device.
          */
         Device(cl_context, cl_device_id, LatticeGridIndex lI, LatticeGrid lG, const hardware::OpenClCode& builderIn,
-               const hardware::HardwareParametersInterface& parametersIn);
+               const hardware::HardwareParametersInterface& parametersIn, hardware::Tracer* tracerIn = nullptr);
 
         ~Device();
 
@@ -139,6 +143,12 @@ namespace hardware {
          */
         void enqueue_kernel(const cl_kernel kernel, size_t globalThreads, size_t localThreads) const;
 
+        /**
+         * Replace the given work sizes by the tuned ones for the given kernel if kernel autotuning is enabled.
+         * The kernel must not depend on the work sizes it is executed with.
+         */
+        void getTunedWorkSizes(const cl_kernel kernel, size_t* localThreads, size_t* globalThreads) const;
+
         void enqueueMarker(cl_event*) const;
 
         /**
@@ -158,6 +168,19 @@ namespace hardware {
 
         bool isProfilingEnabled() const noexcept;
 
+        /**
+         * The number of complex numbers stored per gauge link on this device. This is smaller than NC * NC only if the
+         * device uses SOA buffers and the links are stored compressed (cf. reconstruct 12 and reconstruct 8 in the
+         * kernel code), such that it is the number to be used in the bandwidth models.
+         */
+        size_t getNumberOfStoredLinkElements() const;
+
+        /**
+         * Whether even-odd spinor and staggered fields are stored in single precision in SOA buffers, while the
+         * kernels still compute in hmc_float.
+         */
+        bool usesSinglePrecisionFermionStorage() const;
+
         /**
          * Make sure all commands have been sent to the device.
          */
@@ -179,6 +202,8 @@ namespace hardware {
          */
         /**
          * Get access to the specific kernels on this device.
+         * The code objects are created on first use. This is thread-safe, such that the programs of different code
+         * objects can be built concurrently, see System::buildCode.
          */
         const hardware::code::Gaugefield* getGaugefieldCode() const;
         const hardware::code::Prng* getPrngCode() const;
@@ -228,6 +253,16 @@ namespace hardware {
 
         mutable std::map<cl_kernel, ProfilingData> profiling_data;
 
+        /**
+         * Tuner for the work sizes of kernels, only present if kernel autotuning is enabled.
+         */
+        const std::unique_ptr<KernelTuner> kernelTuner;
+
+        /**
+         * Tracer of the system, only present if a trace is recorded.
+         */
+        hardware::Tracer* const tracer;
+
         /**
          * Pointers to specific code objects.
          * Initialized on demand.
@@ -248,6 +283,25 @@ namespace hardware {
         mutable hardware::code::Kappa* kappa_code;
         mutable hardware::code::Buffer* buffer_code;
 
+        /**
+         * Guards for the creation of the code objects, such that they can be requested from several threads.
+         */
+        mutable std::once_flag gaugefield_code_created;
+        mutable std::once_flag prng_code_created;
+        mutable std::once_flag real_code_created;
+        mutable std::once_flag complex_code_created;
+        mutable std::once_flag spinor_code_created;
+        mutable std::once_flag spinor_staggered_code_created;
+        mutable std::once_flag fermion_code_created;
+        mutable std::once_flag fermion_staggered_code_created;
+        mutable std::once_flag gaugemomentum_code_created;
+        mutable std::once_flag molecular_dynamics_code_created;
+        mutable std::once_flag correlator_code_created;
+        mutable std::once_flag correlator_staggered_code_created;
+        mutable std::once_flag heatbath_code_created;
+        mutable std::once_flag kappa_code_created;
+        mutable std::once_flag buffer_code_created;
+
         /**
          *  TODO work over member names
          * The position of the device in the device grid.
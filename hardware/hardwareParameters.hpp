@@ -29,18 +29,21 @@ namespace hardware {
       public:
         HardwareParametersInterface(){};
         virtual ~HardwareParametersInterface(){};
-        virtual int getNs() const                               = 0;
-        virtual int getNt() const                               = 0;
-        virtual int getSpatialLatticeVolume() const             = 0;
-        virtual int getLatticeVolume() const                    = 0;
-        virtual bool useGpu() const                             = 0;
-        virtual bool useCpu() const                             = 0;
-        virtual int getMaximalNumberOfDevices() const           = 0;
-        virtual std::vector<int> getSelectedDevices() const     = 0;
-        virtual bool splitCpu() const                           = 0;
-        virtual bool enableProfiling() const                    = 0;
-        virtual bool disableOpenCLCompilerOptimizations() const = 0;
-        virtual bool useSameRandomNumbers() const               = 0;
-        virtual bool useEvenOddPreconditioning() const          = 0;
+        virtual int getNs() const                                  = 0;
+        virtual int getNt() const                                  = 0;
+        virtual int getSpatialLatticeVolume() const                = 0;
+        virtual int getLatticeVolume() const                       = 0;
+        virtual bool useGpu() const                                = 0;
+        virtual bool useCpu() const                                = 0;
+        virtual int getMaximalNumberOfDevices() const              = 0;
+        virtual std::vector<int> getSelectedDevices() const        = 0;
+        virtual bool splitCpu() const                              = 0;
+        virtual bool enableProfiling() const                       = 0;
+        virtual bool useKernelAutotuning() const                   = 0;
+        virtual std::string getTraceFilename() const               = 0;
+        virtual bool disableOpenCLCompilerOptimizations() const    = 0;
+        virtual bool useSameRandomNumbers() const                  = 0;
+        virtual bool useEvenOddPreconditioning() const             = 0;
+        virtual common::halotransfer getHaloTransferMethod() const = 0;
     };
 }  // namespace hardware
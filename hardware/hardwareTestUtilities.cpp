@@ -22,10 +22,13 @@
 
 #include <boost/test/unit_test.hpp>
 
-std::pair<bool, bool> checkForBoostRuntimeArguments()
+#include <tuple>
+
+std::tuple<bool, bool, bool> checkForBoostRuntimeArguments()
 {
     bool useGpu   = false;
     bool useRec12 = false;
+    bool useRec8  = false;
     int num_par   = boost::unit_test::framework::master_test_suite().argc;
     if (num_par > 1) {  // argv[0] is the executable name
         /*
@@ -33,7 +36,7 @@ std::pair<bool, bool> checkForBoostRuntimeArguments()
          * from user arguments (as it is mandatory from version 1.60 on), there could be an argv[i] set to "--".
          * It is harmless now, but maybe not in the future, keep it in mind.
          */
-        logger.info() << "Found " << num_par << " runtime arguments, checking for gpu and rec12 options...";
+        logger.info() << "Found " << num_par << " runtime arguments, checking for gpu, rec12 and rec8 options...";
         for (int i = 1; i < num_par; i++) {
             std::string currentArgument = boost::unit_test::framework::master_test_suite().argv[i];
             if (currentArgument.find("--useGPU") != std::string::npos) {
@@ -46,18 +49,27 @@ std::pair<bool, bool> checkForBoostRuntimeArguments()
                     useRec12 = true;
                 }
             }
+            if (currentArgument.find("--useReconstruct8") != std::string::npos) {
+                if (currentArgument.find("true") != std::string::npos) {
+                    useRec8 = true;
+                }
+            }
         }
     }
-    return std::pair<bool, bool>{useGpu, useRec12};
+    return std::tuple<bool, bool, bool>{useGpu, useRec12, useRec8};
 }
 
 bool checkBoostRuntimeArgumentsForGpuUsage()
 {
-    return checkForBoostRuntimeArguments().first;
+    return std::get<0>(checkForBoostRuntimeArguments());
 }
 bool checkBoostRuntimeArgumentsForRec12Usage()
 {
-    return checkForBoostRuntimeArguments().second;
+    return std::get<1>(checkForBoostRuntimeArguments());
+}
+bool checkBoostRuntimeArgumentsForRec8Usage()
+{
+    return std::get<2>(checkForBoostRuntimeArguments());
 }
 
 void broadcastMessage_warn(const std::string message)
@@ -32,4 +32,5 @@ void atLeastOneDeviceMustExistForSanityOfSystem(const hardware::System* system);
 bool checkIfNoOpenCLDevicesWereFound(const hardware::OpenclException exception);
 bool checkBoostRuntimeArgumentsForGpuUsage();
 bool checkBoostRuntimeArgumentsForRec12Usage();
+bool checkBoostRuntimeArgumentsForRec8Usage();
 void handleExceptionInTest(hardware::OpenclException& exception);
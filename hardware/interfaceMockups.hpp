@@ -59,8 +59,11 @@ namespace hardware {
         virtual std::vector<int> getSelectedDevices() const override { return std::vector<int>{0}; }
         virtual bool splitCpu() const override { return false; }
         virtual bool enableProfiling() const override { return false; }
+        virtual bool useKernelAutotuning() const override { return false; }
+        virtual std::string getTraceFilename() const override { return ""; }
         virtual bool useSameRandomNumbers() const override { return false; }
         virtual bool useEvenOddPreconditioning() const override { return useEvenOdd; }
+        virtual common::halotransfer getHaloTransferMethod() const override { return common::auto_select; }
         virtual int getSpatialLatticeVolume() const override { return getNs() * getNs() * getNs(); }
         virtual int getLatticeVolume() const override { return getNs() * getNs() * getNs() * getNt(); }
 
@@ -133,7 +136,8 @@ namespace hardware {
                 , rho(0.)
                 , useRectangles(true)
                 , useSmearing(false)
-                , useRec12Value(checkBoostRuntimeArgumentsForRec12Usage()){};
+                , useRec12Value(checkBoostRuntimeArgumentsForRec12Usage())
+                , useRec8Value(checkBoostRuntimeArgumentsForRec8Usage()){};
             OpenClKernelParametersMockup(int nsIn, int ntIn, int rhoIterIn, double rhoIn, bool useSmearingIn)
                 : ns(nsIn)
                 , nt(ntIn)
@@ -141,7 +145,8 @@ namespace hardware {
                 , rho(rhoIn)
                 , useRectangles(false)
                 , useSmearing(useSmearingIn)
-                , useRec12Value(checkBoostRuntimeArgumentsForRec12Usage()){};
+                , useRec12Value(checkBoostRuntimeArgumentsForRec12Usage())
+                , useRec8Value(checkBoostRuntimeArgumentsForRec8Usage()){};
             OpenClKernelParametersMockup(int nsIn, int ntIn, bool useRectanglesIn)
                 : ns(nsIn)
                 , nt(ntIn)
@@ -149,7 +154,8 @@ namespace hardware {
                 , rho(0.)
                 , useRectangles(useRectanglesIn)
                 , useSmearing(false)
-                , useRec12Value(checkBoostRuntimeArgumentsForRec12Usage()){};
+                , useRec12Value(checkBoostRuntimeArgumentsForRec12Usage())
+                , useRec8Value(checkBoostRuntimeArgumentsForRec8Usage()){};
             OpenClKernelParametersMockup(LatticeExtents lE)
                 : ns(lE.getNs())
                 , nt(lE.getNt())
@@ -157,7 +163,8 @@ namespace hardware {
                 , rho(0.)
                 , useRectangles(true)
                 , useSmearing(false)
-                , useRec12Value(checkBoostRuntimeArgumentsForRec12Usage()){};
+                , useRec12Value(checkBoostRuntimeArgumentsForRec12Usage())
+                , useRec8Value(checkBoostRuntimeArgumentsForRec8Usage()){};
             OpenClKernelParametersMockup(LatticeExtents lE, bool useRectanglesIn)
                 : ns(lE.getNs())
                 , nt(lE.getNt())
@@ -165,7 +172,8 @@ namespace hardware {
                 , rho(0.)
                 , useRectangles(useRectanglesIn)
                 , useSmearing(false)
-                , useRec12Value(checkBoostRuntimeArgumentsForRec12Usage()){};
+                , useRec12Value(checkBoostRuntimeArgumentsForRec12Usage())
+                , useRec8Value(checkBoostRuntimeArgumentsForRec8Usage()){};
             virtual ~OpenClKernelParametersMockup(){};
 
             virtual int getNs() const override { return ns; }
@@ -179,6 +187,8 @@ namespace hardware {
             virtual double getRho() const override { return rho; }
             virtual int getRhoIter() const override { return rhoIter; }
             virtual bool getUseRec12() const override { return useRec12Value; }
+            virtual bool getUseRec8() const override { return useRec8Value; }
+            virtual bool getUseSinglePrecFermionStorage() const override { return false; }
             virtual bool getUseEo() const override { return false; }
             virtual common::action getFermact() const override { return common::action::wilson; }
             virtual common::action getGaugeact() const override { return common::action::wilson; }
@@ -199,11 +209,7 @@ namespace hardware {
             virtual double getC1() const override { return 0.; }
             virtual double getXi0() const override { return 0.; }
             virtual size_t getFloatSize() const override { return getPrecision() / 8; }
-            virtual size_t getMatSize() const override
-            {
-                // TODO with rec12 this becomes 6
-                return 9;
-            }
+            virtual size_t getMatSize() const override { return getUseRec12() ? 6 : (getUseRec8() ? 4 : 9); }
             virtual size_t getSpinorFieldSize() const override { return getLatticeVolume(); }
             virtual size_t getEoprecSpinorFieldSize() const override { return getLatticeVolume() / 2; }
             virtual int getCorrDir() const override { return 3; }
@@ -221,7 +227,7 @@ namespace hardware {
             int ns, nt, rhoIter;
             double rho;
             bool useRectangles, useSmearing;
-            bool useRec12Value;
+            bool useRec12Value, useRec8Value;
         };
 
         class OpenClKernelParametersMockupForSpinorTests : public OpenClKernelParametersMockup {
@@ -258,21 +264,38 @@ namespace hardware {
             virtual common::action getFermact() const override { return common::action::rooted_stagg; }
         };
 
+        class OpenClKernelParametersMockupForSinglePrecisionFermionStorage final
+            : public OpenClKernelParametersMockupForSpinorTests {
+          public:
+            OpenClKernelParametersMockupForSinglePrecisionFermionStorage(const LatticeExtents lE)
+                : OpenClKernelParametersMockupForSpinorTests(lE){};
+            OpenClKernelParametersMockupForSinglePrecisionFermionStorage(const LatticeExtents lE,
+                                                                         const bool useEvenOddIn)
+                : OpenClKernelParametersMockupForSpinorTests(lE, useEvenOddIn){};
+            virtual ~OpenClKernelParametersMockupForSinglePrecisionFermionStorage(){};
+
+            virtual bool getUseSinglePrecFermionStorage() const override { return true; }
+        };
+
         class OpenClKernelParametersMockupForCorrelators final : public OpenClKernelParametersMockupForSpinorTests {
           public:
             OpenClKernelParametersMockupForCorrelators(const int nsIn, const int ntIn, const double kappaIn,
-                                                       const double directionIn)
+                                                       const double directionIn,
+                                                       const common::sourcetypes sTIn = common::sourcetypes::point)
                 : OpenClKernelParametersMockupForSpinorTests(nsIn, ntIn)
                 , correlatorDirection(directionIn)
-                , kappa(kappaIn){};
+                , kappa(kappaIn)
+                , sT(sTIn){};
 
             virtual int getCorrDir() const override { return correlatorDirection; }
             virtual double getKappa() const override { return kappa; }
             virtual bool getMeasureCorrelators() const override { return true; }
+            virtual common::sourcetypes getSourceType() const override { return sT; }
 
           private:
             const int correlatorDirection;
             const double kappa;
+            const common::sourcetypes sT;
         };
 
         class OpenClKernelParametersMockupForStaggeredCorrelators final
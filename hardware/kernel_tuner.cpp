@@ -0,0 +1,204 @@
+/** @file
+ * Implementation of the hardware::KernelTuner class
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "kernel_tuner.hpp"
+
+#include "../host_functionality/logger.hpp"
+#include "opencl_compiler.hpp"
+#include "system.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+
+#define BOOST_FILESYSTEM_VERSION 3
+#include <boost/filesystem.hpp>
+namespace fs = boost::filesystem;
+
+static std::string get_kernel_name(const cl_kernel kernel);
+static bool load_work_sizes(const std::string& path, hardware::KernelTuner::WorkSizes* workSizes);
+static void store_work_sizes(const std::string& path, const hardware::KernelTuner::WorkSizes& workSizes);
+
+/**
+ * Upper bound for the local work sizes tried, larger work groups never paid off on the devices in use.
+ */
+static const size_t max_tuned_local_work_size = 512;
+/**
+ * The global work sizes tried are these multiples of local work size times the number of compute units.
+ */
+static const size_t global_work_size_factors[] = {1, 2, 4, 8, 16};
+
+hardware::KernelTuner::KernelTuner(const DeviceInfo& deviceIn) : device(deviceIn), kernels()
+{
+}
+
+void hardware::KernelTuner::getWorkSizes(const cl_kernel kernel, size_t* localThreads, size_t* globalThreads)
+{
+    auto state = kernels.find(kernel);
+    if (state == kernels.end()) {
+        state = kernels.emplace(kernel, createKernelState(kernel, *localThreads, *globalThreads)).first;
+    }
+    const WorkSizes& workSizes = state->second.finished ? state->second.best
+                                                        : state->second.candidates[state->second.current];
+    *localThreads  = workSizes.first;
+    *globalThreads = workSizes.second;
+}
+
+bool hardware::KernelTuner::isMeasuring(const cl_kernel kernel, const size_t globalThreads,
+                                        const size_t localThreads) const
+{
+    const auto state = kernels.find(kernel);
+    if (state == kernels.end() || state->second.finished) {
+        return false;
+    }
+    return state->second.candidates[state->second.current] == WorkSizes(localThreads, globalThreads);
+}
+
+void hardware::KernelTuner::addMeasurement(const cl_kernel kernel, const size_t globalThreads,
+                                           const size_t localThreads, const uint64_t microseconds)
+{
+    if (!isMeasuring(kernel, globalThreads, localThreads)) {
+        return;
+    }
+    KernelState& state = kernels[kernel];
+    state.currentTime  = std::min(state.currentTime, microseconds);
+    if (++state.measurements < measurementsPerCandidate) {
+        return;
+    }
+
+    if (state.currentTime < state.bestTime) {
+        state.best     = state.candidates[state.current];
+        state.bestTime = state.currentTime;
+    }
+    state.measurements = 0;
+    state.currentTime  = std::numeric_limits<uint64_t>::max();
+    if (++state.current < state.candidates.size()) {
+        return;
+    }
+
+    state.finished = true;
+    logger.info() << "Tuned " << get_kernel_name(kernel) << " on " << device.get_name()
+                  << ": local work size " << state.best.first << ", global work size " << state.best.second;
+    const std::string path = getKernelCacheFilePath(kernel, ".tuning");
+    if (!path.empty()) {
+        store_work_sizes(path, state.best);
+    }
+}
+
+hardware::KernelTuner::KernelState hardware::KernelTuner::createKernelState(const cl_kernel kernel,
+                                                                            const size_t localThreads,
+                                                                            const size_t globalThreads) const
+{
+    KernelState state;
+    state.current      = 0;
+    state.measurements = 0;
+    state.currentTime  = std::numeric_limits<uint64_t>::max();
+    state.best         = WorkSizes(localThreads, globalThreads);
+    state.bestTime     = std::numeric_limits<uint64_t>::max();
+
+    const std::string path = getKernelCacheFilePath(kernel, ".tuning");
+    if (!path.empty() && load_work_sizes(path, &state.best)) {
+        logger.debug() << "Using cached work sizes for " << get_kernel_name(kernel) << ": local work size "
+                       << state.best.first << ", global work size " << state.best.second;
+        state.finished = true;
+    } else {
+        state.candidates = getCandidates(kernel, localThreads, globalThreads);
+        state.finished   = state.candidates.empty();
+    }
+    return state;
+}
+
+std::vector<hardware::KernelTuner::WorkSizes>
+hardware::KernelTuner::getCandidates(const cl_kernel kernel, const size_t localThreads,
+                                     const size_t globalThreads) const
+{
+    size_t max_local_work_size;
+    cl_int clerr = clGetKernelWorkGroupInfo(kernel, device.get_id(), CL_KERNEL_WORK_GROUP_SIZE, sizeof(size_t),
+                                            &max_local_work_size, NULL);
+    if (clerr) {
+        throw hardware::OpenclException(clerr, "clGetKernelWorkGroupInfo", __FILE__, __LINE__);
+    }
+    size_t local_work_size_multiple;
+    clerr = clGetKernelWorkGroupInfo(kernel, device.get_id(), CL_KERNEL_PREFERRED_WORK_GROUP_SIZE_MULTIPLE,
+                                     sizeof(size_t), &local_work_size_multiple, NULL);
+    if (clerr || local_work_size_multiple == 0) {
+        local_work_size_multiple = 1;
+    }
+    max_local_work_size = std::min(max_local_work_size, max_tuned_local_work_size);
+
+    // the default is always among the candidates, so tuning can never make things worse
+    std::vector<WorkSizes> candidates(1, WorkSizes(localThreads, globalThreads));
+    for (size_t ls = local_work_size_multiple; ls <= max_local_work_size; ls *= 2) {
+        for (const size_t factor : global_work_size_factors) {
+            const WorkSizes candidate(ls, ls * device.get_num_compute_units() * factor);
+            if (std::find(candidates.begin(), candidates.end(), candidate) == candidates.end()) {
+                candidates.push_back(candidate);
+            }
+        }
+    }
+    logger.debug() << "Tuning work sizes of " << get_kernel_name(kernel) << " with " << candidates.size()
+                   << " candidates";
+    return candidates;
+}
+
+static std::string get_kernel_name(const cl_kernel kernel)
+{
+    size_t bytesInKernelName;
+    if (clGetKernelInfo(kernel, CL_KERNEL_FUNCTION_NAME, 0, NULL, &bytesInKernelName) != CL_SUCCESS) {
+        return "unknown kernel";
+    }
+    std::vector<char> kernelName(bytesInKernelName);
+    if (clGetKernelInfo(kernel, CL_KERNEL_FUNCTION_NAME, bytesInKernelName, kernelName.data(), NULL) != CL_SUCCESS) {
+        return "unknown kernel";
+    }
+    return std::string(kernelName.data());
+}
+
+static bool load_work_sizes(const std::string& path, hardware::KernelTuner::WorkSizes* workSizes)
+{
+    std::ifstream file(path);
+    size_t ls, gs;
+    if (!(file >> ls >> gs) || ls == 0 || gs == 0 || gs % ls != 0) {
+        return false;
+    }
+    *workSizes = hardware::KernelTuner::WorkSizes(ls, gs);
+    return true;
+}
+
+static void store_work_sizes(const std::string& path, const hardware::KernelTuner::WorkSizes& workSizes)
+{
+    // write to a temporary file first, such that concurrent processes never read a partially written file
+    const fs::path tmp_path = fs::unique_path(path + ".%%%%-%%%%-%%%%");
+    {
+        std::ofstream file(tmp_path.string());
+        file << workSizes.first << ' ' << workSizes.second << '\n';
+        if (!file) {
+            logger.warn() << "Failed to store tuned work sizes in " << tmp_path;
+            return;
+        }
+    }
+    boost::system::error_code err;
+    fs::rename(tmp_path, path, err);
+    if (err) {
+        logger.warn() << "Failed to store tuned work sizes in " << path << ": " << err.message();
+        fs::remove(tmp_path, err);
+    }
+}
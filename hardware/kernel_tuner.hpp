@@ -0,0 +1,95 @@
+/** @file
+ * Declaration of the hardware::KernelTuner class
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _HARDWARE_KERNEL_TUNER_
+#define _HARDWARE_KERNEL_TUNER_
+
+#include "device_info.hpp"
+
+#include <map>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+namespace hardware {
+
+    /**
+     * Autotuner for the local and global work sizes of kernels.
+     *
+     * The first executions of a kernel are performed with different candidate work sizes and timed. Afterwards the
+     * fastest candidate is used for all further executions and stored in a file next to the binary cache of the
+     * kernel, such that later runs on the same device with the same driver can skip the tuning.
+     *
+     * Only kernels whose results do not depend on the work sizes must be tuned. As the tuning happens on the real
+     * executions, nothing is executed more than once.
+     */
+    class KernelTuner {
+      public:
+        typedef std::pair<size_t, size_t> WorkSizes;  // local and global work size
+
+        KernelTuner(const DeviceInfo& deviceIn);
+        KernelTuner& operator=(const KernelTuner&) = delete;
+        KernelTuner(const KernelTuner&)            = delete;
+        KernelTuner()                              = delete;
+
+        /**
+         * Replace the given default work sizes by the ones to be used for the next execution of the kernel.
+         */
+        void getWorkSizes(const cl_kernel kernel, size_t* localThreads, size_t* globalThreads);
+
+        /**
+         * Whether an execution of the kernel with the given work sizes is a measurement of the tuning.
+         */
+        bool isMeasuring(const cl_kernel kernel, const size_t globalThreads, const size_t localThreads) const;
+
+        /**
+         * Record the execution time of a measurement, the tuning is finished once all candidates have been timed.
+         */
+        void addMeasurement(const cl_kernel kernel, const size_t globalThreads, const size_t localThreads,
+                            const uint64_t microseconds);
+
+        /**
+         * How often each candidate is timed, the fastest of these executions counts.
+         */
+        static constexpr unsigned measurementsPerCandidate = 2;
+
+      private:
+        struct KernelState {
+            std::vector<WorkSizes> candidates;
+            size_t current;
+            unsigned measurements;
+            uint64_t currentTime;
+            WorkSizes best;
+            uint64_t bestTime;
+            bool finished;
+        };
+
+        const DeviceInfo& device;
+        std::map<cl_kernel, KernelState> kernels;
+
+        KernelState createKernelState(const cl_kernel kernel, const size_t localThreads,
+                                      const size_t globalThreads) const;
+        std::vector<WorkSizes> getCandidates(const cl_kernel kernel, const size_t localThreads,
+                                             const size_t globalThreads) const;
+    };
+}  // namespace hardware
+
+#endif /* _HARDWARE_KERNEL_TUNER_ */
@@ -28,10 +28,12 @@
 #include "../code/gaugefield.hpp"
 #include "../device.hpp"
 
+#include <memory>
+
 static Matrixsu3 random_matrixsu3();
 
 hardware::lattices::Gaugefield::Gaugefield(const hardware::System& system)
-    : system(system), buffers(allocate_buffers()), unsmeared_buffers()
+    : system(system), buffers(allocate_buffers()), unsmeared_buffers(), smearing_buffers(), is_smeared(false)
 {
 }
 
@@ -39,6 +41,7 @@ hardware::lattices::Gaugefield::~Gaugefield()
 {
     release_buffers(&buffers);
     release_buffers(&unsmeared_buffers);
+    release_buffers(&smearing_buffers);
 }
 
 const std::vector<const hardware::buffers::SU3*> hardware::lattices::Gaugefield::get_buffers() const noexcept
@@ -127,6 +130,53 @@ void hardware::lattices::Gaugefield::fetch_gaugefield_from_buffers(Matrixsu3* co
     }
 }
 
+static size_t get_contraction_code_array_size(const hardware::Device* device)
+{
+    return device->getLocalLatticeExtents().getLatticeVolume() * NDIM * 2 * NC * NC;
+}
+
+/**
+ * The timeslices of a device form a contiguous part of the array of the contraction code.
+ */
+static size_t get_contraction_code_array_offset(const hardware::Device* device)
+{
+    return device->getGridPos().t * get_contraction_code_array_size(device);
+}
+
+void hardware::lattices::Gaugefield::send_contraction_code_array_to_buffers(const hmc_float* const array)
+{
+    using hardware::buffers::Plain;
+
+    logger.trace() << "importing gaugefield from contraction code array";
+    std::vector<std::unique_ptr<const Plain<hmc_float>>> staging;
+    for (auto const buffer : buffers) {
+        auto device = buffer->get_device();
+        staging.emplace_back(new Plain<hmc_float>(get_contraction_code_array_size(device), device));
+        staging.back()->load_async(array + get_contraction_code_array_offset(device));
+        device->getGaugefieldCode()->importGaugefieldFromContractionCode(buffer, staging.back().get());
+    }
+    for (auto const buffer : buffers) {
+        buffer->get_device()->synchronize();
+    }
+    update_halo();
+}
+
+void hardware::lattices::Gaugefield::fetch_contraction_code_array_from_buffers(hmc_float* const array)
+{
+    using hardware::buffers::Plain;
+
+    logger.trace() << "fetching gaugefield to contraction code array";
+    std::vector<std::unique_ptr<const Plain<hmc_float>>> staging;
+    std::vector<hardware::SynchronizationEvent> events;
+    for (auto const buffer : buffers) {
+        auto device = buffer->get_device();
+        staging.emplace_back(new Plain<hmc_float>(get_contraction_code_array_size(device), device));
+        device->getGaugefieldCode()->exportGaugefieldToContractionCode(staging.back().get(), buffer);
+        events.push_back(staging.back()->dump_async(array + get_contraction_code_array_offset(device)));
+    }
+    hardware::wait(events);
+}
+
 void hardware::lattices::Gaugefield::update_halo_aos(const std::vector<const hardware::buffers::SU3*> buffers,
                                                      const hardware::System& system) const
 {
@@ -157,12 +207,17 @@ void hardware::lattices::Gaugefield::update_halo_soa(const std::vector<const har
 
 void hardware::lattices::Gaugefield::update_halo() const
 {
-    if (buffers.size() > 1) {  // for a single device this will be a noop
+    update_halo(buffers);
+}
+
+void hardware::lattices::Gaugefield::update_halo(const std::vector<const hardware::buffers::SU3*>& gf_buffers) const
+{
+    if (gf_buffers.size() > 1) {  // for a single device this will be a noop
         // currently either all or none of the buffers must be SOA
-        if (buffers[0]->is_soa()) {
-            update_halo_soa(buffers, system);
+        if (gf_buffers[0]->is_soa()) {
+            update_halo_soa(gf_buffers, system);
         } else {
-            update_halo_aos(buffers, system);
+            update_halo_aos(gf_buffers, system);
         }
     }
 }
@@ -318,46 +373,46 @@ static Matrixsu3 random_matrixsu3()
 
 void hardware::lattices::Gaugefield::smear(unsigned int smearingSteps)
 {
-    unsmeared_buffers = allocate_buffers();
+    if (is_smeared) {
+        logger.warn() << "Tried to smear gaugefield that is already smeared.";
+        return;
+    }
 
+    // the buffers are kept between calls, such that repeated smearing does not allocate device memory
+    if (unsmeared_buffers.empty()) {
+        unsmeared_buffers = allocate_buffers();
+        smearing_buffers  = allocate_buffers();
+    }
     for (size_t i = 0; i < buffers.size(); ++i) {
-        auto buf     = buffers[i];
-        auto device  = buf->get_device();
-        auto gf_code = device->getGaugefieldCode();  // should be like: get_gaugefield_code(
-                                                     // HardwareParameters_gaugefield )
-
-        hardware::buffers::copyData(unsmeared_buffers[i], buf);
+        hardware::buffers::copyData(unsmeared_buffers[i], buffers[i]);
+    }
+    is_smeared = true;
 
-        int rho_iter = smearingSteps;
-        logger.debug() << "\t\tperform " << rho_iter << " steps of stout-smearing to the gaugefield...";
+    logger.debug() << "\t\tperform " << smearingSteps << " steps of stout-smearing to the gaugefield...";
 
-        // one needs a temporary gf to apply the smearing to
-        const hardware::buffers::SU3 gf_tmp(buf->get_elements(), device);
-        for (int i = 0; i < rho_iter - 1; i += 2) {
-            gf_code->stout_smear_device(buf, &gf_tmp);
-            gf_code->stout_smear_device(&gf_tmp, buf);
-        }
-        // if rho_iter is odd one has to copy ones more
-        if (rho_iter % 2 == 1) {
-            gf_code->stout_smear_device(buf, &gf_tmp);
-            hardware::buffers::copyData(buf, &gf_tmp);
+    // the steps alternate between the gaugefield and one spare buffer per device, the first one reading the unsmeared
+    // copy and writing to whichever of the two makes the last step end in the gaugefield
+    const std::vector<const hardware::buffers::SU3*>* in = &unsmeared_buffers;
+    for (unsigned int step = 0; step < smearingSteps; ++step) {
+        const auto out = ((smearingSteps - step) % 2 == 1) ? &buffers : &smearing_buffers;
+        for (size_t i = 0; i < buffers.size(); ++i) {
+            (*in)[i]->get_device()->getGaugefieldCode()->stout_smear_device((*in)[i], (*out)[i]);
         }
+        // the staples of the next step reach into the halo
+        update_halo(*out);
+        in = out;
     }
 }
 
 void hardware::lattices::Gaugefield::unsmear()
 {
-    if (unsmeared_buffers.size() == 0) {
+    if (!is_smeared) {
         logger.warn() << "Tried to unsmear gaugefield that is not smeared.";
         return;
     }
 
-    unsmeared_buffers = allocate_buffers();
-
     for (size_t i = 0; i < buffers.size(); ++i) {
-        auto buf = buffers[i];
-        hardware::buffers::copyData(buf, unsmeared_buffers[i]);
+        hardware::buffers::copyData(buffers[i], unsmeared_buffers[i]);
     }
-
-    release_buffers(&unsmeared_buffers);
+    is_smeared = false;
 }
@@ -45,12 +45,26 @@ namespace hardware {
             void release_buffers(std::vector<const hardware::buffers::SU3*>* buffers);
             void send_gaugefield_to_buffers(const Matrixsu3* const gf_host);
             void fetch_gaugefield_from_buffers(Matrixsu3* const gf_host);
+            /**
+             * Transfer the gaugefield from and to an array in the format of the contraction code.
+             *
+             * The conversion is done on the devices and each device transfers its timeslices directly from or to
+             * their part of the given array, which may be pinned memory.
+             */
+            void send_contraction_code_array_to_buffers(const hmc_float* const array);
+            void fetch_contraction_code_array_from_buffers(hmc_float* const array);
 
             void update_halo() const;
 
             void set_cold() const;
             void set_hot() const;
 
+            /**
+             * Replace the gaugefield by its stout smeared version, keeping a copy of the unsmeared one.
+             *
+             * Only the final field is kept, such that besides the copy only one spare buffer per device is needed
+             * independently of the number of steps. These buffers are kept for later calls.
+             */
             void smear(unsigned int smearingSteps);
             void unsmear();
 
@@ -58,6 +72,10 @@ namespace hardware {
             hardware::System const& system;
             std::vector<const hardware::buffers::SU3*> buffers;
             std::vector<const hardware::buffers::SU3*> unsmeared_buffers;
+            std::vector<const hardware::buffers::SU3*> smearing_buffers;
+            bool is_smeared;
+
+            void update_halo(const std::vector<const hardware::buffers::SU3*>& buffers) const;
 
             void
             update_halo_soa(std::vector<const hardware::buffers::SU3*> buffers, const hardware::System& system) const;
@@ -36,7 +36,12 @@ hardware::lattices::PRNG::PRNG(const hardware::System& system, uint32_t seed, bo
         // create a buffer for each device
         const PRNGBuffer* buffer = new PRNGBuffer(device, useSameRandomNumbers);
         auto code                = device->getPrngCode();
+#ifdef USE_PRNG_PHILOX
+        // the site-indexed streams require the same seed on all devices
+        code->initialize(buffer, seed + 1, buffers.size());
+#else
         code->initialize(buffer, ++seed);
+#endif
         buffers.push_back(buffer);
     }
 }
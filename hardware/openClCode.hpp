@@ -115,6 +115,10 @@ namespace hardware {
             return std::unique_ptr<hardware::code::Fermions_staggered>(
                 new hardware::code::Fermions_staggered{*kernelParameters, deviceIn});
         }
+        const hardware::code::OpenClKernelParametersInterface& getKernelParameters() const
+        {
+            return *kernelParameters;
+        }
 
       private:
         const hardware::code::OpenClKernelParametersInterface* kernelParameters;
@@ -38,6 +38,8 @@ namespace hardware {
             virtual double getRho() const                           = 0;
             virtual int getRhoIter() const                          = 0;
             virtual bool getUseRec12() const                        = 0;
+            virtual bool getUseRec8() const                         = 0;
+            virtual bool getUseSinglePrecFermionStorage() const     = 0;
             virtual bool getUseEo() const                           = 0;
             virtual common::action getFermact() const               = 0;
             virtual common::action getGaugeact() const              = 0;
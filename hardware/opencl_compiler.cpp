@@ -31,6 +31,9 @@
 #include <boost/regex.hpp>
 #include <cstring>
 #include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <sstream>
 
 #define BOOST_FILESYSTEM_VERSION 3
@@ -70,6 +73,25 @@ static ip::file_lock get_lock_file(std::string md5);
  * Get the absolute path to a sourcefile of the given name.
  */
 static fs::path get_source_file_path(std::string filename);
+/**
+ * Get the common part of the paths of the files caching data of the given kernel, i.e. everything but the extension.
+ */
+static fs::path get_kernel_cache_file_stem(std::string md5, std::string kernel_name);
+/**
+ * Remove all files caching data of the given kernel, as they refer to an outdated build.
+ */
+static void remove_kernel_cache_files(std::string md5, std::string kernel_name);
+/**
+ * Get the mutex serializing the builds of the program with the given md5 within this process.
+ * The lock file only protects against other processes, as file locks are held by the whole process.
+ */
+static std::mutex& get_build_mutex(std::string md5);
+
+/**
+ * The stems of the cache files of all kernels created so far, required to map a cl_kernel back to its program.
+ */
+static std::map<cl_kernel, std::string> kernel_cache_file_stems;
+static std::mutex kernel_cache_file_stems_mutex;
 
 ClSourcePackage ClSourcePackage::operator<<(const std::string& file)
 {
@@ -116,6 +138,7 @@ TmpClKernel::operator cl_kernel() const
     cl_program program;
 
     // Us the lock to ensure that the binary is not read and written at the same time
+    std::lock_guard<std::mutex> build_lock(get_build_mutex(md5));
     file_lock lock_file = get_lock_file(md5);
     {
         sharable_lock<file_lock> lock_shared(lock_file);
@@ -136,6 +159,7 @@ TmpClKernel::operator cl_kernel() const
             program = loadSources();
             buildProgram(program);
             dumpBinary(program, md5);
+            remove_kernel_cache_files(md5, kernel_name);
         }
     } else {
         buildProgram(program);
@@ -150,6 +174,11 @@ TmpClKernel::operator cl_kernel() const
         printResourceRequirements(kernel);
     }
 
+    {
+        std::lock_guard<std::mutex> lock(kernel_cache_file_stems_mutex);
+        kernel_cache_file_stems[kernel] = get_kernel_cache_file_stem(md5, kernel_name).string();
+    }
+
     // make sure program get's cleaned up once kernel is released
     clReleaseProgram(program);
 
@@ -707,20 +736,64 @@ cl_program TmpClKernel::loadSources() const
 
 static fs::path get_binary_file_path(std::string md5)
 {
-    static std::string user_name;
-    if (user_name.empty()) {
+    // initialization of a local static is thread-safe, unlike a check for emptiness
+    static const std::string user_name = []() {
         char* _user_name = getenv("USER");
         if (!_user_name) {
             throw Print_Error_Message("Failed to get user name", __FILE__, __LINE__);
         }
-        user_name = _user_name;
-    }
+        return std::string(_user_name);
+    }();
     const fs::path cache_dir = fs::temp_directory_path() / (user_name + '-' + CACHE_DIR_NAME);
     // const fs::path cache_dir = fs::current_path() / (user_name + '-' + CACHE_DIR_NAME);
     const std::string file_name = md5 + ".elf";
     return cache_dir / file_name;
 }
 
+static fs::path get_kernel_cache_file_stem(std::string md5, std::string kernel_name)
+{
+    return get_binary_file_path(md5).parent_path() / (md5 + '_' + kernel_name);
+}
+
+static void remove_kernel_cache_files(std::string md5, std::string kernel_name)
+{
+    const fs::path stem = get_kernel_cache_file_stem(md5, kernel_name);
+    if (!fs::exists(stem.parent_path())) {
+        return;
+    }
+    const std::string prefix = stem.filename().string() + '.';
+    for (fs::directory_iterator i(stem.parent_path()); i != fs::directory_iterator(); ++i) {
+        if (boost::starts_with(i->path().filename().string(), prefix)) {
+            logger.debug() << "Removing outdated kernel cache file " << i->path();
+            boost::system::error_code ignored;
+            fs::remove(i->path(), ignored);
+        }
+    }
+}
+
+static std::mutex& get_build_mutex(std::string md5)
+{
+    static std::map<std::string, std::unique_ptr<std::mutex>> build_mutexes;
+    static std::mutex build_mutexes_mutex;
+
+    std::lock_guard<std::mutex> lock(build_mutexes_mutex);
+    auto& build_mutex = build_mutexes[md5];
+    if (!build_mutex) {
+        build_mutex.reset(new std::mutex());
+    }
+    return *build_mutex;
+}
+
+std::string getKernelCacheFilePath(const cl_kernel kernel, const std::string& extension)
+{
+    std::lock_guard<std::mutex> lock(kernel_cache_file_stems_mutex);
+    const auto stem = kernel_cache_file_stems.find(kernel);
+    if (stem == kernel_cache_file_stems.end()) {
+        return std::string();
+    }
+    return stem->second + extension;
+}
+
 TmpClKernel::TmpClKernel(const std::string kernel_name, const std::string build_options, const cl_context context,
                          cl_device_id device, const std::vector<std::string> files)
     : kernel_name(kernel_name)
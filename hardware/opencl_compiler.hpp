@@ -173,4 +173,13 @@ class TmpClKernel {
     void buildProgram(cl_program) const;
 };
 
+/**
+ * Get the path of a file next to the binary cache which can hold persistent data of the given kernel, e.g. tuned work
+ * sizes. As for the binary, the name identifies device, driver version, sources and build options and the file is
+ * removed whenever the program of the kernel has to be rebuilt from its sources.
+ *
+ * @return An empty string if the kernel was not created by a TmpClKernel.
+ */
+std::string getKernelCacheFilePath(const cl_kernel kernel, const std::string& extension);
+
 #endif /* _OPENCL_COMPILER_H_ */
@@ -24,6 +24,7 @@
 // use the boost test framework
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE OpenCL Compiler
+#include <boost/algorithm/string/predicate.hpp>
 #include <boost/test/unit_test.hpp>
 
 BOOST_AUTO_TEST_CASE(PackageCreateEmpty)
@@ -144,6 +145,11 @@ BOOST_AUTO_TEST_CASE(KernelCreation)
     BOOST_CHECK_EQUAL(CL_SUCCESS, err);
     BOOST_CHECK_EQUAL(std::string("dummyKernel"), std::string(kernel_name));
 
+    // kernels created via TmpClKernel get a cache file path next to their binary
+    const std::string cacheFilePath = getKernelCacheFilePath(testKernel, ".tuning");
+    BOOST_CHECK(boost::algorithm::ends_with(cacheFilePath, "_dummyKernel.tuning"));
+    BOOST_CHECK(getKernelCacheFilePath(nullptr, ".tuning").empty());
+
     //
     // BE NICE AND DO SOME CLEANUP
     //
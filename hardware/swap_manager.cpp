@@ -0,0 +1,136 @@
+/** @file
+ * Implementation of the hardware::SwapManager class
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "swap_manager.hpp"
+
+#include "../host_functionality/logger.hpp"
+#include "device.hpp"
+#include "system.hpp"
+
+#include <stdexcept>
+
+hardware::SwapManager::HostMemory::HostMemory(const size_t bytes, const Device* device)
+    : buffer(bytes, device, true), mapping(buffer.map()), pointer(mapping->get_mapped_ptr())
+{
+    mapping->get_map_event().wait();
+}
+
+hardware::SwapManager::SwapManager(const System& systemIn) : system(systemIn), transferQueues(), pool()
+{
+}
+
+hardware::SwapManager::~SwapManager()
+{
+    // pending transfers might still access the host memory of the pool
+    for (auto& queue : transferQueues) {
+        clFinish(queue.second);
+        clReleaseCommandQueue(queue.second);
+    }
+    pool.clear();
+}
+
+std::unique_ptr<hardware::SwapManager::HostMemory> hardware::SwapManager::swapOut(const buffers::Buffer* buffer)
+{
+    auto device     = buffer->get_device();
+    auto queue      = getTransferQueue(device);
+    auto hostMemory = acquire(buffer->get_bytes(), device);
+
+    // the copy must not start before the kernels enqueued so far wrote the buffer
+    cl_event marker;
+    device->enqueueMarker(&marker);
+    device->flush();
+
+    cl_int err = clEnqueueReadBuffer(queue, *buffer->get_cl_buffer(), CL_FALSE, 0, buffer->get_bytes(),
+                                     hostMemory->pointer, 1, &marker, nullptr);
+    clReleaseEvent(marker);
+    if (err) {
+        throw hardware::OpenclException(err, "clEnqueueReadBuffer", __FILE__, __LINE__);
+    }
+    clFlush(queue);
+
+    return hostMemory;
+}
+
+hardware::SynchronizationEvent hardware::SwapManager::swapIn(const buffers::Buffer* buffer,
+                                                             std::unique_ptr<HostMemory> hostMemory)
+{
+    if (hostMemory->buffer.get_bytes() != buffer->get_bytes()) {
+        throw std::invalid_argument("The host memory does not match the size of the buffer to swap in.");
+    }
+    auto device = buffer->get_device();
+    auto queue  = getTransferQueue(device);
+
+    cl_event event_cl;
+    cl_int err = clEnqueueWriteBuffer(queue, *buffer->get_cl_buffer(), CL_FALSE, 0, buffer->get_bytes(),
+                                      hostMemory->pointer, 0, nullptr, &event_cl);
+    if (err) {
+        throw hardware::OpenclException(err, "clEnqueueWriteBuffer", __FILE__, __LINE__);
+    }
+    clFlush(queue);
+
+    const hardware::SynchronizationEvent event(event_cl);
+    err = clReleaseEvent(event_cl);
+    if (err) {
+        throw hardware::OpenclException(err, "clReleaseEvent", __FILE__, __LINE__);
+    }
+
+    // any later use of the host memory is a transfer on the same in-order queue
+    release(std::move(hostMemory));
+    return event;
+}
+
+void hardware::SwapManager::release(std::unique_ptr<HostMemory> hostMemory)
+{
+    if (hostMemory) {
+        auto device = hostMemory->buffer.get_device();
+        pool[device].push_back(std::move(hostMemory));
+    }
+}
+
+cl_command_queue hardware::SwapManager::getTransferQueue(const Device* device)
+{
+    auto queue = transferQueues.find(device);
+    if (queue == transferQueues.end()) {
+        cl_int err;
+        cl_command_queue newQueue = clCreateCommandQueue(system.getContext(), device->get_id(), 0, &err);
+        if (err) {
+            logger.error() << "Failed to create command queue for swapping. OpenCL Error: " << err;
+            throw hardware::OpenclException(err, "clCreateCommandQueue", __FILE__, __LINE__);
+        }
+        queue = transferQueues.emplace(device, newQueue).first;
+    }
+    return queue->second;
+}
+
+std::unique_ptr<hardware::SwapManager::HostMemory> hardware::SwapManager::acquire(const size_t bytes,
+                                                                                 const Device* device)
+{
+    auto& freeMemory = pool[device];
+    for (auto memory = freeMemory.begin(); memory != freeMemory.end(); ++memory) {
+        if ((*memory)->buffer.get_bytes() == bytes) {
+            auto hostMemory = std::move(*memory);
+            freeMemory.erase(memory);
+            return hostMemory;
+        }
+    }
+    logger.trace() << "Allocating " << bytes << " bytes of pinned host memory for swapping.";
+    return std::unique_ptr<HostMemory>(new HostMemory(bytes, device));
+}
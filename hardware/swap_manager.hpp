@@ -0,0 +1,104 @@
+/** @file
+ * Declaration of the hardware::SwapManager class
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _HARDWARE_SWAP_MANAGER_
+#define _HARDWARE_SWAP_MANAGER_
+
+#include "buffers/buffer.hpp"
+#include "synchronization_event.hpp"
+
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace hardware {
+
+    class System;
+
+    /**
+     * Moves the content of buffers to the host and back without blocking the host or the command queue of the device.
+     *
+     * The transfers are issued on a separate command queue per device, such that they overlap with the kernels of
+     * the device. The host memory is pinned and taken from a pool, where it is returned once the content has been
+     * swapped in again. As the transfers of one device are executed in order, host memory returned to the pool can
+     * be handed out again without waiting for pending transfers.
+     */
+    class SwapManager {
+      public:
+        /**
+         * Pinned host memory holding the content of one swapped out buffer.
+         */
+        class HostMemory {
+            friend SwapManager;
+
+          public:
+            HostMemory(size_t bytes, const Device* device);
+            HostMemory& operator=(const HostMemory&) = delete;
+            HostMemory(const HostMemory&)            = delete;
+            HostMemory()                             = delete;
+
+          private:
+            const buffers::Buffer buffer;
+            // declared after the buffer, as the buffer must be unmapped before being released
+            std::unique_ptr<buffers::MappedBufferHandle> mapping;
+            void* const pointer;
+        };
+
+        SwapManager(const System& system);
+        ~SwapManager();
+
+        // non-copyable
+        SwapManager& operator=(const SwapManager&) = delete;
+        SwapManager(const SwapManager&)            = delete;
+        SwapManager()                              = delete;
+
+        /**
+         * Copy the content of the buffer to host memory of the pool.
+         *
+         * The copy starts as soon as the commands enqueued on the device so far have finished. The buffer may be
+         * released right away, OpenCL keeps it alive until the copy finished.
+         */
+        std::unique_ptr<HostMemory> swapOut(const buffers::Buffer* buffer);
+
+        /**
+         * Start copying the content of the host memory into the buffer and return the host memory to the pool.
+         *
+         * The buffer must not be used on the device before the returned event finished, e.g. by enqueueing a barrier
+         * on the device.
+         */
+        SynchronizationEvent swapIn(const buffers::Buffer* buffer, std::unique_ptr<HostMemory> hostMemory);
+
+        /**
+         * Return host memory that is not going to be swapped in anymore to the pool.
+         */
+        void release(std::unique_ptr<HostMemory> hostMemory);
+
+      private:
+        const System& system;
+        std::map<const Device*, cl_command_queue> transferQueues;
+        std::map<const Device*, std::vector<std::unique_ptr<HostMemory>>> pool;
+
+        cl_command_queue getTransferQueue(const Device* device);
+        std::unique_ptr<HostMemory> acquire(size_t bytes, const Device* device);
+    };
+}  // namespace hardware
+
+#endif /* _HARDWARE_SWAP_MANAGER_ */
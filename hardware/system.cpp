@@ -34,10 +34,15 @@
 
 #include "../geometry/latticeGrid.hpp"
 #include "../host_functionality/logger.hpp"
+#include "../klepsydra/klepsydra.hpp"
 #include "device.hpp"
 #include "openClCode.hpp"
+#include "swap_manager.hpp"
+#include "tracer.hpp"
+#include "transfer/traced.hpp"
 #include "transfer/transfer.hpp"
 
+#include <future>
 #include <list>
 #include <sstream>
 #include <stdexcept>
@@ -46,7 +51,8 @@ static std::list<hardware::DeviceInfo> filter_cpus(const std::list<hardware::Dev
 static std::vector<hardware::Device*> init_devices(const std::list<hardware::DeviceInfo>& infos, cl_context context,
                                                    const LatticeGrid lG,
                                                    const hardware::HardwareParametersInterface& hardwareParameters,
-                                                   const hardware::OpenClCode& openClCodeBuilder);
+                                                   const hardware::OpenClCode& openClCodeBuilder,
+                                                   hardware::Tracer* tracer);
 static void setDebugEnvironmentVariables();
 static unsigned int
 checkMaximalNumberOfDevices(cl_uint num_devices, const hardware::HardwareParametersInterface& hardwareParameters);
@@ -55,6 +61,8 @@ hardware::System::System(const hardware::HardwareParametersInterface& systemPara
                          const hardware::code::OpenClKernelParametersInterface& kernelParameters)
     : lG(LatticeGrid(1, LatticeExtents()))
     , transfer_links()
+    , tracer()
+    , swapManager()
     , hardwareParameters(&systemParameters)
     , kernelParameters(&kernelParameters)
     , inputparameters(meta::Inputparameters{0, nullptr})  // <- warning at compilation, fine!
@@ -63,6 +71,9 @@ hardware::System::System(const hardware::HardwareParametersInterface& systemPara
 //       it will disappear (together with the ctor here below) as soon those tests are refactored!
 {
     kernelBuilder = new hardware::OpenClCode(kernelParameters);
+    if (!hardwareParameters->getTraceFilename().empty()) {
+        tracer.reset(new hardware::Tracer(hardwareParameters->getTraceFilename()));
+    }
     setDebugEnvironmentVariables();
     initOpenCLPlatforms();
     initOpenCLContext();
@@ -76,6 +87,8 @@ hardware::System::System(const hardware::HardwareParametersInterface& systemPara
 hardware::System::System(meta::Inputparameters& parameters)
     : lG(LatticeGrid(1, LatticeExtents()))
     , transfer_links()
+    , tracer()
+    , swapManager()
     , hardwareParameters(nullptr)
     , kernelParameters(nullptr)
     , inputparameters(parameters)
@@ -83,6 +96,9 @@ hardware::System::System(meta::Inputparameters& parameters)
     hardwareParameters = new hardware::HardwareParametersImplementation(&parameters);
     kernelParameters   = new hardware::code::OpenClKernelParametersImplementation(parameters);
     kernelBuilder      = new hardware::OpenClCode(*kernelParameters);
+    if (!hardwareParameters->getTraceFilename().empty()) {
+        tracer.reset(new hardware::Tracer(hardwareParameters->getTraceFilename()));
+    }
     setDebugEnvironmentVariables();
     initOpenCLPlatforms();
     initOpenCLContext();
@@ -230,7 +246,7 @@ void hardware::System::initOpenCLDevices()
     LatticeGrid lG(device_infos.size(), LatticeExtents(hardwareParameters->getNs(), hardwareParameters->getNt()));
     logger.info() << "Device grid layout: " << lG;
 
-    devices = init_devices(device_infos, context, lG, *hardwareParameters, *kernelBuilder);
+    devices = init_devices(device_infos, context, lG, *hardwareParameters, *kernelBuilder, tracer.get());
 
     delete[] device_ids;
 
@@ -240,6 +256,10 @@ void hardware::System::initOpenCLDevices()
 hardware::System::~System()
 {
     transfer_links.clear();
+    // pending swaps still use the devices and the context
+    swapManager.reset();
+    // the trace is written now, while the events of the commands can still be evaluated
+    tracer.reset();
 
     for (Device* device : devices) {
         delete device;
@@ -320,7 +340,8 @@ static std::list<hardware::DeviceInfo> filter_cpus(const std::list<hardware::Dev
 static std::vector<hardware::Device*> init_devices(const std::list<hardware::DeviceInfo>& infos, cl_context context,
                                                    const LatticeGrid lG,
                                                    const hardware::HardwareParametersInterface& hardwareParameters,
-                                                   const hardware::OpenClCode& openClCodeBuilder)
+                                                   const hardware::OpenClCode& openClCodeBuilder,
+                                                   hardware::Tracer* const tracer)
 {
     std::vector<hardware::Device*> devices;
     devices.reserve(infos.size());
@@ -328,7 +349,8 @@ static std::vector<hardware::Device*> init_devices(const std::list<hardware::Dev
     unsigned tpos = 0;
     for (auto const info : infos) {
         LatticeGridIndex lI(0, 0, 0, tpos++, lG);
-        devices.push_back(new hardware::Device(context, info.get_id(), lI, lG, openClCodeBuilder, hardwareParameters));
+        devices.push_back(
+            new hardware::Device(context, info.get_id(), lI, lG, openClCodeBuilder, hardwareParameters, tracer));
     }
 
     return devices;
@@ -340,11 +362,46 @@ hardware::Transfer* hardware::System::get_transfer(size_t from, size_t to, unsig
     auto& link         = transfer_links[link_id];
     if (!link.get()) {
         link = hardware::create_transfer(devices[from], devices[to], *this);
+        if (tracer) {
+            link.reset(new hardware::transfer::Traced(std::move(link), *tracer));
+        }
     }
     logger.trace() << "Serving Transfer: " << from << " -> " << to;
     return link.get();
 }
 
+void hardware::System::buildCode(const std::vector<std::function<void(const Device*)>>& codeGetters) const
+{
+    logger.info() << "Building OpenCL code for " << devices.size() << " device(s)...";
+    klepsydra::Monotonic timer;
+
+    std::vector<std::future<void>> builds;
+    for (const auto device : devices) {
+        for (const auto& getCode : codeGetters) {
+            builds.push_back(std::async(std::launch::async, getCode, device));
+        }
+    }
+    // get rethrows exceptions, the destructors of the remaining futures wait for their threads
+    for (auto& build : builds) {
+        build.get();
+    }
+
+    logger.info() << "OpenCL code built in " << timer.getTime() / 1.e6 << " s";
+}
+
+hardware::Tracer* hardware::System::getTracer() const noexcept
+{
+    return tracer.get();
+}
+
+hardware::SwapManager* hardware::System::getSwapManager() const
+{
+    if (!swapManager) {
+        swapManager.reset(new hardware::SwapManager(*this));
+    }
+    return swapManager.get();
+}
+
 cl_context hardware::System::getContext() const
 {
     return context;
@@ -32,6 +32,7 @@
 #include "openClKernelParameters.hpp"
 #include "size_4.hpp"
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <tuple>
@@ -60,6 +61,8 @@ namespace hardware {
     class Device;
     class Transfer;
     class OpenClCode;
+    class Tracer;
+    class SwapManager;
 
     class System {
       public:
@@ -85,8 +88,31 @@ namespace hardware {
         cl_context getContext() const;
 
         Transfer* get_transfer(size_t from, size_t to, unsigned id) const;
+        /**
+         * The tracer recording the execution on this system, nullptr unless a trace file was given.
+         */
+        Tracer* getTracer() const noexcept;
+        /**
+         * The manager moving swappable fields between the devices and pinned host memory, created on first use.
+         */
+        SwapManager* getSwapManager() const;
         cl_platform_id get_platform() const;
 
+        /**
+         * Create the code objects requested by the given getters on all devices, each one in its own thread.
+         *
+         * Otherwise code objects are created on their first use and their programs are built one after the other.
+         * Calling this at startup builds or loads from the binary cache the programs of all devices concurrently.
+         * An exception thrown while building is rethrown once all threads finished.
+         *
+         * Usage:
+         * @code
+         * system.buildCode({std::mem_fn(&hardware::Device::getSpinorCode),
+         *                   std::mem_fn(&hardware::Device::getFermionCode)});
+         * @endcode
+         */
+        void buildCode(const std::vector<std::function<void(const Device*)>>& codeGetters) const;
+
       private:
         std::vector<Device*> devices;
         cl_context context;
@@ -94,6 +120,8 @@ namespace hardware {
         LatticeGrid lG;
 
         mutable std::map<std::tuple<size_t, size_t, unsigned>, std::unique_ptr<Transfer>> transfer_links;
+        std::unique_ptr<Tracer> tracer;
+        mutable std::unique_ptr<SwapManager> swapManager;
 
         void initOpenCLPlatforms();
         void initOpenCLContext();
@@ -76,6 +76,22 @@ BOOST_AUTO_TEST_SUITE(systemSanity)
         allDevicesMustSupportDoublePrecisionForSanityOfSystem(&system);
     }
 
+    BOOST_AUTO_TEST_CASE(buildCodeConcurrently)
+    {
+        const hardware::HardwareParametersMockup hardwareParameters(4, 4);
+        const hardware::code::OpenClKernelParametersMockup kernelParameters(4, 4);
+        hardware::System system(hardwareParameters, kernelParameters);
+        BOOST_REQUIRE_NO_THROW(system.buildCode({std::mem_fn(&hardware::Device::getRealCode),
+                                                 std::mem_fn(&hardware::Device::getComplexCode),
+                                                 std::mem_fn(&hardware::Device::getBufferCode)}));
+        for (hardware::Device* device : system.get_devices()) {
+            // code objects already built are handed out again
+            const hardware::code::Real* realCode = device->getRealCode();
+            BOOST_REQUIRE(realCode);
+            BOOST_REQUIRE_EQUAL(device->getRealCode(), realCode);
+        }
+    }
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(devices)
@@ -0,0 +1,236 @@
+/** @file
+ * Implementation of the hardware::Tracer and hardware::TracePhase classes
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tracer.hpp"
+
+#include "../host_functionality/logger.hpp"
+#include "system.hpp"
+
+#include <fstream>
+#include <sstream>
+
+static std::string get_kernel_name(const cl_kernel kernel);
+static std::string escape(const std::string& text);
+
+/**
+ * The host process of the trace, the devices follow as processes 1, 2, ...
+ */
+static const unsigned host_process    = 0;
+static const unsigned kernel_thread   = 0;
+static const unsigned transfer_thread = 1;
+
+hardware::Tracer::Tracer(const std::string& filenameIn)
+    : filename(filenameIn)
+    , start(std::chrono::steady_clock::now())
+    , mutex()
+    , pendingCommands()
+    , records()
+    , deviceNames()
+    , clockOffsets()
+    , kernelNames()
+    , unprofiledCommands(0)
+{
+    logger.info() << "Tracing the execution to " << filename;
+}
+
+hardware::Tracer::~Tracer()
+{
+    try {
+        for (const auto& command : pendingCommands) {
+            command.event.wait();
+            resolveCommand(command);
+        }
+        pendingCommands.clear();
+        write();
+    } catch (...) {
+        logger.error() << "Failed to write the trace to " << filename;
+    }
+}
+
+uint64_t hardware::Tracer::getTime() const
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+void hardware::Tracer::setDeviceName(const unsigned device, const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    deviceNames[device] = name;
+}
+
+void hardware::Tracer::addKernel(const unsigned device, const cl_kernel kernel, const SynchronizationEvent& event,
+                                 const size_t globalThreads, const size_t localThreads, const uint64_t enqueueTime)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto name = kernelNames.find(kernel);
+    if (name == kernelNames.end()) {
+        name = kernelNames.emplace(kernel, get_kernel_name(kernel)).first;
+    }
+    std::ostringstream args;
+    args << "\"global_size\": " << globalThreads << ", \"local_size\": " << localThreads;
+    addCommand(Command{device, true, name->second, event, args.str(), enqueueTime});
+}
+
+void hardware::Tracer::addTransfer(const unsigned device, const std::string& name, const SynchronizationEvent& event,
+                                   const size_t bytes, const unsigned from, const unsigned to,
+                                   const uint64_t enqueueTime)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::ostringstream args;
+    args << "\"bytes\": " << bytes << ", \"from_device\": " << from << ", \"to_device\": " << to;
+    addCommand(Command{device, false, name, event, args.str(), enqueueTime});
+}
+
+void hardware::Tracer::addPhase(const std::string& name, const uint64_t begin, const uint64_t end)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    records.push_back(Record{name, "phase", host_process, 0, begin / 1.e3, (end - begin) / 1.e3, ""});
+}
+
+void hardware::Tracer::addCommand(Command&& command)
+{
+    if (!command.event.is_valid()) {
+        ++unprofiledCommands;
+        return;
+    }
+    pendingCommands.push_back(std::move(command));
+    if (pendingCommands.size() >= maxPendingCommands) {
+        resolveFinishedCommands();
+    }
+}
+
+void hardware::Tracer::resolveFinishedCommands()
+{
+    std::vector<Command> stillPending;
+    for (const auto& command : pendingCommands) {
+        if (command.event.is_finished()) {
+            resolveCommand(command);
+        } else {
+            stillPending.push_back(command);
+        }
+    }
+    pendingCommands.swap(stillPending);
+}
+
+void hardware::Tracer::resolveCommand(const Command& command)
+{
+    const cl_profiling_info timePoints[] = {CL_PROFILING_COMMAND_QUEUED, CL_PROFILING_COMMAND_SUBMIT,
+                                            CL_PROFILING_COMMAND_START, CL_PROFILING_COMMAND_END};
+    cl_ulong times[4];
+    for (size_t i = 0; i < 4; ++i) {
+        // e.g. user events or commands on queues without profiling carry no timestamps
+        if (clGetEventProfilingInfo(command.event.raw(), timePoints[i], sizeof(cl_ulong), &times[i], NULL) !=
+            CL_SUCCESS) {
+            ++unprofiledCommands;
+            return;
+        }
+    }
+
+    auto offset = clockOffsets.find(command.device);
+    if (offset == clockOffsets.end()) {
+        offset = clockOffsets
+                     .emplace(command.device,
+                              static_cast<int64_t>(command.enqueueTime) - static_cast<int64_t>(times[0]))
+                     .first;
+    }
+    auto toHostMicroseconds = [&offset](const cl_ulong deviceTime) {
+        return (static_cast<int64_t>(deviceTime) + offset->second) / 1.e3;
+    };
+
+    std::ostringstream args;
+    args << command.args << ", \"queued\": " << toHostMicroseconds(times[0])
+         << ", \"submit\": " << toHostMicroseconds(times[1]) << ", \"enqueued\": " << command.enqueueTime / 1.e3;
+    records.push_back(Record{command.name, command.isKernel ? "kernel" : "transfer", command.device + 1,
+                             command.isKernel ? kernel_thread : transfer_thread, toHostMicroseconds(times[2]),
+                             (times[3] - times[2]) / 1.e3, args.str()});
+}
+
+void hardware::Tracer::write()
+{
+    std::ofstream file(filename);
+    if (!file) {
+        logger.error() << "Could not open " << filename << " to write the trace to.";
+        return;
+    }
+    file.precision(3);
+    file << std::fixed;
+
+    file << "{\"traceEvents\": [\n";
+    file << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << host_process
+         << ", \"args\": {\"name\": \"host\"}}";
+    for (const auto& device : deviceNames) {
+        file << ",\n{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << device.first + 1
+             << ", \"args\": {\"name\": \"device " << device.first << ": " << escape(device.second) << "\"}}";
+        file << ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": " << device.first + 1
+             << ", \"tid\": " << kernel_thread << ", \"args\": {\"name\": \"kernels\"}}";
+        file << ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": " << device.first + 1
+             << ", \"tid\": " << transfer_thread << ", \"args\": {\"name\": \"transfers\"}}";
+    }
+    for (const auto& record : records) {
+        file << ",\n{\"name\": \"" << escape(record.name) << "\", \"cat\": \"" << record.category
+             << "\", \"ph\": \"X\", \"pid\": " << record.process << ", \"tid\": " << record.thread
+             << ", \"ts\": " << record.begin << ", \"dur\": " << record.duration << ", \"args\": {" << record.args
+             << "}}";
+    }
+    file << "\n],\n\"displayTimeUnit\": \"ms\"}\n";
+
+    logger.info() << "Wrote a trace of " << records.size() << " events to " << filename;
+    if (unprofiledCommands) {
+        logger.warn() << unprofiledCommands << " commands could not be traced as they carry no profiling information.";
+    }
+}
+
+hardware::TracePhase::TracePhase(const System& system, const std::string& nameIn)
+    : tracer(system.getTracer()), name(nameIn), begin(tracer ? tracer->getTime() : 0)
+{
+}
+
+hardware::TracePhase::~TracePhase()
+{
+    if (tracer) {
+        tracer->addPhase(name, begin, tracer->getTime());
+    }
+}
+
+static std::string get_kernel_name(const cl_kernel kernel)
+{
+    size_t bytesInKernelName;
+    if (clGetKernelInfo(kernel, CL_KERNEL_FUNCTION_NAME, 0, NULL, &bytesInKernelName) != CL_SUCCESS) {
+        return "unknown kernel";
+    }
+    std::vector<char> kernelName(bytesInKernelName);
+    if (clGetKernelInfo(kernel, CL_KERNEL_FUNCTION_NAME, bytesInKernelName, kernelName.data(), NULL) != CL_SUCCESS) {
+        return "unknown kernel";
+    }
+    return std::string(kernelName.data());
+}
+
+static std::string escape(const std::string& text)
+{
+    std::string escaped;
+    for (const char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
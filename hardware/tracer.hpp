@@ -0,0 +1,134 @@
+/** @file
+ * Declaration of the hardware::Tracer and hardware::TracePhase classes
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _HARDWARE_TRACER_
+#define _HARDWARE_TRACER_
+
+#include "synchronization_event.hpp"
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace hardware {
+
+    class System;
+
+    /**
+     * Recorder of a timeline of the commands executed on the devices and of the algorithm phases on the host.
+     *
+     * For each kernel execution and each transfer the OpenCL profiling timestamps (queued, submit, start and end)
+     * are recorded together with the device and either the work sizes or the number of bytes moved. The events are
+     * only queried once they are complete, hence tracing does not synchronize the command queues. The device
+     * timestamps are mapped onto the host clock by the offset between the enqueueing on the host and the queued
+     * timestamp of the first command recorded on each device.
+     *
+     * On destruction the timeline is written to the given file in the Chrome trace event format, which can be
+     * inspected with chrome://tracing or Perfetto.
+     */
+    class Tracer {
+      public:
+        Tracer(const std::string& filename);
+        ~Tracer();
+        Tracer& operator=(const Tracer&) = delete;
+        Tracer(const Tracer&)            = delete;
+        Tracer()                         = delete;
+
+        /**
+         * The host time in nanoseconds since the creation of the tracer.
+         */
+        uint64_t getTime() const;
+
+        void setDeviceName(const unsigned device, const std::string& name);
+        void addKernel(const unsigned device, const cl_kernel kernel, const SynchronizationEvent& event,
+                       const size_t globalThreads, const size_t localThreads, const uint64_t enqueueTime);
+        void addTransfer(const unsigned device, const std::string& name, const SynchronizationEvent& event,
+                         const size_t bytes, const unsigned from, const unsigned to, const uint64_t enqueueTime);
+        void addPhase(const std::string& name, const uint64_t begin, const uint64_t end);
+
+        /**
+         * Number of recorded commands after which the complete ones are evaluated, such that their events can be
+         * released by the OpenCL implementation.
+         */
+        static constexpr size_t maxPendingCommands = 1024;
+
+      private:
+        struct Command {
+            unsigned device;
+            bool isKernel;
+            std::string name;
+            SynchronizationEvent event;
+            std::string args;
+            uint64_t enqueueTime;
+        };
+        struct Record {
+            std::string name;
+            std::string category;
+            unsigned process;
+            unsigned thread;
+            double begin;     // in microseconds
+            double duration;  // in microseconds
+            std::string args;
+        };
+
+        const std::string filename;
+        const std::chrono::steady_clock::time_point start;
+        std::mutex mutex;
+        std::vector<Command> pendingCommands;
+        std::vector<Record> records;
+        std::map<unsigned, std::string> deviceNames;
+        std::map<unsigned, int64_t> clockOffsets;
+        std::map<cl_kernel, std::string> kernelNames;
+        size_t unprofiledCommands;
+
+        void addCommand(Command&& command);
+        void resolveCommand(const Command& command);
+        void resolveFinishedCommands();
+        void write();
+    };
+
+    /**
+     * Scope guard recording an algorithm phase in the tracer of the given system, if tracing is enabled.
+     *
+     * Usage:
+     * @code
+     * hardware::TracePhase phase(system, "cg");
+     * @endcode
+     */
+    class TracePhase {
+      public:
+        TracePhase(const System& system, const std::string& name);
+        ~TracePhase();
+        TracePhase& operator=(const TracePhase&) = delete;
+        TracePhase(const TracePhase&)            = delete;
+        TracePhase()                             = delete;
+
+      private:
+        Tracer* const tracer;
+        const std::string name;
+        const uint64_t begin;
+    };
+}  // namespace hardware
+
+#endif /* _HARDWARE_TRACER_ */
@@ -0,0 +1,55 @@
+/** @file
+ * Unit test for the hardware::Tracer class
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// use the boost test framework
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE hardware::Tracer
+#include "tracer.hpp"
+
+#include <boost/test/unit_test.hpp>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+BOOST_AUTO_TEST_CASE(write_phases)
+{
+    const std::string filename = "tracer_test.json";
+    {
+        hardware::Tracer tracer(filename);
+        const uint64_t begin = tracer.getTime();
+        const uint64_t end   = tracer.getTime();
+        BOOST_CHECK_LE(begin, end);
+        tracer.addPhase("outer", begin, end + 2000);
+        tracer.addPhase("inner \"quoted\"", begin + 1000, end + 1500);
+    }
+
+    std::ifstream file(filename);
+    BOOST_REQUIRE(file);
+    std::stringstream content;
+    content << file.rdbuf();
+    const std::string trace = content.str();
+
+    BOOST_CHECK_EQUAL(trace.find("{\"traceEvents\": ["), 0);
+    BOOST_CHECK_NE(trace.find("\"name\": \"outer\", \"cat\": \"phase\", \"ph\": \"X\""), std::string::npos);
+    BOOST_CHECK_NE(trace.find("\"name\": \"inner \\\"quoted\\\"\""), std::string::npos);
+    BOOST_CHECK_NE(trace.find("\"displayTimeUnit\": \"ms\"}"), std::string::npos);
+    std::remove(filename.c_str());
+}
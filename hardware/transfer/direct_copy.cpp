@@ -0,0 +1,91 @@
+/** @file
+ * Implementation of the direct device-to-device opencl transfer method
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "direct_copy.hpp"
+
+#include "../../executables/exceptions.hpp"
+#include "../device.hpp"
+
+#include <stdexcept>
+
+hardware::transfer::DirectCopy::DirectCopy(hardware::Device* const from, hardware::Device* const to)
+    : Transfer(from, to), src_cache(), load_event(), dump_event(), active_size(0)
+{
+    // nothing to do
+}
+
+hardware::transfer::DirectCopy::~DirectCopy()
+{
+    // nothing to do
+}
+
+hardware::SynchronizationEvent hardware::transfer::DirectCopy::load(const hardware::buffers::Buffer* orig,
+                                                                    const size_t* src_origin, const size_t* region,
+                                                                    size_t src_row_pitch, size_t src_slice_pitch,
+                                                                    const hardware::SynchronizationEvent& event)
+{
+    active_size                = region[0] * region[1] * region[2];
+    auto const transfer_buffer = get_src_cache(active_size);
+
+    // the staging buffer may only be overwritten once the previous dump has read it
+    const size_t transfer_buffer_origin[] = {0, 0, 0};
+    load_event = copyDataRect(get_src_device(), transfer_buffer, orig, transfer_buffer_origin, src_origin, region, 0, 0,
+                              src_row_pitch, src_slice_pitch, {load_event, dump_event, event});
+    get_src_device()->flush();
+
+    return load_event;
+}
+
+hardware::SynchronizationEvent hardware::transfer::DirectCopy::transfer()
+{
+    // nothing to do, the destination device reads the staging buffer when dumping
+    return load_event;
+}
+
+hardware::SynchronizationEvent hardware::transfer::DirectCopy::dump(const hardware::buffers::Buffer* dest,
+                                                                    const size_t* dest_origin, const size_t* region,
+                                                                    size_t dest_row_pitch, size_t dest_slice_pitch,
+                                                                    const hardware::SynchronizationEvent& event)
+{
+    if (region[0] * region[1] * region[2] != active_size) {
+        logger.error() << "Buffer requested to be dumped has a different size than the last buffer loaded";
+        throw std::logic_error("Buffer requested to be dumped has a different size than the last buffer loaded");
+    }
+    auto const transfer_buffer = get_src_cache(active_size);
+
+    const size_t transfer_buffer_origin[] = {0, 0, 0};
+    auto* const device                    = get_dest_device();
+    dump_event = copyDataRect(device, dest, transfer_buffer, dest_origin, transfer_buffer_origin, region, dest_row_pitch,
+                              dest_slice_pitch, 0, 0, {load_event, dump_event, event});
+    device->flush();
+
+    return dump_event;
+}
+
+hardware::buffers::Buffer* hardware::transfer::DirectCopy::get_src_cache(size_t const buffer_size)
+{
+    auto& transfer_buffer_handle = src_cache[buffer_size];
+    if (!(bool)transfer_buffer_handle) {
+        transfer_buffer_handle = std::unique_ptr<hardware::buffers::Buffer>(
+            new hardware::buffers::Buffer(buffer_size, get_src_device(), false));
+    }
+    return transfer_buffer_handle.get();
+}
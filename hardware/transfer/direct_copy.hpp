@@ -0,0 +1,68 @@
+/** @file
+ * Interface for the direct device-to-device opencl transfer method
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _HARDWARE_TRANSFER_DIRECT_COPY_HPP_
+#define _HARDWARE_TRANSFER_DIRECT_COPY_HPP_
+
+#include "transfer.hpp"
+
+#include <map>
+#include <memory>
+
+namespace hardware {
+
+    namespace transfer {
+
+        /**
+         * A transfer method copying from the source device straight into the destination buffer.
+         *
+         * The load copies the region into a staging buffer on the source device, in order with the commands of the
+         * source device. Hence the source region may be modified right after the load. As all devices share one
+         * context, the dump then reads the staging buffer with a single clEnqueueCopyBufferRect on the destination
+         * device, without any copy on the destination device or via the host.
+         */
+        class DirectCopy : public Transfer {
+          public:
+            DirectCopy(hardware::Device* from, hardware::Device* to);
+            virtual ~DirectCopy();
+
+            SynchronizationEvent load(const hardware::buffers::Buffer* orig, const size_t* src_origin,
+                                      const size_t* region, size_t src_row_pitch, size_t src_slice_pitch,
+                                      const hardware::SynchronizationEvent& event) override;
+            SynchronizationEvent transfer() override;
+            SynchronizationEvent dump(const hardware::buffers::Buffer* dest, const size_t* dest_origin,
+                                      const size_t* region, size_t dest_row_pitch, size_t dest_slice_pitch,
+                                      const hardware::SynchronizationEvent& event) override;
+
+          private:
+            std::map<size_t, std::unique_ptr<hardware::buffers::Buffer>> src_cache;
+            hardware::SynchronizationEvent load_event;
+            hardware::SynchronizationEvent dump_event;
+            size_t active_size;
+
+            hardware::buffers::Buffer* get_src_cache(size_t const size);
+        };
+
+    }  // namespace transfer
+
+}  // namespace hardware
+
+#endif
@@ -0,0 +1,73 @@
+/** @file
+ * Implementation of the tracing wrapper of a transfer method
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "traced.hpp"
+
+#include "../device.hpp"
+
+namespace {
+    size_t get_region_bytes(const size_t* region);
+}
+
+hardware::transfer::Traced::Traced(std::unique_ptr<Transfer> wrappedIn, hardware::Tracer& tracerIn)
+    : Transfer(wrappedIn->get_src_device(), wrappedIn->get_dest_device())
+    , wrapped(std::move(wrappedIn))
+    , tracer(tracerIn)
+    , from(get_src_device()->getGridPos().globalIndex)
+    , to(get_dest_device()->getGridPos().globalIndex)
+{
+}
+
+hardware::transfer::Traced::~Traced()
+{
+    // nothing to do
+}
+
+hardware::SynchronizationEvent hardware::transfer::Traced::load(const hardware::buffers::Buffer* orig,
+                                                                const size_t* src_origin, const size_t* region,
+                                                                size_t src_row_pitch, size_t src_slice_pitch,
+                                                                const hardware::SynchronizationEvent& event)
+{
+    const uint64_t enqueueTime = tracer.getTime();
+    auto const load_event      = wrapped->load(orig, src_origin, region, src_row_pitch, src_slice_pitch, event);
+    tracer.addTransfer(from, "transfer_load", load_event, get_region_bytes(region), from, to, enqueueTime);
+    return load_event;
+}
+
+hardware::SynchronizationEvent hardware::transfer::Traced::transfer()
+{
+    return wrapped->transfer();
+}
+
+hardware::SynchronizationEvent hardware::transfer::Traced::dump(const hardware::buffers::Buffer* dest,
+                                                                const size_t* dest_origin, const size_t* region,
+                                                                size_t dest_row_pitch, size_t dest_slice_pitch,
+                                                                const hardware::SynchronizationEvent& event)
+{
+    const uint64_t enqueueTime = tracer.getTime();
+    auto const dump_event      = wrapped->dump(dest, dest_origin, region, dest_row_pitch, dest_slice_pitch, event);
+    tracer.addTransfer(to, "transfer_dump", dump_event, get_region_bytes(region), from, to, enqueueTime);
+    return dump_event;
+}
+
+namespace {
+    size_t get_region_bytes(const size_t* const region) { return region[0] * region[1] * region[2]; }
+}  // namespace
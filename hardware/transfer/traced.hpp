@@ -0,0 +1,61 @@
+/** @file
+ * Interface for the tracing wrapper of a transfer method
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _HARDWARE_TRANSFER_TRACED_HPP_
+#define _HARDWARE_TRANSFER_TRACED_HPP_
+
+#include "../tracer.hpp"
+#include "transfer.hpp"
+
+#include <memory>
+
+namespace hardware {
+
+    namespace transfer {
+
+        /**
+         * A transfer forwarding to another transfer method and recording its load and dump phases in a tracer.
+         */
+        class Traced : public Transfer {
+          public:
+            Traced(std::unique_ptr<Transfer> wrapped, hardware::Tracer& tracer);
+            virtual ~Traced();
+
+            SynchronizationEvent load(const hardware::buffers::Buffer* orig, const size_t* src_origin,
+                                      const size_t* region, size_t src_row_pitch, size_t src_slice_pitch,
+                                      const hardware::SynchronizationEvent& event) override;
+            SynchronizationEvent transfer() override;
+            SynchronizationEvent dump(const hardware::buffers::Buffer* dest, const size_t* dest_origin,
+                                      const size_t* region, size_t dest_row_pitch, size_t dest_slice_pitch,
+                                      const hardware::SynchronizationEvent& event) override;
+
+          private:
+            const std::unique_ptr<Transfer> wrapped;
+            hardware::Tracer& tracer;
+            const unsigned from;
+            const unsigned to;
+        };
+
+    }  // namespace transfer
+
+}  // namespace hardware
+
+#endif
@@ -27,8 +27,10 @@
 #include "../../host_functionality/logger.hpp"
 #include "../../klepsydra/klepsydra.hpp"
 #include "../device.hpp"
+#include "../system.hpp"
 #include "async_ocl_copy.hpp"
 #include "dgma.hpp"
+#include "direct_copy.hpp"
 #include "ocl_copy.hpp"
 
 #include <array>
@@ -41,14 +43,45 @@
 static float benchmark(hardware::Transfer*);
 #endif
 
+static std::unique_ptr<hardware::Transfer>
+create_standard_transfer(hardware::Device* const src, hardware::Device* const dest, hardware::System const& system)
+{
+#ifdef ASYNC_HALO_UPDATES
+    return std::unique_ptr<hardware::Transfer>(new hardware::transfer::AsyncOclCopy(src, dest, system));
+#else
+    return std::unique_ptr<hardware::Transfer>(new hardware::transfer::OclCopy(src, dest));
+#endif
+}
+
 std::unique_ptr<hardware::Transfer>
 hardware::create_transfer(hardware::Device* const src, hardware::Device* const dest, hardware::System const& system)
 {
-#ifdef ASYNC_HALO_UPDATES
-    std::unique_ptr<hardware::Transfer> standard_transfer(new transfer::AsyncOclCopy(src, dest, system));
+    switch (system.getHardwareParameters()->getHaloTransferMethod()) {
+        case common::ocl_copy:
+            return std::unique_ptr<hardware::Transfer>(new transfer::OclCopy(src, dest));
+        case common::async_ocl_copy:
+            return std::unique_ptr<hardware::Transfer>(new transfer::AsyncOclCopy(src, dest, system));
+        case common::direct_copy:
+            return std::unique_ptr<hardware::Transfer>(new transfer::DirectCopy(src, dest));
+        case common::dgma:
+#ifdef CL_MEM_BUS_ADDRESSABLE_AMD
+            try {
+                return std::unique_ptr<hardware::Transfer>(new transfer::DirectGMA(src, dest, system));
+            } catch (hardware::transfer::DGMAUnsupported) {
+                logger.warn() << "DirectGMA is unavailable from " << src->getGridPos() << " to " << dest->getGridPos()
+                              << ". Falling back to standard transfer methods.";
+            }
 #else
-    std::unique_ptr<hardware::Transfer> standard_transfer(new transfer::OclCopy(src, dest));
+            logger.warn() << "DirectGMA is not supported by the OpenCL headers. Falling back to standard transfer "
+                             "methods.";
 #endif
+            return create_standard_transfer(src, dest, system);
+        default:
+            break;
+    }
+
+    // automatic selection
+    std::unique_ptr<hardware::Transfer> standard_transfer = create_standard_transfer(src, dest, system);
 // required headers for DirectGMA might be missing
 // in that case it is unavailable
 #ifndef CL_MEM_BUS_ADDRESSABLE_AMD
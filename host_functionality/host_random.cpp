@@ -24,13 +24,38 @@
 #include "../executables/exceptions.hpp"
 #include "logger.hpp"
 
+#include <cstdint>
 #include <cstdio>
 
 #ifdef USE_PRNG_RANLUX
 extern "C" {
 #    include "../ranlux/ranlxd.h"
 }
-#endif  // USE_PRNG_RANLUX
+#elif defined(USE_PRNG_PHILOX)
+/**
+ * Philox4x32-10 as the device generator in ocl_kernel/philox.cl, the state being the key and the block counter.
+ * The host stream uses the seed as key, the devices get the seed increased by one per device.
+ */
+static uint32_t philoxState[4] = {0, 0, 0, 0};
+#endif  // USE_PRNG_XXX
+
+void philox4x32_10(uint32_t ctr[4], uint32_t key0, uint32_t key1)
+{
+    for (int round = 0; round < 10; round++) {
+        if (round > 0) {
+            key0 += 0x9E3779B9u;
+            key1 += 0xBB67AE85u;
+        }
+        const uint64_t product0 = static_cast<uint64_t>(0xD2511F53u) * ctr[0];
+        const uint64_t product1 = static_cast<uint64_t>(0xCD9E8D57u) * ctr[2];
+        const uint32_t hi0      = product0 >> 32;
+        const uint32_t hi1      = product1 >> 32;
+        ctr[0]                  = hi1 ^ ctr[1] ^ key0;
+        ctr[1]                  = static_cast<uint32_t>(product1);
+        ctr[2]                  = hi0 ^ ctr[3] ^ key1;
+        ctr[3]                  = static_cast<uint32_t>(product0);
+    }
+}
 
 /** Seed for the singleton random number generator rnd */
 const unsigned long long int seed = 500000;
@@ -40,6 +65,11 @@ void prng_init(uint32_t seed)
 #ifdef USE_PRNG_RANLUX
     // use maximum luxury level, should not be performance critical anyways
     rlxd_init(2, seed);
+#elif defined(USE_PRNG_PHILOX)
+    philoxState[0] = seed;
+    philoxState[1] = 0;
+    philoxState[2] = 0;
+    philoxState[3] = 0;
 #else  // USE_PRNG_XXX
 #    error No implemented PRNG chosen
 #endif  // USE_PRNG_XXX
@@ -51,6 +81,15 @@ double prng_double()
     double tmp;
     ranlxd(&tmp, 1);
     return tmp;
+#elif defined(USE_PRNG_PHILOX)
+    uint32_t block[4] = {philoxState[2], philoxState[3], 0, 0};
+    philox4x32_10(block, philoxState[0], philoxState[1]);
+    if (++philoxState[2] == 0) {
+        ++philoxState[3];
+    }
+    // 53 random bits, shifted by half a step to exclude 0
+    const uint64_t bits = (static_cast<uint64_t>(block[0] >> 5) << 26) | (block[1] >> 6);
+    return (bits + 0.5) / 9007199254740992.;
 #else  // USE_PRNG_XXX
 #    error No implemented PRNG chosen
 #endif  // USE_PRNG_XXX
@@ -60,6 +99,8 @@ int prng_size()
 {
 #ifdef USE_PRNG_RANLUX
     return rlxd_size();
+#elif defined(USE_PRNG_PHILOX)
+    return 4;
 #else  // USE_PRNG_XXX
 #    error No implemented PRNG chosen
 #endif  // USE_PRNG_XXX
@@ -69,6 +110,10 @@ void prng_get(int* buf)
 {
 #ifdef USE_PRNG_RANLUX
     rlxd_get(buf);
+#elif defined(USE_PRNG_PHILOX)
+    for (int i = 0; i < 4; i++) {
+        buf[i] = static_cast<int>(philoxState[i]);
+    }
 #else  // USE_PRNG_XXX
 #    error No implemented PRNG chosen
 #endif  // USE_PRNG_XXX
@@ -78,6 +123,10 @@ void prng_set(int* buf)
 {
 #ifdef USE_PRNG_RANLUX
     rlxd_reset(buf);
+#elif defined(USE_PRNG_PHILOX)
+    for (int i = 0; i < 4; i++) {
+        philoxState[i] = static_cast<uint32_t>(buf[i]);
+    }
 #else  // USE_PRNG_XXX
 #    error No implemented PRNG chosen
 #endif  // USE_PRNG_XXX
@@ -100,6 +149,15 @@ void SU2Update(hmc_float dst[su2_entries], const hmc_float alpha)
     ranlxd(tmp, 2);
     hmc_float phi   = 2. * PI * tmp[0];
     hmc_float theta = asin(2. * tmp[1] - 1.);
+#elif defined(USE_PRNG_PHILOX)
+    do {
+        const double tmp[4] = {prng_double(), prng_double(), prng_double(), prng_double()};
+        delta = -log(tmp[0]) / alpha * pow(cos(2. * PI * tmp[1]), 2.) - log(tmp[2]) / alpha;
+        a0    = 1. - delta;
+        eta   = tmp[3];
+    } while ((1. - 0.5 * delta) < eta * eta);
+    hmc_float phi   = 2. * PI * prng_double();
+    hmc_float theta = asin(2. * prng_double() - 1.);
 #else  // USE_PRNG_XXX
 #    error No implemented PRNG chosen
 #endif  // USE_PRNG_XXX
@@ -129,6 +187,9 @@ void gaussianNormalPair(hmc_float* z1, hmc_float* z2)
     ranlxd(tmp, 2);
     hmc_float u1 = 1.0 - tmp[0];
     hmc_float u2 = 1.0 - tmp[1];
+#elif defined(USE_PRNG_PHILOX)
+    hmc_float u1 = 1.0 - prng_double();
+    hmc_float u2 = 1.0 - prng_double();
 #else  // USE_PRNG_XXX
 #    error No implemented PRNG chosen
 #endif  // USE_PRNG_XXX
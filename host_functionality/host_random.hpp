@@ -45,6 +45,16 @@ void prng_init(uint32_t seed);
  */
 double prng_double();
 
+/**
+ * Compute one block of the Philox4x32-10 generator, the same as philox4x32_10 in ocl_kernel/philox.cl.
+ * It is the generator of the Philox PRNG backend, but it is available with any backend.
+ *
+ * @param[in,out] ctr The counter, replaced by the four random words of the block
+ * @param[in] key0 First word of the key
+ * @param[in] key1 Second word of the key
+ */
+void philox4x32_10(uint32_t ctr[4], uint32_t key0, uint32_t key1);
+
 int prng_size();
 
 void prng_get(int* buf);
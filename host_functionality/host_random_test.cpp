@@ -0,0 +1,72 @@
+/** @file
+ * Unit test of the host PRNG
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "host_random.hpp"
+
+// use the boost test framework
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE host_random
+#include <boost/test/unit_test.hpp>
+
+#include <array>
+#include <cstdint>
+
+/*
+ * Known answers of Philox4x32-10 as given in the kat_vectors file of the Random123 library.
+ */
+static void checkPhiloxKnownAnswer(std::array<uint32_t, 4> counter, const uint32_t key0, const uint32_t key1,
+                                   const std::array<uint32_t, 4> reference)
+{
+    philox4x32_10(counter.data(), key0, key1);
+    BOOST_CHECK_EQUAL_COLLECTIONS(counter.begin(), counter.end(), reference.begin(), reference.end());
+}
+
+BOOST_AUTO_TEST_SUITE(philox)
+
+    BOOST_AUTO_TEST_CASE(known_answer_zero)
+    {
+        checkPhiloxKnownAnswer({{0x00000000, 0x00000000, 0x00000000, 0x00000000}}, 0x00000000, 0x00000000,
+                               {{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}});
+    }
+
+    BOOST_AUTO_TEST_CASE(known_answer_ones)
+    {
+        checkPhiloxKnownAnswer({{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}}, 0xffffffff, 0xffffffff,
+                               {{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}});
+    }
+
+    BOOST_AUTO_TEST_CASE(known_answer_pi)
+    {
+        checkPhiloxKnownAnswer({{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}}, 0xa4093822, 0x299f31d0,
+                               {{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}});
+    }
+
+#ifdef USE_PRNG_PHILOX
+    BOOST_AUTO_TEST_CASE(host_stream)
+    {
+        // the host stream uses the seed as key and starts from the zero counter, see the first known answer
+        prng_init(0);
+        const uint64_t bits = (static_cast<uint64_t>(0x6627e8d5u >> 5) << 26) | (0xe169c58du >> 6);
+        BOOST_CHECK_EQUAL(prng_double(), (bits + 0.5) / 9007199254740992.);
+    }
+#endif  // USE_PRNG_PHILOX
+
+BOOST_AUTO_TEST_SUITE_END()
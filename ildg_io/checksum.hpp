@@ -63,6 +63,15 @@ class Checksum {
         sumb ^= work << rank31 | work >> (32 - rank31);
     }
 
+    /**
+     * Add the sites of another checksum, e.g. one accumulated in parallel over a disjoint set of sites
+     */
+    inline void merge(const Checksum& other) noexcept
+    {
+        suma ^= other.suma;
+        sumb ^= other.sumb;
+    }
+
     bool operator==(const Checksum& other) { return suma == other.suma && sumb == other.sumb; }
 
     bool operator!=(const Checksum& other) { return suma != other.suma || sumb != other.sumb; }
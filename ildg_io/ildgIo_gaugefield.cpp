@@ -26,6 +26,10 @@
 #include "../meta/util.hpp"
 #include "../meta/version.hpp"
 
+#include <algorithm>
+#include <future>
+#include <thread>
+
 using namespace ildgIo;
 
 void checkLimeFileForFieldType(std::string fieldTypeIn) throw(std::logic_error)
@@ -48,19 +52,15 @@ IldgIoReader_gaugefield::IldgIoReader_gaugefield(std::string sourceFilenameIn, c
     if (limeFileProp.numberOfBinaryDataEntries >= 1) {
         *destination = new Matrixsu3[parametersIn->getNumberOfElements()];
 
-        char* gf_ildg;
-
         checkLimeFileForFieldType(parameters.field);
         size_t numberOfBytes = sizeOfGaugefieldBuffer(parameters.num_entries);
 
-        extractDataFromLimeFile(&gf_ildg, numberOfBytes);
-
-        Checksum checksum = ildgIo::calculate_ildg_checksum(gf_ildg, parameters.getSizeInBytes(), parametersIn->getNt(),
-                                                            parametersIn->getNs());
+        // the file is read directly from the page cache, the conversion is the only pass over the data
+        const boost::interprocess::mapped_region gf_ildg = mapBinaryDataFromLimeFile(numberOfBytes);
 
-        copy_gaugefield_from_ildg_format(*destination, gf_ildg, parameters.num_entries, *parametersIn);
-
-        delete[] gf_ildg;
+        const Checksum checksum =
+            copy_gaugefield_from_ildg_format(*destination, static_cast<const char*>(gf_ildg.get_address()),
+                                             parameters.num_entries, *parametersIn);
 
         parameters.checkAgainstChecksum(checksum, parametersIn->ignoreChecksumErrors(), sourceFilenameIn);
         parameters.checkAgainstInputparameters(parametersIn);
@@ -155,35 +155,36 @@ static hmc_float make_float_from_big_endian(const char* in)
     return result;
 }
 
-void ildgIo::copy_gaugefield_from_ildg_format(Matrixsu3* gaugefield, char* gaugefield_tmp, int expectedNumberOfEntries,
-                                              const IldgIoParameters& parameters)
+/**
+ * Convert the timeslices [tBegin, tEnd) of the ILDG data to our format, accumulating their checksum on the way.
+ * Every site is touched exactly once, hence this is the only pass over the (possibly memory mapped) file data.
+ */
+static Checksum copy_timeslices_from_ildg_format(Matrixsu3* gaugefield, const char* gaugefield_tmp, const int tBegin,
+                                                 const int tEnd, const LatticeExtents lE)
 {
-    // little check if arrays are big enough
-    if ((int)(parameters.getNumberOfElements() * NC * NC * 2) != expectedNumberOfEntries) {
-        std::stringstream errstr;
-        errstr << "Error in setting gaugefield to source values!!\nCheck global settings!!";
-        throw Print_Error_Message(errstr.str(), __FILE__, __LINE__);
-    }
+    const size_t NSPACE    = lE.getNs();
+    const size_t elem_size = NDIM * sizeof(Matrixsu3);
 
-    const size_t NSPACE = parameters.getNs();
-    int cter            = 0;
-    for (int t = 0; t < parameters.getNt(); t++) {
+    Checksum checksum;
+    for (int t = tBegin; t < tEnd; t++) {
         for (size_t x = 0; x < NSPACE; x++) {
             for (size_t y = 0; y < NSPACE; y++) {
                 for (size_t z = 0; z < NSPACE; z++) {
+                    // the links of a site are stored consecutively, the site number in the file is the checksum rank
+                    const Index site(z, y, x, t, lE);
+                    const uint sitePos = LinkIndex(site, static_cast<Direction>(0)).get_su3_idx_ildg_format(0, 0);
+                    checksum.accumulate(&gaugefield_tmp[sitePos * sizeof(hmc_float)], elem_size,
+                                        uint32_t(site.globalIndex));
+
                     for (int l = 0; l < NDIM; l++) {
                         // save current link in a complex array
                         hmc_complex tmp[NC][NC];
                         for (int m = 0; m < NC; m++) {
                             for (int n = 0; n < NC; n++) {
-                                uint pos = LinkIndex(Index(z, y, x, t,
-                                                           LatticeExtents(parameters.getNs(), parameters.getNt())),
-                                                     static_cast<Direction>(l))
-                                               .get_su3_idx_ildg_format(n, m);
+                                uint pos = LinkIndex(site, static_cast<Direction>(l)).get_su3_idx_ildg_format(n, m);
                                 tmp[m][n].re = make_float_from_big_endian(&gaugefield_tmp[pos * sizeof(hmc_float)]);
                                 tmp[m][n].im = make_float_from_big_endian(
                                     &gaugefield_tmp[(pos + 1) * sizeof(hmc_float)]);
-                                cter++;
                             }
                         }
 
@@ -203,21 +204,41 @@ void ildgIo::copy_gaugefield_from_ildg_format(Matrixsu3* gaugefield, char* gauge
                         // our def: hmc_gaugefield [NC][NC][NDIM][VOLSPACE][NTIME]([2]), last one implicit for complex
                         // CP: interchange x<->z temporarily because spacepos has to be z + y * NSPACE + x * NSPACE *
                         // NSPACE!!
-                        gaugefield[uint(
-                            LinkIndex(Index(z, y, x, t, LatticeExtents(parameters.getNs(), parameters.getNt())),
-                                      static_cast<Direction>((l + 1) % NDIM)))] = destElem;
+                        gaugefield[uint(LinkIndex(site, static_cast<Direction>((l + 1) % NDIM)))] = destElem;
                     }
                 }
             }
         }
     }
+    return checksum;
+}
 
-    if (cter * 2 != expectedNumberOfEntries) {
+Checksum ildgIo::copy_gaugefield_from_ildg_format(Matrixsu3* gaugefield, const char* gaugefield_tmp,
+                                                  int expectedNumberOfEntries, const IldgIoParameters& parameters)
+{
+    // little check if arrays are big enough
+    if ((int)(parameters.getNumberOfElements() * NC * NC * 2) != expectedNumberOfEntries) {
         std::stringstream errstr;
-        errstr << "Error in setting gaugefield to source values! there were " << cter * 2 << " values set and not "
-               << expectedNumberOfEntries << ".";
+        errstr << "Error in setting gaugefield to source values!!\nCheck global settings!!";
         throw Print_Error_Message(errstr.str(), __FILE__, __LINE__);
     }
+
+    // timeslices are independent, so they are distributed in contiguous blocks over the available cores
+    const LatticeExtents lE(parameters.getNs(), parameters.getNt());
+    const int NT            = parameters.getNt();
+    const int numberOfTasks = std::max(1, std::min(NT, static_cast<int>(std::thread::hardware_concurrency())));
+    std::vector<std::future<Checksum>> tasks;
+    for (int task = 0; task < numberOfTasks; ++task) {
+        tasks.push_back(std::async(std::launch::async, copy_timeslices_from_ildg_format, gaugefield, gaugefield_tmp,
+                                   NT * task / numberOfTasks, NT * (task + 1) / numberOfTasks, lE));
+    }
+
+    Checksum checksum;
+    for (auto& task : tasks) {
+        checksum.merge(task.get());
+    }
+    logger.debug() << "Calculated Checksum: " << checksum;
+    return checksum;
 }
 
 static void make_big_endian_from_float(char* out, const hmc_float in)
@@ -68,8 +68,13 @@ namespace ildgIo {
     };
 
     Checksum calculate_ildg_checksum(const char* buf, size_t nbytes, const size_t NT, const size_t NS);
-    void copy_gaugefield_from_ildg_format(Matrixsu3* gaugefield, char* gaugefield_tmp, int check,
-                                          const IldgIoParameters& parameters);
+    /**
+     * Convert ILDG data to our format using all available cores.
+     *
+     * \return The SciDAC checksum of the data, accumulated during the conversion.
+     */
+    Checksum copy_gaugefield_from_ildg_format(Matrixsu3* gaugefield, const char* gaugefield_tmp, int check,
+                                              const IldgIoParameters& parameters);
     void copy_gaugefield_to_ildg_format(std::vector<char>& dest, const std::vector<Matrixsu3>& source_in,
                                         const IldgIoParameters& parameters);
 
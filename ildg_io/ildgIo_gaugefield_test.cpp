@@ -276,7 +276,9 @@ BOOST_AUTO_TEST_SUITE(conversionToAndFromIldgFormat)
         Inputparameters test2(&tmp);
         IldgIoParameters_gaugefield test(&test2);
         copy_gaugefield_to_ildg_format(binary_data, in.getField(), test);
-        copy_gaugefield_from_ildg_format(gaugefieldTmp, binary_data_ptr, in.getNumberOfElements() * 9 * 2, test);
+        Checksum checksum =
+            copy_gaugefield_from_ildg_format(gaugefieldTmp, binary_data_ptr, in.getNumberOfElements() * 9 * 2, test);
+        BOOST_CHECK(checksum == calculate_ildg_checksum(binary_data_ptr, num_bytes, test.getNt(), test.getNs()));
 
         in.setField(gaugefieldTmp);
     }
@@ -25,6 +25,7 @@
 #include "../../host_functionality/logger.hpp"
 #include "../sourcefileParameters/SourcefileParameters_utilities.hpp"
 
+#include <boost/interprocess/file_mapping.hpp>
 #include <boost/lexical_cast.hpp>
 
 int checkLimeEntryForFermionInformations(std::string lime_type, LimeEntryTypes limeEntryTypes)
@@ -54,7 +55,7 @@ void checkIfFileExists(std::string file) throw(File_Exception)
 }
 
 LimeFileReader::LimeFileReader(std::string filenameIn, int precision)
-    : LimeFileReader_basic(filenameIn), desiredPrecision(precision)
+    : LimeFileReader_basic(filenameIn), desiredPrecision(precision), binaryDataOffset(0), binaryDataNumberOfBytes(0)
 {
     checkIfFileExists(filename);
 
@@ -81,6 +82,23 @@ static void checkBufferSize(size_t actualSize, size_t expectedSize)
     }
 }
 
+boost::interprocess::mapped_region LimeFileReader::mapBinaryDataFromLimeFile(size_t expectedNumberOfBytes) const
+{
+    namespace ip = boost::interprocess;
+
+    logger.trace() << "Mapping data from LIME file \"" << filename << "\"...";
+    checkBufferSize(binaryDataNumberOfBytes, expectedNumberOfBytes);
+    try {
+        const ip::file_mapping file(filename.c_str(), ip::read_only);
+        ip::mapped_region region(file, ip::read_only, binaryDataOffset, binaryDataNumberOfBytes);
+        region.advise(ip::mapped_region::advice_willneed);
+        return region;
+    } catch (const ip::interprocess_exception& exception) {
+        logger.error() << "Failed to map LIME file into memory: " << exception.what();
+        throw File_Exception(filename);
+    }
+}
+
 void LimeFileReader::extractBinaryDataFromLimeEntry(LimeHeaderData limeHeaderData, char** destination,
                                                     size_t expectedNumberOfBytes)
 {
@@ -243,6 +261,9 @@ LimeFileProperties LimeFileReader::extractMetaDataFromLimeEntry(LimeHeaderData l
 
     if (checkLimeEntryForBinaryData(limeHeaderData.limeEntryType, limeEntryTypes) == 1) {
         props.numberOfBinaryDataEntries = 1;
+        // the reader stands at the beginning of the data of the record just entered
+        binaryDataOffset        = limeGetReaderPointer(limeReader);
+        binaryDataNumberOfBytes = limeHeaderData.numberOfBytes;
     }
     // todo: create class for the different cases
     else {
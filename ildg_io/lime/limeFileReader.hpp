@@ -26,6 +26,8 @@
 #include "../sourcefileParameters/SourcefileParameters.hpp"
 #include "limeUtilities.hpp"
 
+#include <boost/interprocess/mapped_region.hpp>
+
 class LimeFileReader : public LimeFileReader_basic {
   public:
     // todo: remove precision?
@@ -41,6 +43,11 @@ class LimeFileReader : public LimeFileReader_basic {
     void extractMetadataFromLimeFile();
     void readLimeFile(char** destination, size_t expectedNumberOfBytes = 0);
     void extractDataFromLimeFile(char** destination, size_t expectedNumberOfBytes);
+    /**
+     * Map the binary data entry read-only into memory instead of copying it into a buffer.
+     * The data stays accessible as long as the returned region exists.
+     */
+    boost::interprocess::mapped_region mapBinaryDataFromLimeFile(size_t expectedNumberOfBytes) const;
     void goThroughLimeRecords(char** destination, size_t expectedNumberOfBytes);
     void extractInformationFromLimeEntry(char** destination, size_t expectedNumberOfBytes);
     LimeFileProperties extractMetaDataFromLimeEntry(LimeHeaderData limeHeaderData);
@@ -55,6 +62,9 @@ class LimeFileReader : public LimeFileReader_basic {
     void handleLimeEntry_etmcPropagator(std::string lime_type) throw(std::logic_error);
 
     int desiredPrecision;
+    // position and size of the binary data entry inside the file, set while reading the metadata
+    n_uint64_t binaryDataOffset;
+    n_uint64_t binaryDataNumberOfBytes;
 };
 
 #endif
@@ -61,6 +61,11 @@ namespace physics {
                 return parameters.get_findminmax_iteration_block_size();
             }
             virtual unsigned getFindMinMaxMaxValue() const override { return parameters.get_findminmax_max(); }
+            virtual bool getFindMinMaxUseLanczos() const override { return parameters.get_findminmax_use_lanczos(); }
+            virtual double getFindMinMaxReusePlaquetteTolerance() const override
+            {
+                return parameters.get_findminmax_reuse_plaquette_tolerance();
+            }
 
           private:
             const meta::Inputparameters& parameters;
@@ -73,6 +78,10 @@ namespace physics {
             virtual ~ForcesParametersImplementation() {}
             virtual common::action getFermact() const override { return parameters.get_fermact(); }
             virtual double getSolverForcePrecision() const override { return parameters.get_force_prec(); }
+            virtual unsigned getSolverForceHistorySize() const override
+            {
+                return parameters.get_force_solution_history_size();
+            }
             virtual unsigned getRhoIterations() const override { return parameters.get_rho_iter(); }
             virtual common::solver getSolver() const override { return parameters.get_solver(); }
             virtual bool getUseSmearing() const override { return parameters.get_use_smearing(); }
@@ -93,6 +102,10 @@ namespace physics {
             virtual double getSolverPrec() const override { return parameters.get_solver_prec(); }
             virtual bool getUseEo() const override { return parameters.get_use_eo(); }
             virtual bool getUseSmearing() const override { return parameters.get_use_smearing(); }
+            virtual unsigned getSolverMultiRhsBlockSize() const override
+            {
+                return parameters.get_solver_multi_rhs_block_size();
+            }
 
           private:
             const meta::Inputparameters& parameters;
@@ -54,6 +54,7 @@ BOOST_AUTO_TEST_CASE(testForcesParameters)
 
     BOOST_CHECK_EQUAL(test.getFermact(), params->get_fermact());
     BOOST_CHECK_EQUAL(test.getSolverForcePrecision(), params->get_force_prec());
+    BOOST_CHECK_EQUAL(test.getSolverForceHistorySize(), params->get_force_solution_history_size());
     BOOST_CHECK_EQUAL(test.getRhoIterations(), params->get_rho_iter());
     BOOST_CHECK_EQUAL(test.getSolver(), params->get_solver());
     BOOST_CHECK_EQUAL(test.getUseGaugeOnly(), params->get_use_gauge_only());
@@ -68,6 +69,9 @@ BOOST_AUTO_TEST_CASE(testMinMaxEigenvalueParameters)
 
     BOOST_CHECK_EQUAL(test.getFindMinMaxIterationBlockSize(), params->get_findminmax_iteration_block_size());
     BOOST_CHECK_EQUAL(test.getFindMinMaxMaxValue(), params->get_findminmax_max());
+    BOOST_CHECK_EQUAL(test.getFindMinMaxUseLanczos(), params->get_findminmax_use_lanczos());
+    BOOST_CHECK_EQUAL(test.getFindMinMaxReusePlaquetteTolerance(),
+                      params->get_findminmax_reuse_plaquette_tolerance());
 }
 
 BOOST_AUTO_TEST_CASE(testInversionParameters)
@@ -80,6 +84,7 @@ BOOST_AUTO_TEST_CASE(testInversionParameters)
     BOOST_CHECK_EQUAL(test.getSolverPrec(), params->get_solver_prec());
     BOOST_CHECK_EQUAL(test.getUseEo(), params->get_use_eo());
     BOOST_CHECK_EQUAL(test.getUseSmearing(), params->get_use_smearing());
+    BOOST_CHECK_EQUAL(test.getSolverMultiRhsBlockSize(), params->get_solver_multi_rhs_block_size());
 }
 
 BOOST_AUTO_TEST_CASE(testIntegratorParameters)
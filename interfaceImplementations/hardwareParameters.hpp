@@ -41,8 +41,14 @@ namespace hardware {
         virtual std::vector<int> getSelectedDevices() const override { return fullParameters->get_selected_devices(); }
         virtual bool splitCpu() const override { return fullParameters->get_split_cpu(); }
         virtual bool enableProfiling() const override { return fullParameters->get_enable_profiling(); }
+        virtual bool useKernelAutotuning() const override { return fullParameters->get_use_kernel_autotuning(); }
+        virtual std::string getTraceFilename() const override { return fullParameters->get_trace_file(); }
         virtual bool useSameRandomNumbers() const override { return fullParameters->get_use_same_rnd_numbers(); }
         virtual bool useEvenOddPreconditioning() const override { return fullParameters->get_use_eo(); }
+        virtual common::halotransfer getHaloTransferMethod() const override
+        {
+            return fullParameters->get_halo_transfer();
+        }
         virtual int getSpatialLatticeVolume() const override { return meta::get_volspace(*fullParameters); }
         virtual int getLatticeVolume() const override { return meta::get_vol4d(*fullParameters); }
 
@@ -35,9 +35,11 @@ BOOST_AUTO_TEST_CASE(implementByMeansOfMetaInputparameters)
     BOOST_REQUIRE_EQUAL(hardwareParameters.useGpu(), fullParameters.get_use_gpu());
     BOOST_REQUIRE_EQUAL(hardwareParameters.useCpu(), fullParameters.get_use_cpu());
     BOOST_REQUIRE_EQUAL(hardwareParameters.splitCpu(), fullParameters.get_split_cpu());
+    BOOST_REQUIRE_EQUAL(hardwareParameters.getHaloTransferMethod(), fullParameters.get_halo_transfer());
     BOOST_REQUIRE_EQUAL(hardwareParameters.getMaximalNumberOfDevices(), fullParameters.get_device_count());
     BOOST_REQUIRE_EQUAL(hardwareParameters.getSelectedDevices().size(), fullParameters.get_selected_devices().size());
     BOOST_REQUIRE_EQUAL(hardwareParameters.enableProfiling(), fullParameters.get_enable_profiling());
+    BOOST_REQUIRE_EQUAL(hardwareParameters.useKernelAutotuning(), fullParameters.get_use_kernel_autotuning());
     BOOST_REQUIRE_EQUAL(hardwareParameters.getNs(), fullParameters.get_nspace());
     BOOST_REQUIRE_EQUAL(hardwareParameters.getNt(), fullParameters.get_ntime());
     BOOST_REQUIRE_EQUAL(hardwareParameters.disableOpenCLCompilerOptimizations(),
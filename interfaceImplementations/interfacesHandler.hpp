@@ -66,6 +66,7 @@ namespace physics {
             , wilsonAdditionalParameters{nullptr}
             , wilsonAdditionalParametersMp{nullptr}
             , staggeredAdditionalParameters{nullptr}
+            , solutionHistories{nullptr}
         {
         }
         ~InterfacesHandlerImplementation() {}
@@ -192,6 +193,15 @@ namespace physics {
             return *sourcesParametersInterface;
         }
 
+        physics::algorithms::SolutionHistoryScope* getSolutionHistories() const noexcept override
+        {
+            return solutionHistories;
+        }
+        void setSolutionHistories(physics::algorithms::SolutionHistoryScope* histories) noexcept override
+        {
+            solutionHistories = histories;
+        }
+
       private:
         const physics::lattices::GaugefieldParametersInterface& getGaugefieldParametersInterface() override
         {
@@ -346,6 +356,7 @@ namespace physics {
         std::unique_ptr<const physics::AdditionalParameters> wilsonAdditionalParameters;
         std::unique_ptr<const physics::AdditionalParameters> wilsonAdditionalParametersMp;
         std::unique_ptr<const physics::AdditionalParameters> staggeredAdditionalParameters;
+        physics::algorithms::SolutionHistoryScope* solutionHistories;
     };
 
     /*
@@ -43,6 +43,11 @@ namespace hardware {
             virtual double getRho() const override { return fullParameters->get_rho(); }
             virtual int getRhoIter() const override { return fullParameters->get_rho_iter(); }
             virtual bool getUseRec12() const override { return fullParameters->get_use_rec12(); }
+            virtual bool getUseRec8() const override { return fullParameters->get_use_rec8(); }
+            virtual bool getUseSinglePrecFermionStorage() const override
+            {
+                return fullParameters->get_use_single_precision_fermion_storage();
+            }
             virtual bool getUseEo() const override { return fullParameters->get_use_eo(); }
             virtual common::action getFermact() const override { return fullParameters->get_fermact(); }
             virtual common::action getGaugeact() const override { return fullParameters->get_gaugeact(); }
@@ -69,9 +69,8 @@ Inputparameters::Inputparameters(int argc, const char** argv, std::string parame
     desc.add(cmd_opts);
 
     if (parameterSet == "su3heatbath") {
-        desc.add(
-                ParametersConfig::options.deleteSome({"useReconstruct12", "readMultipleConfs", "readFromConfNumber",
-                                                      "readUntilConfNumber", "readConfsEvery", "nBenchmarkIterations"}))
+        desc.add(ParametersConfig::options.deleteSome({"readMultipleConfs", "readFromConfNumber", "readUntilConfNumber",
+                                                       "readConfsEvery", "nBenchmarkIterations"}))
             .add(ParametersIo::options.deleteSome({"fermObsInSingleFile", "fermObsCorrelatorsPrefix",
                                                    "fermObsCorrelatorsPostfix", "fermObsPbpPrefix", "fermObsPbpPostfix",
                                                    "hmcObsToSingleFile", "hmcObsPrefix", "hmcObsPostfix",
@@ -82,7 +81,7 @@ Inputparameters::Inputparameters(int argc, const char** argv, std::string parame
             .add(ParametersObs::options.keepOnlySome({"measureTransportCoefficientKappa", "measureRectangles"}));
 
     } else if (parameterSet == "gaugeobservables") {
-        desc.add(ParametersConfig::options.deleteSome({"useReconstruct12", "nBenchmarkIterations"}))
+        desc.add(ParametersConfig::options.deleteSome({"nBenchmarkIterations"}))
             .add(ParametersIo::options.keepOnlySome(
                 {"nDigitsInConfCheckpoint", "confPrefix", "confPostfix", "PRNGPrefix", "PRNGPostfix",
                  "rectanglesFilename", "transportCoefficientKappaFilename", "profilingDataPrefix",
@@ -91,7 +90,7 @@ Inputparameters::Inputparameters(int argc, const char** argv, std::string parame
             .add(ParametersObs::options.keepOnlySome({"measureTransportCoefficientKappa", "measureRectangles"}));
 
     } else if (parameterSet == "inverter") {
-        desc.add(ParametersConfig::options.deleteSome({"useReconstruct12", "nBenchmarkIterations"}))
+        desc.add(ParametersConfig::options.deleteSome({"nBenchmarkIterations"}))
             .add(ParametersIo::options.deleteSome({"onlineMeasureEvery", "createCheckpointEvery",
                                                    "overwriteTemporaryCheckpointEvery", "hmcObsToSingleFile",
                                                    "hmcObsPrefix", "hmcObsPostfix", "rhmcObsToSingleFile",
@@ -103,9 +102,8 @@ Inputparameters::Inputparameters(int argc, const char** argv, std::string parame
             .add(ParametersSolver::options.deleteSome({"solverMP", "solverMaxIterationsMP", "solverUseAsyncCopy"}));
 
     } else if (parameterSet == "hmc") {
-        desc.add(
-                ParametersConfig::options.deleteSome({"useReconstruct12", "readMultipleConfs", "readFromConfNumber",
-                                                      "readUntilConfNumber", "readConfsEvery", "nBenchmarkIterations"}))
+        desc.add(ParametersConfig::options.deleteSome({"readMultipleConfs", "readFromConfNumber", "readUntilConfNumber",
+                                                       "readConfsEvery", "nBenchmarkIterations"}))
             .add(ParametersIo::options.deleteSome({"rhmcObsToSingleFile", "rhmcObsPrefix", "rhmcObsPostfix"}))
             .add(ParametersMonteCarlo::options.keepOnlySome(
                 {"nThermalizationSteps", "nHmcSteps", "useGaugeOnly", "useMP"}))
@@ -117,9 +115,8 @@ Inputparameters::Inputparameters(int argc, const char** argv, std::string parame
             .add(ParametersSources::options);
 
     } else if (parameterSet == "rhmc") {
-        desc.add(
-                ParametersConfig::options.deleteSome({"useReconstruct12", "readMultipleConfs", "readFromConfNumber",
-                                                      "readUntilConfNumber", "readConfsEvery", "nBenchmarkIterations"}))
+        desc.add(ParametersConfig::options.deleteSome({"readMultipleConfs", "readFromConfNumber", "readUntilConfNumber",
+                                                       "readConfsEvery", "nBenchmarkIterations"}))
             .add(ParametersIo::options.deleteSome({"hmcObsToSingleFile", "hmcObsPrefix", "hmcObsPostfix"}))
             .add(ParametersMonteCarlo::options.keepOnlySome(
                 {"nThermalizationSteps", "nRhmcSteps", "nTastes", "nTastesDecimalDigits", "nPseudoFermions"}))
@@ -135,7 +132,7 @@ Inputparameters::Inputparameters(int argc, const char** argv, std::string parame
 
     } else  // default: add all options
     {
-        desc.add(ParametersConfig::options)  // useReconstruct12 not working if activated!
+        desc.add(ParametersConfig::options)
             .add(ParametersIo::options)
             .add(ParametersGauge::options)
             .add(ParametersMonteCarlo::options)
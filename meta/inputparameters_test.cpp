@@ -43,6 +43,8 @@ void checkDefaults(const Inputparameters& params)
     BOOST_REQUIRE_EQUAL(params.get_use_gpu(), true);
     BOOST_REQUIRE_EQUAL(params.get_use_cpu(), true);
     BOOST_REQUIRE_EQUAL(params.get_enable_profiling(), false);
+    BOOST_REQUIRE_EQUAL(params.get_use_kernel_autotuning(), false);
+    BOOST_REQUIRE_EQUAL(params.get_trace_file(), "");
 
     BOOST_REQUIRE_EQUAL(params.get_use_aniso(), false);
     BOOST_REQUIRE_EQUAL(params.get_use_chem_pot_re(), false);
@@ -71,6 +73,8 @@ void checkDefaults(const Inputparameters& params)
     BOOST_REQUIRE_EQUAL(params.get_thermalizationsteps(), 0);
     BOOST_REQUIRE_EQUAL(params.get_heatbathsteps(), 1000);
     BOOST_REQUIRE_EQUAL(params.get_overrelaxsteps(), 1);
+    BOOST_REQUIRE_EQUAL(params.get_multilevel_sublattice_extent(), 0);
+    BOOST_REQUIRE_EQUAL(params.get_multilevel_updates(), 10);
     BOOST_REQUIRE_EQUAL(params.get_xi(), 1);
     BOOST_REQUIRE_EQUAL(params.get_measure_transportcoefficient_kappa(), false);
     BOOST_REQUIRE_EQUAL(params.get_measure_rectangles(), false);
@@ -107,6 +111,8 @@ void checkDefaults(const Inputparameters& params)
     BOOST_REQUIRE_EQUAL(params.get_force_prec(), 1e-8);
 #endif
     BOOST_REQUIRE_EQUAL(params.get_iter_refresh(), 100);
+    BOOST_REQUIRE_EQUAL(params.get_solver_multi_rhs_block_size(), 1);
+    BOOST_REQUIRE_EQUAL(params.get_force_solution_history_size(), 0);
     BOOST_REQUIRE_EQUAL(params.get_benchmarksteps(), 500);
 
     // HMC specific parameters
@@ -129,6 +135,8 @@ void checkDefaults(const Inputparameters& params)
     BOOST_REQUIRE_EQUAL(params.get_findminmax_iteration_block_size(), 25);
     BOOST_REQUIRE_EQUAL(params.get_findminmax_max(), 5000);
     BOOST_REQUIRE_EQUAL(params.get_findminmax_prec(), 0.001);
+    BOOST_REQUIRE_EQUAL(params.get_findminmax_use_lanczos(), false);
+    BOOST_REQUIRE_EQUAL(params.get_findminmax_reuse_plaquette_tolerance(), 0.);
     BOOST_REQUIRE_EQUAL(params.get_conservative(), false);
     BOOST_REQUIRE_EQUAL(params.get_num_tastes(), 2);
     BOOST_REQUIRE_EQUAL(params.get_num_tastes_decimal_digits(), 0);
@@ -153,6 +161,9 @@ void checkDefaults(const Inputparameters& params)
     BOOST_REQUIRE_EQUAL(params.get_use_merge_kernels_spinor(), false);
     BOOST_REQUIRE_EQUAL(params.get_use_merge_kernels_fermion(), false);
     BOOST_REQUIRE_EQUAL(params.get_use_rec12(), false);
+    BOOST_REQUIRE_EQUAL(params.get_use_rec8(), false);
+    BOOST_REQUIRE_EQUAL(params.get_use_single_precision_fermion_storage(), false);
+    BOOST_REQUIRE_EQUAL(params.get_halo_transfer(), common::auto_select);
 
     BOOST_REQUIRE_EQUAL(params.get_log_level(), "ALL");
 }
@@ -317,6 +328,18 @@ BOOST_AUTO_TEST_CASE(command_line6)
     BOOST_REQUIRE_EQUAL(params.get_log_level(), "ERROR");
 }
 
+BOOST_AUTO_TEST_CASE(command_line7)
+{
+    const char* _params[] = {"foo", "--useReconstruct12=true", "--useReconstruct8=true"};
+    BOOST_REQUIRE_THROW(Inputparameters(3, _params), Invalid_Parameters);
+}
+
+BOOST_AUTO_TEST_CASE(command_line8)
+{
+    const char* _params[] = {"foo", "--solverForceHistorySize=-1"};
+    BOOST_REQUIRE_THROW(Inputparameters(2, _params), Invalid_Parameters);
+}
+
 BOOST_AUTO_TEST_CASE(aliases)
 {
     const char* _params[] = {"foo", "test_input_aliases"};
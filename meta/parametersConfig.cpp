@@ -54,6 +54,14 @@ bool meta::ParametersConfig::get_enable_profiling() const noexcept
 {
     return enable_profiling;
 }
+bool meta::ParametersConfig::get_use_kernel_autotuning() const noexcept
+{
+    return use_kernel_autotuning;
+}
+std::string meta::ParametersConfig::get_trace_file() const noexcept
+{
+    return trace_file;
+}
 
 int meta::ParametersConfig::get_nspace() const noexcept
 {
@@ -133,11 +141,26 @@ bool meta::ParametersConfig::get_use_rec12() const noexcept
     return use_rec12;
 }
 
+bool meta::ParametersConfig::get_use_rec8() const noexcept
+{
+    return use_rec8;
+}
+
+bool meta::ParametersConfig::get_use_single_precision_fermion_storage() const noexcept
+{
+    return use_single_precision_fermion_storage;
+}
+
 bool meta::ParametersConfig::get_split_cpu() const noexcept
 {
     return split_cpu;
 }
 
+common::halotransfer meta::ParametersConfig::get_halo_transfer() const noexcept
+{
+    return _haloTransfer;
+}
+
 meta::ParametersConfig::ParametersConfig()
     : precision(sizeof(double) * 8)
     , selected_devices(0)
@@ -145,6 +168,8 @@ meta::ParametersConfig::ParametersConfig()
     , use_gpu(true)
     , use_cpu(true)
     , enable_profiling(false)
+    , use_kernel_autotuning(false)
+    , trace_file("")
     , nspace(4)
     , ntime(8)
     , read_multiple_configs(false)
@@ -159,12 +184,16 @@ meta::ParametersConfig::ParametersConfig()
     , benchmarksteps(500)
     , use_same_rnd_numbers(false)
     , use_rec12(false)
+    , use_rec8(false)
+    , use_single_precision_fermion_storage(false)
     , ocl_compiler_opt_disabled(false)
     , log_level("ALL")
     , split_cpu(false)
     , options("Hardware and lattice options")
     , _startconditionString("cold")
     , _startcondition(common::startcondition::cold_start)
+    , _haloTransferString("auto")
+    , _haloTransfer(common::halotransfer::auto_select)
 {
     // clang-format off
     options.add_options()
@@ -174,6 +203,8 @@ meta::ParametersConfig::ParametersConfig()
     ("useGPU", po::value<bool>(&use_gpu)->default_value(use_gpu), "Whether to use GPUs.")
     ("useCPU", po::value<bool>(&use_cpu)->default_value(use_cpu), "Whether to use CPUs.")
     ("enableProfiling", po::value<bool>(&enable_profiling)->default_value(enable_profiling), "Whether to profile kernel execution. This option implies slower performance due to synchronization after each kernel call.")
+    ("useKernelAutotuning", po::value<bool>(&use_kernel_autotuning)->default_value(use_kernel_autotuning), "Whether to tune the work sizes of the kernels during their first executions. The tuned work sizes are cached next to the kernel binaries and reused by later runs on the same device.")
+    ("traceFile", po::value<std::string>(&trace_file)->default_value(trace_file), "The path of a file to which a timeline of all kernel executions, halo transfers and solver and integrator phases is written in the Chrome trace event format. If empty, no trace is recorded. Tracing requires the OpenCL profiling of the commands, but unlike enableProfiling it does not synchronize after each kernel call.")
     ("nSpace", po::value<int>(&nspace)->default_value(nspace), "The spatial extent of the lattice.")
     ("nTime", po::value<int>(&ntime)->default_value(ntime), "The temporal extent of the lattice.")
     ("startCondition", po::value<std::string>(&_startconditionString)->default_value(_startconditionString), "The gaugefield starting condition (e.g. cold, hot, continue).")
@@ -183,13 +214,16 @@ meta::ParametersConfig::ParametersConfig()
     ("initialPRNG", po::value<std::string>(&initial_prng_state)->default_value(initial_prng_state),"The path of the file containing the pseudo random number generator state to start from.")
     ("useSameRandomNumbers", po::value<bool>(&use_same_rnd_numbers)->default_value(use_same_rnd_numbers), "Whether to use random numbers compatible with a scalar version. If it is set to 'true', then the number of random states is one instead of being equal to the number of global threads. This option implies a huge loss in performance, hence it should be used with care!")
     ("disableOclCompilerOptimization", po::value<bool>(&ocl_compiler_opt_disabled)->default_value(ocl_compiler_opt_disabled), "Whether to disable OpenCL compiler from performing optimizations (cf. -cl-disable-opt).")
-    ("useReconstruct12", po::value<bool>(&use_rec12)->default_value(use_rec12), "Whether to use reconstruct 12 compression for SU3 matrices, i.e. consider gauge links stored using 12 complex numbers instead of 18.")
+    ("useReconstruct12", po::value<bool>(&use_rec12)->default_value(use_rec12), "Whether to use reconstruct 12 compression for SU3 matrices, i.e. consider gauge links stored using 12 real numbers instead of 18.")
+    ("useReconstruct8", po::value<bool>(&use_rec8)->default_value(use_rec8), "Whether to use reconstruct 8 compression for SU3 matrices, i.e. consider gauge links stored using 8 real numbers instead of 18. It cannot be used together with reconstruct 12.")
+    ("useSinglePrecisionFermionStorage", po::value<bool>(&use_single_precision_fermion_storage)->default_value(use_single_precision_fermion_storage), "Whether to store even-odd spinor and staggered fields in single precision, while all operations on them (including reductions) are still done in the given precision. It has an effect only with 64 bit precision on devices using the SOA storage layout.")
     ("logLevel", po::value<std::string>(&log_level)->default_value(log_level), "The minimum output log level (one among ALL, TRACE, DEBUG, INFO, WARN, ERROR, FATAL, OFF).")
     ("readMultipleConfs", po::value<bool>(&read_multiple_configs)->default_value(read_multiple_configs), "Whether to use more than one gaugefield configuration at once.")
     ("readFromConfNumber", po::value<int>(&config_read_start)->default_value(config_read_start), "The number to begin with when using more than one gaugefield configuration at once.")
     ("readUntilConfNumber", po::value<int>(&config_read_end)->default_value(config_read_end), "The number to end at when using more than one gaugefield configuration at once.")
     ("readConfsEvery", po::value<int>(&config_read_incr)->default_value(config_read_incr), "The increment for the gaugefield configuration number when using more than one gaugefield configuration at once.")
     ("splitCPU", po::value<bool>(&split_cpu)->default_value(split_cpu), "Whether to split the CPU into multiple devices to avoid numa issues. This option requires OpenCL 1.2 at least.")
+    ("haloTransfer", po::value<std::string>(&_haloTransferString)->default_value(_haloTransferString), "The method used to exchange halos between devices (one among auto, ocl_copy, async_ocl_copy, dgma, direct_copy). With direct_copy the destination device reads the halo straight from a staging buffer on the source device, without going through the host.")
     ("nBenchmarkIterations", po::value<int>(&benchmarksteps)->default_value(benchmarksteps), "The number of times a kernel is executed for benchmark purposes.")
     ("ignoreChecksumErrors", po::value<bool>(&ignore_checksum_errors)->default_value(ignore_checksum_errors), "Whether to ignore checksum errors, e.g. reading conf files.");
     // clang-format on
@@ -216,7 +250,30 @@ static common::startcondition translateStartConditionToEnum(std::string s)
     }
 }
 
+static common::halotransfer translateHaloTransferToEnum(std::string s)
+{
+    boost::algorithm::to_lower(s);
+    std::map<std::string, common::halotransfer> m;
+    m["auto"]           = common::auto_select;
+    m["ocl_copy"]       = common::ocl_copy;
+    m["async_ocl_copy"] = common::async_ocl_copy;
+    m["dgma"]           = common::dgma;
+    m["direct_copy"]    = common::direct_copy;
+
+    common::halotransfer a = m[s];
+    if (a) {
+        return a;
+    } else {
+        throw Invalid_Parameters("Unkown halo transfer method!", "auto, ocl_copy, async_ocl_copy, dgma, direct_copy",
+                                 s);
+    }
+}
+
 void meta::ParametersConfig::makeNeededTranslations()
 {
     _startcondition = translateStartConditionToEnum(_startconditionString);
+    _haloTransfer   = translateHaloTransferToEnum(_haloTransferString);
+    if (use_rec12 && use_rec8)
+        throw Invalid_Parameters("Only one compression of the gauge links can be used!",
+                                 "useReconstruct12 or useReconstruct8", "both");
 }
@@ -36,6 +36,8 @@ namespace meta {
         bool get_use_gpu() const noexcept;
         bool get_use_cpu() const noexcept;
         bool get_enable_profiling() const noexcept;
+        bool get_use_kernel_autotuning() const noexcept;
+        std::string get_trace_file() const noexcept;
         int get_nspace() const noexcept;
         int get_ntime() const noexcept;
 
@@ -52,12 +54,15 @@ namespace meta {
 
         std::string get_log_level() const noexcept;
         bool get_use_rec12() const noexcept;
+        bool get_use_rec8() const noexcept;
+        bool get_use_single_precision_fermion_storage() const noexcept;
         uint32_t get_host_seed() const noexcept;
         std::string get_initial_prng_state() const noexcept;
 
         bool get_use_same_rnd_numbers() const noexcept;
         bool is_ocl_compiler_opt_disabled() const noexcept;
         bool get_split_cpu() const noexcept;
+        common::halotransfer get_halo_transfer() const noexcept;
         int get_benchmarksteps() const noexcept;
 
       private:
@@ -68,6 +73,8 @@ namespace meta {
         bool use_gpu;
         bool use_cpu;
         bool enable_profiling;
+        bool use_kernel_autotuning;
+        std::string trace_file;
 
         int nspace;
         int ntime;
@@ -86,6 +93,8 @@ namespace meta {
         int benchmarksteps;
         bool use_same_rnd_numbers;
         bool use_rec12;
+        bool use_rec8;
+        bool use_single_precision_fermion_storage;
         bool ocl_compiler_opt_disabled;
 
         std::string log_level;
@@ -101,6 +110,8 @@ namespace meta {
         InputparametersOptions options;
         std::string _startconditionString;
         common::startcondition _startcondition;
+        std::string _haloTransferString;
+        common::halotransfer _haloTransfer;
     };
 
 }  // namespace meta
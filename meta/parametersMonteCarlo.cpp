@@ -43,6 +43,14 @@ bool meta::ParametersMonteCarlo::get_use_aniso() const noexcept
 {
     return use_aniso;
 }
+unsigned int meta::ParametersMonteCarlo::get_multilevel_sublattice_extent() const noexcept
+{
+    return multilevelSublatticeExtent;
+}
+unsigned int meta::ParametersMonteCarlo::get_multilevel_updates() const noexcept
+{
+    return multilevelUpdates;
+}
 int meta::ParametersMonteCarlo::get_hmcsteps() const noexcept
 {
     return hmcsteps;
@@ -81,6 +89,8 @@ meta::ParametersMonteCarlo::ParametersMonteCarlo()
     , overrelaxsteps(1)
     , xi(1)
     , use_aniso(false)
+    , multilevelSublatticeExtent(0)
+    , multilevelUpdates(10)
     , use_gauge_only(false)
     , use_mp(false)
     , numberOfTastes(2)
@@ -95,6 +105,8 @@ meta::ParametersMonteCarlo::ParametersMonteCarlo()
     ("nOverrelaxationSteps", po::value<int>(&overrelaxsteps)->default_value(overrelaxsteps),"The number of overrelaxation steps in the update of a gaugefield configuration.")
     ("useAnisotropy", po::value<bool>(&use_aniso)->default_value(use_aniso), "Whether to use an anisotropic lattice, having a lattice spacing different in time and in space directions.")
     ("xi", po::value<int>(&xi)->default_value(xi), "The anisotropy coefficient.")
+    ("multilevelSublatticeExtent", po::value<unsigned int>(&multilevelSublatticeExtent)->default_value(multilevelSublatticeExtent), "The temporal extent of the sublattices used to measure the Polyakov loop with the multilevel algorithm in the SU(3) Heatbath executable (0 means no multilevel measurement). The sublattice updates are part of the Markov chain.")
+    ("nMultilevelUpdates", po::value<unsigned int>(&multilevelUpdates)->default_value(multilevelUpdates), "The number of sublattice updates averaged over in each multilevel measurement.")
     ("nHmcSteps", po::value<int>(&hmcsteps)->default_value(hmcsteps),"The number of HMC steps (i.e. the number of configuration updates in the Markov chain).")
     ("useGaugeOnly", po::value<bool>(&use_gauge_only)->default_value(use_gauge_only),"Whether to simulate pure gauge theory with HMC. In this case 'nTimeScales' has to be set to 1.")
     ("useMP", po::value<bool>(&use_mp)->default_value(use_mp),"Whether to use the Mass Preconditioning trick.")
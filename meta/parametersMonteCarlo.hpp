@@ -36,6 +36,8 @@ namespace meta {
         int get_overrelaxsteps() const noexcept;
         int get_xi() const noexcept;
         bool get_use_aniso() const noexcept;
+        unsigned int get_multilevel_sublattice_extent() const noexcept;
+        unsigned int get_multilevel_updates() const noexcept;
         // Hmc
         int get_hmcsteps() const noexcept;
         bool get_use_gauge_only() const noexcept;
@@ -55,6 +57,8 @@ namespace meta {
         int overrelaxsteps;
         int xi;
         bool use_aniso;
+        unsigned int multilevelSublatticeExtent;
+        unsigned int multilevelUpdates;
         bool use_gauge_only;
         bool use_mp;
         /**
@@ -42,6 +42,14 @@ double ParametersRationalApproximation::get_findminmax_prec() const noexcept
 {
     return findMinMaxEigenvaluePrecision;
 }
+bool ParametersRationalApproximation::get_findminmax_use_lanczos() const noexcept
+{
+    return findMinMaxEigenvalueUseLanczos;
+}
+double ParametersRationalApproximation::get_findminmax_reuse_plaquette_tolerance() const noexcept
+{
+    return findMinMaxEigenvalueReusePlaquetteTolerance;
+}
 bool ParametersRationalApproximation::get_conservative() const noexcept
 {
     return beConservativeInFindMinMaxEigenvalue;
@@ -77,6 +85,8 @@ meta::ParametersRationalApproximation::ParametersRationalApproximation()
     , findMinMaxEigenvalueIterationBlockSize(25)
     , findMinMaxEigenvalueMaxNumberOfIterations(5000)
     , findMinMaxEigenvaluePrecision(1.e-3)
+    , findMinMaxEigenvalueUseLanczos(false)
+    , findMinMaxEigenvalueReusePlaquetteTolerance(0.)
     , beConservativeInFindMinMaxEigenvalue(false)
     , lowerBoundForRationalApproximationRange(1.e-5)
     , upperBoundForRationalApproximationRange(1.)
@@ -93,6 +103,8 @@ meta::ParametersRationalApproximation::ParametersRationalApproximation()
     ("findminmaxMaxIterations", po::value<unsigned int>(&findMinMaxEigenvalueMaxNumberOfIterations)->default_value(findMinMaxEigenvalueMaxNumberOfIterations), "The maximum number of iterations in the 'findMinMax' algorithm to find the minimum and the maximum eigenvalues of the fermion matrix operator.")
     ("findminmaxResiduumCheckEvery", po::value<unsigned int>(&findMinMaxEigenvalueIterationBlockSize)->default_value(findMinMaxEigenvalueIterationBlockSize), "Every how many iteration 'findMinMax' will check the residuum.")
     ("findminmaxPrecision", po::value<double>(&findMinMaxEigenvaluePrecision)->default_value(findMinMaxEigenvaluePrecision, meta::getDefaultForHelper(findMinMaxEigenvaluePrecision)), "The precision used in 'findMinMax'.")
+    ("findminmaxUseLanczos", po::value<bool>(&findMinMaxEigenvalueUseLanczos)->default_value(findMinMaxEigenvalueUseLanczos), "Whether to use a thick-restart Lanczos iteration, started from the eigenvectors found in the previous trajectory, instead of the power method in 'findMinMax'. The residuum is then checked every 'findminmaxResiduumCheckEvery' iterations, which is also the number of stored Lanczos vectors.")
+    ("findminmaxReuseBoundsPlaquetteTolerance", po::value<double>(&findMinMaxEigenvalueReusePlaquetteTolerance)->default_value(findMinMaxEigenvalueReusePlaquetteTolerance), "Reuse the eigenvalue bounds of the previous 'findMinMax' call if the plaquette changed by less than this value since then (0 to always recompute them).")
     ("conservative", po::value<bool>(&beConservativeInFindMinMaxEigenvalue)->default_value(beConservativeInFindMinMaxEigenvalue), "Whether to be conservative in 'findMinMax' (check validity of rational approximation in a wider-than-needed interval). It may affect the correctness of the RHMC, hence use with care.")
     ("rationalApproxLowerBound", po::value<double>(&lowerBoundForRationalApproximationRange)->default_value(lowerBoundForRationalApproximationRange, meta::getDefaultForHelper(lowerBoundForRationalApproximationRange)), "The lower bound in the validity interval of the rational approximation.")
     ("rationalApproxUpperBound", po::value<double>(&upperBoundForRationalApproximationRange)->default_value(upperBoundForRationalApproximationRange, meta::getDefaultForHelper(upperBoundForRationalApproximationRange)), "The upper bound in the validity interval of the rational approximation.")
@@ -32,6 +32,8 @@ namespace meta {
         unsigned int get_findminmax_iteration_block_size() const noexcept;
         unsigned int get_findminmax_max() const noexcept;
         double get_findminmax_prec() const noexcept;
+        bool get_findminmax_use_lanczos() const noexcept;
+        double get_findminmax_reuse_plaquette_tolerance() const noexcept;
         bool get_conservative() const noexcept;
         double get_approx_lower() const noexcept;
         double get_approx_upper() const noexcept;
@@ -52,6 +54,8 @@ namespace meta {
         unsigned int findMinMaxEigenvalueIterationBlockSize;
         unsigned int findMinMaxEigenvalueMaxNumberOfIterations;
         double findMinMaxEigenvaluePrecision;
+        bool findMinMaxEigenvalueUseLanczos;
+        double findMinMaxEigenvalueReusePlaquetteTolerance;
         bool beConservativeInFindMinMaxEigenvalue;  // this is for the strategy in findminmax_eigenvalues
         double lowerBoundForRationalApproximationRange;
         double upperBoundForRationalApproximationRange;  // range of validity of the Rational Approximation
@@ -70,6 +70,14 @@ int meta::ParametersSolver::get_cg_minimum_iteration_count() const noexcept
 {
     return cg_minimum_iteration_count;
 }
+int meta::ParametersSolver::get_solver_multi_rhs_block_size() const noexcept
+{
+    return solver_multi_rhs_block_size;
+}
+unsigned int meta::ParametersSolver::get_force_solution_history_size() const noexcept
+{
+    return force_solution_history_size;
+}
 
 meta::ParametersSolver::ParametersSolver()
     :
@@ -87,6 +95,8 @@ meta::ParametersSolver::ParametersSolver()
     , cg_iteration_block_size(10)
     , cg_use_async_copy(false)
     , cg_minimum_iteration_count(0)
+    , solver_multi_rhs_block_size(1)
+    , force_solution_history_size(0)
     , options("Solver options")
     , _solverString("bicgstab")
     , _solverMPString("bicgstab")
@@ -104,7 +114,9 @@ meta::ParametersSolver::ParametersSolver()
     ("solverForcePrecision", po::value<double>(&force_prec)->default_value(force_prec, meta::getDefaultForHelper(force_prec)),"The precision used in Molecular Dynamics inversions.")
     ("solverRestartEvery", po::value<int>(&iter_refresh)->default_value(iter_refresh),"Every how many iterations the residuum is set to \"A*x-b\" using the current approximate solution before being normally updated.")
     ("solverResiduumCheckEvery", po::value<int>(&cg_iteration_block_size)->default_value(cg_iteration_block_size), "The frequency at which the solver will check the residuum.")
-    ("solverUseAsyncCopy", po::value<bool>(&cg_use_async_copy)->default_value(cg_use_async_copy), "Whether the solver uses residuum of iteration N - 'checkResidualEvery' for termination condition on iteration N.");
+    ("solverUseAsyncCopy", po::value<bool>(&cg_use_async_copy)->default_value(cg_use_async_copy), "Whether the solver uses residuum of iteration N - 'checkResidualEvery' for termination condition on iteration N.")
+    ("solverMultiRhsBlockSize", po::value<int>(&solver_multi_rhs_block_size)->default_value(solver_multi_rhs_block_size), "How many sources of an inversion are solved together by a batched CG, which loads the gaugefield only once for all of them (1 means one source after the other). Only used with solver=cg and even-odd preconditioning. Each source of a block needs about 9 even-odd spinorfields of device memory.")
+    ("solverForceHistorySize", po::value<int>(&force_solution_history_size)->default_value(force_solution_history_size), "How many previous solutions per pseudofermion are kept during a trajectory to build a minimal-residual starting guess for the Molecular Dynamics inversions (0 means always starting from a cold guess).");
     // clang-format on
 }
 
@@ -127,4 +139,7 @@ void meta::ParametersSolver::makeNeededTranslations()
 {
     _solver   = translateSolverToEnum(_solverString);
     _solverMP = translateSolverToEnum(_solverMPString);
+    if (force_solution_history_size < 0)
+        throw Invalid_Parameters("Negative solution history size!", "solverForceHistorySize >= 0",
+                                 force_solution_history_size);
 }
@@ -39,6 +39,8 @@ namespace meta {
         int get_cg_minimum_iteration_count() const noexcept;
         int get_cgmax() const noexcept;
         int get_cgmax_mp() const noexcept;
+        int get_solver_multi_rhs_block_size() const noexcept;
+        unsigned int get_force_solution_history_size() const noexcept;
 
       private:
         double solver_prec;
@@ -49,6 +51,8 @@ namespace meta {
         int cg_iteration_block_size;
         bool cg_use_async_copy;
         int cg_minimum_iteration_count;
+        int solver_multi_rhs_block_size;
+        int force_solution_history_size;
 
       protected:
         ParametersSolver();
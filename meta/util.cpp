@@ -66,9 +66,12 @@ size_t meta::get_float_size(const Inputparameters& params)
 {
     return params.get_precision() / 8;
 }
-size_t meta::get_mat_size(const Inputparameters&)
+size_t meta::get_mat_size(const Inputparameters& params)
 {
-    // TODO with rec12 this becomes 6
+    if (params.get_use_rec12())
+        return 6;
+    if (params.get_use_rec8())
+        return 4;
     return 9;
 }
 
@@ -67,6 +67,14 @@ void meta::print_info_global(const meta::Inputparameters& params)
     } else {
         logger.info() << "## REC12:   OFF";
     }
+    if (params.get_use_rec8() == true) {
+        logger.info() << "## REC8:    ON";
+    } else {
+        logger.info() << "## REC8:    OFF";
+    }
+    if (params.get_use_single_precision_fermion_storage() == true) {
+        logger.info() << "## FERMION STORAGE PREC: 32";
+    }
     if (params.get_use_gpu() == true) {
         logger.info() << "## USE GPU: ON";
     } else {
@@ -125,6 +133,14 @@ void meta::print_info_global(std::ostream* os, const meta::Inputparameters& para
     } else {
         *os << "## REC12:   OFF" << endl;
     }
+    if (params.get_use_rec8() == true) {
+        *os << "## REC8:    ON" << endl;
+    } else {
+        *os << "## REC8:    OFF" << endl;
+    }
+    if (params.get_use_single_precision_fermion_storage() == true) {
+        *os << "## FERMION STORAGE PREC: 32" << endl;
+    }
     if (params.get_use_gpu() == true) {
         *os << "## USE GPU: ON" << endl;
     } else {
@@ -175,6 +191,10 @@ void meta::print_info_heatbath(const Inputparameters& params)
     logger.info() << "## thermsteps     = " << params.get_thermalizationsteps();
     logger.info() << "## heatbathsteps  = " << params.get_heatbathsteps();
     logger.info() << "## overrelaxsteps = " << params.get_overrelaxsteps();
+    if (params.get_multilevel_sublattice_extent() > 0) {
+        logger.info() << "## multilevel sublattice extent = " << params.get_multilevel_sublattice_extent();
+        logger.info() << "## multilevel updates           = " << params.get_multilevel_updates();
+    }
     logger.info() << "## **********************************************************";
     return;
 }
@@ -188,6 +208,10 @@ void meta::print_info_heatbath(std::ostream* os, const Inputparameters& params)
     *os << "## thermsteps     = " << params.get_thermalizationsteps() << endl;
     *os << "## heatbathsteps  = " << params.get_heatbathsteps() << endl;
     *os << "## overrelaxsteps = " << params.get_overrelaxsteps() << endl;
+    if (params.get_multilevel_sublattice_extent() > 0) {
+        *os << "## multilevel sublattice extent = " << params.get_multilevel_sublattice_extent() << endl;
+        *os << "## multilevel updates           = " << params.get_multilevel_updates() << endl;
+    }
     *os << "## **********************************************************" << endl;
     return;
 }
@@ -252,6 +276,8 @@ static void print_info_fermion(const meta::Inputparameters& params)
         }
         logger.info() << "## cgmax  = " << params.get_cgmax();
         logger.info() << "## iter_refresh  = " << params.get_iter_refresh();
+        if (params.get_solver_multi_rhs_block_size() > 1)
+            logger.info() << "## Solve sources in blocks of " << params.get_solver_multi_rhs_block_size();
     } else {
         logger.info() << "## Use Multi-shifted CG-solver for inversions";
         logger.info() << "## cgm_max  = " << params.get_cgmax();
@@ -332,6 +358,8 @@ static void print_info_fermion(std::ostream* os, const meta::Inputparameters& pa
         }
         *os << "## cgmax  = " << params.get_cgmax() << endl;
         *os << "## iter_refresh  = " << params.get_iter_refresh() << endl;
+        if (params.get_solver_multi_rhs_block_size() > 1)
+            *os << "## Solve sources in blocks of " << params.get_solver_multi_rhs_block_size() << endl;
     } else {
         *os << "## Use Multi-shifted CG-solver for inversions" << endl;
         *os << "## cgm_max  = " << params.get_cgmax() << endl;
@@ -468,6 +496,9 @@ void meta::print_info_hmc(const Inputparameters& params)
     logger.info() << "## tau  = " << params.get_tau();
     logger.info() << "## HMC steps  = " << params.get_hmcsteps();
     logger.info() << "## precision used in HMC-inversions = " << params.get_force_prec();
+    if (params.get_force_solution_history_size() > 0)
+        logger.info() << "## extrapolate HMC-inversion trial solutions from the last "
+                      << params.get_force_solution_history_size() << " solutions";
     logger.info() << "##  ";
     logger.info() << "## # Timescales  = " << params.get_num_timescales();
     if (params.get_use_gauge_only() && params.get_num_timescales() == 1) {
@@ -530,6 +561,9 @@ void meta::print_info_hmc(std::ostream* os, const Inputparameters& params)
     *os << "## tau  = " << params.get_tau() << '\n';
     *os << "## HMC steps  = " << params.get_hmcsteps() << '\n';
     *os << "## precision used HMC-inversions = " << params.get_force_prec() << '\n';
+    if (params.get_force_solution_history_size() > 0)
+        *os << "## extrapolate HMC-inversion trial solutions from the last " << params.get_force_solution_history_size()
+            << " solutions" << '\n';
     *os << "##  " << '\n';
     *os << "## # Timescales  = " << params.get_num_timescales() << '\n';
     if (params.get_use_gauge_only() && params.get_num_timescales() == 1) {
@@ -606,6 +640,11 @@ void meta::print_info_rhmc(const Inputparameters& params)
     logger.info() << "##  ";
     logger.info() << "## Strategy for finding max and min MdagM eigenvalue: "
                   << (params.get_conservative() ? "conservative" : "NOT conservative");
+    logger.info() << "## Method for finding max and min MdagM eigenvalue: "
+                  << (params.get_findminmax_use_lanczos() ? "Lanczos" : "power method");
+    if (params.get_findminmax_reuse_plaquette_tolerance() > 0.)
+        logger.info() << "## Reuse max and min MdagM eigenvalue if the plaquette changed by less than "
+                      << params.get_findminmax_reuse_plaquette_tolerance();
     logger.info() << "##  ";
     logger.info() << "## Simulation info:";
     logger.info() << "##   - RHMC steps  = " << params.get_rhmcsteps();
@@ -695,6 +734,11 @@ void meta::print_info_rhmc(std::ostream* os, const Inputparameters& params)
     *os << "##  " << endl;
     *os << "## Strategy for finding max and min MdagM eigenvalue: "
         << (params.get_conservative() ? "conservative" : "NOT conservative") << endl;
+    *os << "## Method for finding max and min MdagM eigenvalue: "
+        << (params.get_findminmax_use_lanczos() ? "Lanczos" : "power method") << endl;
+    if (params.get_findminmax_reuse_plaquette_tolerance() > 0.)
+        *os << "## Reuse max and min MdagM eigenvalue if the plaquette changed by less than "
+            << params.get_findminmax_reuse_plaquette_tolerance() << endl;
     *os << "##  " << endl;
     *os << "## Simulation info:" << endl;
     *os << "##   - RHMC steps  = " << params.get_rhmcsteps() << endl;
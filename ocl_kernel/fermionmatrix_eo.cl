@@ -23,33 +23,68 @@
  @file fermionmatrix-functions for eoprec spinorfields
 */
 
-//"local" dslash working on a particular link (n,t) of an eoprec field
-// NOTE: each component is multiplied by +KAPPA, so the resulting spinor has to be mutliplied by -1 to obtain the
-// correct dslash!!! the difference to the "normal" dslash is that the coordinates of the neighbors have to be
-// transformed into an eoprec index
-spinor dslash_eoprec_unified_local(__global const spinorStorageType* const restrict in,
-                                   __global Matrixsu3StorageType const* const restrict field, const st_idx idx_arg,
-                                   const dir_idx dir, hmc_float kappa_in)
+// Splitting of the local sites into inner sites, which do not need the halo, and boundary sites, which do.
+// This allows to compute the inner sites while the halo is being exchanged.
+#define REQD_HALO_WIDTH 1
+#define HALO_VOL (VOLSPACE / 2 * REQD_HALO_WIDTH)
+
+// note that the scheme we are generating positions will no longer work for spatial seperation!
+size_t get_inner_id_local(const size_t id_loop)
 {
-    // this is used to save the idx of the neighbors
-    st_idx idx_neigh;
+    return id_loop + HALO_VOL;  // boost position by halo width
+}
 
-    spinor out_tmp, plus;
-    site_idx nn_eo;
-    su3vec psi, phi;
-    Matrixsu3 U;
-    // this is used to save the BC-conditions...
-    hmc_complex bc_tmp = (dir == TDIR) ? (hmc_complex){kappa_in * TEMPORAL_RE, kappa_in * TEMPORAL_IM}
-                                       : (hmc_complex){kappa_in * SPATIAL_RE, kappa_in * SPATIAL_IM};
-    out_tmp = set_spinor_zero();
+size_t get_boundary_id_local(const size_t id_loop)
+{
+    return (id_loop < HALO_VOL) ? id_loop : (EOPREC_SPINORFIELDSIZE_LOCAL - HALO_VOL + (id_loop - HALO_VOL));
+}
 
-    ///////////////////////////////////
-    // mu = +dir
-    idx_neigh = get_neighbor_from_st_idx(idx_arg, dir);
-    // transform normal indices to eoprec index
-    nn_eo = get_eo_site_idx_from_st_idx(idx_neigh);
-    plus  = getSpinor_eo(in, nn_eo);
-    U     = getSU3(field, get_link_idx(dir, idx_arg));
+// link used by the "local" dslash in direction +dir
+// if chemical potential is activated, the temporal link has to be multiplied by appropiate factor
+Matrixsu3 dslash_eoprec_link_up(__global Matrixsu3StorageType const* const restrict field, const st_idx idx_arg,
+                                const dir_idx dir)
+{
+    Matrixsu3 U = getSU3(field, get_link_idx(dir, idx_arg));
+    if (dir == TDIR) {
+#ifdef _CP_REAL_
+        U = multiply_matrixsu3_by_real(U, EXPCPR);
+#endif
+#ifdef _CP_IMAG_
+        hmc_complex cpi_tmp = {COSCPI, SINCPI};
+        U                   = multiply_matrixsu3_by_complex(U, cpi_tmp);
+#endif
+    }
+    return U;
+}
+
+// link used by the "local" dslash in direction -dir, idx_neigh being the lower neighbour of the site
+// if chemical potential is activated, the temporal link has to be multiplied by appropiate factor
+// this is the same as at mu=0 in the imag. case, since U is taken to be U^+ later:
+//  (exp(iq)U)^+ = exp(-iq)U^+
+// as it should be
+// in the real case, one has to take exp(q) -> exp(-q)
+Matrixsu3 dslash_eoprec_link_down(__global Matrixsu3StorageType const* const restrict field, const st_idx idx_neigh,
+                                  const dir_idx dir)
+{
+    Matrixsu3 U = getSU3(field, get_link_idx(dir, idx_neigh));
+    if (dir == TDIR) {
+#ifdef _CP_REAL_
+        U = multiply_matrixsu3_by_real(U, MEXPCPR);
+#endif
+#ifdef _CP_IMAG_
+        hmc_complex cpi_tmp2 = {COSCPI, SINCPI};
+        U                    = multiply_matrixsu3_by_complex(U, cpi_tmp2);
+#endif
+    }
+    return U;
+}
+
+// contribution of the neighbour spinor plus in direction +dir, accumulated to out_tmp
+// U has to be obtained from dslash_eoprec_link_up, bc_tmp contains kappa and the boundary conditions
+spinor dslash_eoprec_unified_local_up(spinor out_tmp, const spinor plus, const Matrixsu3 U, const dir_idx dir,
+                                      const hmc_complex bc_tmp)
+{
+    su3vec psi, phi;
     if (dir == XDIR) {
         /////////////////////////////////
         // Calculate (1 - gamma_1) y
@@ -111,14 +146,6 @@ spinor dslash_eoprec_unified_local(__global const spinorStorageType* const restr
         out_tmp.e1 = su3vec_acc(out_tmp.e1, psi);
         out_tmp.e3 = su3vec_acc_i(out_tmp.e3, psi);
     } else {  // TDIR
-              // if chemical potential is activated, U has to be multiplied by appropiate factor
-#ifdef _CP_REAL_
-        U = multiply_matrixsu3_by_real(U, EXPCPR);
-#endif
-#ifdef _CP_IMAG_
-        hmc_complex cpi_tmp = {COSCPI, SINCPI};
-        U                   = multiply_matrixsu3_by_complex(U, cpi_tmp);
-#endif
         ///////////////////////////////////
         // Calculate psi/phi = (1 - gamma_0) plus/y
         // with 1 - gamma_0:
@@ -143,16 +170,16 @@ spinor dslash_eoprec_unified_local(__global const spinorStorageType* const restr
         out_tmp.e3 = su3vec_acc(out_tmp.e3, psi);
     }
 
-    ///////////////////////////////////
-    // mu = -dir
-    idx_neigh = get_lower_neighbor_from_st_idx(idx_arg, dir);
-    // transform normal indices to eoprec index
-    nn_eo = get_eo_site_idx_from_st_idx(idx_neigh);
-    plus  = getSpinor_eo(in, nn_eo);
-    U     = getSU3(field, get_link_idx(dir, idx_neigh));
-    // in direction -mu, one has to take the complex-conjugated value of bc_tmp. this is done right here.
-    bc_tmp = (dir == TDIR) ? (hmc_complex){kappa_in * TEMPORAL_RE, kappa_in * MTEMPORAL_IM}
-                           : (hmc_complex){kappa_in * SPATIAL_RE, kappa_in * MSPATIAL_IM};
+    return out_tmp;
+}
+
+// contribution of the neighbour spinor plus in direction -dir, accumulated to out_tmp
+// U has to be obtained from dslash_eoprec_link_down, bc_tmp contains kappa and the complex-conjugated boundary
+// conditions
+spinor dslash_eoprec_unified_local_down(spinor out_tmp, const spinor plus, const Matrixsu3 U, const dir_idx dir,
+                                        const hmc_complex bc_tmp)
+{
+    su3vec psi, phi;
     if (dir == XDIR) {
         ///////////////////////////////////
         // Calculate (1 + gamma_1) y
@@ -214,18 +241,6 @@ spinor dslash_eoprec_unified_local(__global const spinorStorageType* const restr
         out_tmp.e1 = su3vec_acc(out_tmp.e1, psi);
         out_tmp.e3 = su3vec_dim_i(out_tmp.e3, psi);
     } else {  // TDIR
-              // if chemical potential is activated, U has to be multiplied by appropiate factor
-              // this is the same as at mu=0 in the imag. case, since U is taken to be U^+ later:
-              //  (exp(iq)U)^+ = exp(-iq)U^+
-              // as it should be
-              // in the real case, one has to take exp(q) -> exp(-q)
-#ifdef _CP_REAL_
-        U = multiply_matrixsu3_by_real(U, MEXPCPR);
-#endif
-#ifdef _CP_IMAG_
-        hmc_complex cpi_tmp2 = {COSCPI, SINCPI};
-        U                    = multiply_matrixsu3_by_complex(U, cpi_tmp2);
-#endif
         ///////////////////////////////////
         // Calculate psi/phi = (1 + gamma_0) y
         // with 1 + gamma_0:
@@ -251,3 +266,46 @@ spinor dslash_eoprec_unified_local(__global const spinorStorageType* const restr
 
     return out_tmp;
 }
+
+//"local" dslash working on a particular link (n,t) of an eoprec field
+// NOTE: each component is multiplied by +KAPPA, so the resulting spinor has to be mutliplied by -1 to obtain the
+// correct dslash!!! the difference to the "normal" dslash is that the coordinates of the neighbors have to be
+// transformed into an eoprec index
+spinor dslash_eoprec_unified_local(__global const spinorStorageType* const restrict in,
+                                   __global Matrixsu3StorageType const* const restrict field, const st_idx idx_arg,
+                                   const dir_idx dir, hmc_float kappa_in)
+{
+    // this is used to save the idx of the neighbors
+    st_idx idx_neigh;
+
+    spinor out_tmp, plus;
+    site_idx nn_eo;
+    Matrixsu3 U;
+    // this is used to save the BC-conditions...
+    hmc_complex bc_tmp = (dir == TDIR) ? (hmc_complex){kappa_in * TEMPORAL_RE, kappa_in * TEMPORAL_IM}
+                                       : (hmc_complex){kappa_in * SPATIAL_RE, kappa_in * SPATIAL_IM};
+    out_tmp = set_spinor_zero();
+
+    ///////////////////////////////////
+    // mu = +dir
+    idx_neigh = get_neighbor_from_st_idx(idx_arg, dir);
+    // transform normal indices to eoprec index
+    nn_eo   = get_eo_site_idx_from_st_idx(idx_neigh);
+    plus    = getSpinor_eo(in, nn_eo);
+    U       = dslash_eoprec_link_up(field, idx_arg, dir);
+    out_tmp = dslash_eoprec_unified_local_up(out_tmp, plus, U, dir, bc_tmp);
+
+    ///////////////////////////////////
+    // mu = -dir
+    idx_neigh = get_lower_neighbor_from_st_idx(idx_arg, dir);
+    // transform normal indices to eoprec index
+    nn_eo = get_eo_site_idx_from_st_idx(idx_neigh);
+    plus  = getSpinor_eo(in, nn_eo);
+    U     = dslash_eoprec_link_down(field, idx_neigh, dir);
+    // in direction -mu, one has to take the complex-conjugated value of bc_tmp. this is done right here.
+    bc_tmp = (dir == TDIR) ? (hmc_complex){kappa_in * TEMPORAL_RE, kappa_in * MTEMPORAL_IM}
+                           : (hmc_complex){kappa_in * SPATIAL_RE, kappa_in * MSPATIAL_IM};
+    out_tmp = dslash_eoprec_unified_local_down(out_tmp, plus, U, dir, bc_tmp);
+
+    return out_tmp;
+}
@@ -57,18 +57,13 @@ dslash_eo(__global const spinorStorageType* const restrict in, __global spinorSt
     }
 }
 
-#define REQD_HALO_WIDTH 1
-#define HALO_VOL (VOLSPACE / 2 * REQD_HALO_WIDTH)
-
 __kernel void
 dslash_eo_inner(__global const spinorStorageType* const restrict in, __global spinorStorageType* const restrict out,
                 __global const Matrixsu3StorageType* const restrict field, const int evenodd, hmc_float kappa_in)
 {
-    size_t id_local;
     PARALLEL_FOR (id_loop, EOPREC_SPINORFIELDSIZE_LOCAL - (2 * HALO_VOL)) {
-        // note that the scheme we are generating positions will no longer work for spatial seperation!
-        id_local   = id_loop + HALO_VOL;  // boost position by halo width
-        st_idx pos = (evenodd == ODD) ? get_even_st_idx_local(id_local) : get_odd_st_idx_local(id_local);
+        size_t id_local = get_inner_id_local(id_loop);
+        st_idx pos      = (evenodd == ODD) ? get_even_st_idx_local(id_local) : get_odd_st_idx_local(id_local);
         dslash_eo_for_site(in, out, field, evenodd, kappa_in, pos);
     }
 }
@@ -77,11 +72,106 @@ __kernel void
 dslash_eo_boundary(__global const spinorStorageType* const restrict in, __global spinorStorageType* const restrict out,
                    __global const Matrixsu3StorageType* const restrict field, const int evenodd, hmc_float kappa_in)
 {
-    size_t id_local;
     PARALLEL_FOR (id_loop, 2 * HALO_VOL) {
-        id_local = (id_loop < HALO_VOL) ? id_loop : (EOPREC_SPINORFIELDSIZE_LOCAL - HALO_VOL + (id_loop - HALO_VOL));
-        // note that the scheme we are generating positions will no longer work for spatial seperation!
-        st_idx pos = (evenodd == ODD) ? get_even_st_idx_local(id_local) : get_odd_st_idx_local(id_local);
+        size_t id_local = get_boundary_id_local(id_loop);
+        st_idx pos      = (evenodd == ODD) ? get_even_st_idx_local(id_local) : get_odd_st_idx_local(id_local);
         dslash_eo_for_site(in, out, field, evenodd, kappa_in, pos);
     }
 }
+
+// dslash_eo applied to up to four spinorfields at once
+// Each link is loaded only once per site and direction and then applied to all num_rhs input fields. Unused in/out
+// arguments still have to be valid buffers, but are not accessed.
+spinor getSpinor_eo_of_rhs(__global const spinorStorageType* const restrict in0,
+                           __global const spinorStorageType* const restrict in1,
+                           __global const spinorStorageType* const restrict in2,
+                           __global const spinorStorageType* const restrict in3, const int rhs, const site_idx idx)
+{
+    switch (rhs) {
+        case 0:
+            return getSpinor_eo(in0, idx);
+        case 1:
+            return getSpinor_eo(in1, idx);
+        case 2:
+            return getSpinor_eo(in2, idx);
+        default:
+            return getSpinor_eo(in3, idx);
+    }
+}
+
+void putSpinor_eo_of_rhs(__global spinorStorageType* const restrict out0,
+                         __global spinorStorageType* const restrict out1,
+                         __global spinorStorageType* const restrict out2,
+                         __global spinorStorageType* const restrict out3, const int rhs, const site_idx idx,
+                         const spinor in)
+{
+    switch (rhs) {
+        case 0:
+            putSpinor_eo(out0, idx, in);
+            break;
+        case 1:
+            putSpinor_eo(out1, idx, in);
+            break;
+        case 2:
+            putSpinor_eo(out2, idx, in);
+            break;
+        default:
+            putSpinor_eo(out3, idx, in);
+    }
+}
+
+#define DSLASH_EO_MULTI_MAX_RHS 4
+
+__kernel void dslash_eo_multi(__global const spinorStorageType* const restrict in0,
+                              __global const spinorStorageType* const restrict in1,
+                              __global const spinorStorageType* const restrict in2,
+                              __global const spinorStorageType* const restrict in3,
+                              __global spinorStorageType* const restrict out0,
+                              __global spinorStorageType* const restrict out1,
+                              __global spinorStorageType* const restrict out2,
+                              __global spinorStorageType* const restrict out3,
+                              __global const Matrixsu3StorageType* const restrict field, const int num_rhs,
+                              const int evenodd, hmc_float kappa_in)
+{
+    // spatial directions share the same BC-conditions
+    const hmc_complex bc_up_t = {kappa_in * TEMPORAL_RE, kappa_in * TEMPORAL_IM};
+    const hmc_complex bc_up_s = {kappa_in * SPATIAL_RE, kappa_in * SPATIAL_IM};
+    // in direction -mu, one has to take the complex-conjugated value of the BC-conditions
+    const hmc_complex bc_down_t = {kappa_in * TEMPORAL_RE, kappa_in * MTEMPORAL_IM};
+    const hmc_complex bc_down_s = {kappa_in * SPATIAL_RE, kappa_in * MSPATIAL_IM};
+
+    PARALLEL_FOR (id_local, EOPREC_SPINORFIELDSIZE_LOCAL) {
+        st_idx pos = (evenodd == ODD) ? get_even_st_idx_local(id_local) : get_odd_st_idx_local(id_local);
+
+        spinor out_tmp[DSLASH_EO_MULTI_MAX_RHS];
+        for (int rhs = 0; rhs < num_rhs; ++rhs) {
+            out_tmp[rhs] = set_spinor_zero();
+        }
+
+        // same order of directions as in dslash_eo_for_site, such that the results agree bit by bit
+        for (dir_idx dir = TDIR; dir <= ZDIR; ++dir) {
+            const st_idx idx_up       = get_neighbor_from_st_idx(pos, dir);
+            const st_idx idx_down     = get_lower_neighbor_from_st_idx(pos, dir);
+            const site_idx nn_eo_up   = get_eo_site_idx_from_st_idx(idx_up);
+            const site_idx nn_eo_down = get_eo_site_idx_from_st_idx(idx_down);
+            const Matrixsu3 U_up      = dslash_eoprec_link_up(field, pos, dir);
+            const Matrixsu3 U_down    = dslash_eoprec_link_down(field, idx_down, dir);
+            const hmc_complex bc_up   = (dir == TDIR) ? bc_up_t : bc_up_s;
+            const hmc_complex bc_down = (dir == TDIR) ? bc_down_t : bc_down_s;
+
+            for (int rhs = 0; rhs < num_rhs; ++rhs) {
+                spinor dir_tmp = set_spinor_zero();
+                spinor plus    = getSpinor_eo_of_rhs(in0, in1, in2, in3, rhs, nn_eo_up);
+                dir_tmp        = dslash_eoprec_unified_local_up(dir_tmp, plus, U_up, dir, bc_up);
+                plus           = getSpinor_eo_of_rhs(in0, in1, in2, in3, rhs, nn_eo_down);
+                dir_tmp        = dslash_eoprec_unified_local_down(dir_tmp, plus, U_down, dir, bc_down);
+                out_tmp[rhs]   = spinor_dim(out_tmp[rhs], dir_tmp);
+            }
+        }
+
+        const site_idx pos_eo = get_eo_site_idx_from_st_idx(pos);
+        for (int rhs = 0; rhs < num_rhs; ++rhs) {
+            putSpinor_eo_of_rhs(out0, out1, out2, out3, rhs, pos_eo, out_tmp[rhs]);
+        }
+    }
+}
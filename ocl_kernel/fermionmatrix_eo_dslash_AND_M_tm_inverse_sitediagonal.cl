@@ -27,36 +27,68 @@
 //    saves the outcoming spinor with an odd index.
 //    EVEN is then D_eo.
 
-__kernel void dslash_AND_M_tm_inverse_sitediagonal_eo(__global const spinorStorageType* const restrict in,
+void dslash_AND_M_tm_inverse_sitediagonal_eo_for_site(__global const spinorStorageType* const restrict in,
                                                       __global spinorStorageType* const restrict out,
                                                       __global const Matrixsu3StorageType* const restrict field,
-                                                      const int evenodd, hmc_float kappa_in, hmc_float mubar_in)
+                                                      const int evenodd, hmc_float kappa_in, hmc_float mubar_in,
+                                                      st_idx const pos)
 {
-    PARALLEL_FOR (id_local, EOPREC_SPINORFIELDSIZE_LOCAL) {
-        st_idx pos = (evenodd == ODD) ? get_even_st_idx_local(id_local) : get_odd_st_idx_local(id_local);
+    spinor out_tmp = set_spinor_zero();
+    spinor out_tmp2;
+
+    hmc_complex twistfactor       = {1., mubar_in};
+    hmc_complex twistfactor_minus = {1., -1. * mubar_in};
 
-        spinor out_tmp = set_spinor_zero();
-        spinor out_tmp2;
+    // calc dslash (this includes mutliplication with kappa)
 
-        hmc_complex twistfactor       = {1., mubar_in};
-        hmc_complex twistfactor_minus = {1., -1. * mubar_in};
+    out_tmp2 = dslash_eoprec_unified_local(in, field, pos, TDIR, kappa_in);
+    out_tmp  = spinor_dim(out_tmp, out_tmp2);
+    out_tmp2 = dslash_eoprec_unified_local(in, field, pos, XDIR, kappa_in);
+    out_tmp  = spinor_dim(out_tmp, out_tmp2);
+    out_tmp2 = dslash_eoprec_unified_local(in, field, pos, YDIR, kappa_in);
+    out_tmp  = spinor_dim(out_tmp, out_tmp2);
+    out_tmp2 = dslash_eoprec_unified_local(in, field, pos, ZDIR, kappa_in);
+    out_tmp  = spinor_dim(out_tmp, out_tmp2);
 
-        // calc dslash (this includes mutliplication with kappa)
+    // M_tm_inverse_sitediagonal part
+    out_tmp2        = M_diag_tm_local(out_tmp, twistfactor_minus, twistfactor);
+    hmc_float denom = 1. / (1. + mubar_in * mubar_in);
+    out_tmp         = real_multiply_spinor(out_tmp2, denom);
 
-        out_tmp2 = dslash_eoprec_unified_local(in, field, pos, TDIR, kappa_in);
-        out_tmp  = spinor_dim(out_tmp, out_tmp2);
-        out_tmp2 = dslash_eoprec_unified_local(in, field, pos, XDIR, kappa_in);
-        out_tmp  = spinor_dim(out_tmp, out_tmp2);
-        out_tmp2 = dslash_eoprec_unified_local(in, field, pos, YDIR, kappa_in);
-        out_tmp  = spinor_dim(out_tmp, out_tmp2);
-        out_tmp2 = dslash_eoprec_unified_local(in, field, pos, ZDIR, kappa_in);
-        out_tmp  = spinor_dim(out_tmp, out_tmp2);
+    putSpinor_eo(out, get_eo_site_idx_from_st_idx(pos), out_tmp);
+}
+
+__kernel void dslash_AND_M_tm_inverse_sitediagonal_eo(__global const spinorStorageType* const restrict in,
+                                                      __global spinorStorageType* const restrict out,
+                                                      __global const Matrixsu3StorageType* const restrict field,
+                                                      const int evenodd, hmc_float kappa_in, hmc_float mubar_in)
+{
+    PARALLEL_FOR (id_local, EOPREC_SPINORFIELDSIZE_LOCAL) {
+        st_idx pos = (evenodd == ODD) ? get_even_st_idx_local(id_local) : get_odd_st_idx_local(id_local);
+        dslash_AND_M_tm_inverse_sitediagonal_eo_for_site(in, out, field, evenodd, kappa_in, mubar_in, pos);
+    }
+}
 
-        // M_tm_inverse_sitediagonal part
-        out_tmp2        = M_diag_tm_local(out_tmp, twistfactor_minus, twistfactor);
-        hmc_float denom = 1. / (1. + mubar_in * mubar_in);
-        out_tmp         = real_multiply_spinor(out_tmp2, denom);
+__kernel void dslash_AND_M_tm_inverse_sitediagonal_eo_inner(__global const spinorStorageType* const restrict in,
+                                                            __global spinorStorageType* const restrict out,
+                                                            __global const Matrixsu3StorageType* const restrict field,
+                                                            const int evenodd, hmc_float kappa_in, hmc_float mubar_in)
+{
+    PARALLEL_FOR (id_loop, EOPREC_SPINORFIELDSIZE_LOCAL - (2 * HALO_VOL)) {
+        size_t id_local = get_inner_id_local(id_loop);
+        st_idx pos      = (evenodd == ODD) ? get_even_st_idx_local(id_local) : get_odd_st_idx_local(id_local);
+        dslash_AND_M_tm_inverse_sitediagonal_eo_for_site(in, out, field, evenodd, kappa_in, mubar_in, pos);
+    }
+}
 
-        putSpinor_eo(out, get_eo_site_idx_from_st_idx(pos), out_tmp);
+__kernel void dslash_AND_M_tm_inverse_sitediagonal_eo_boundary(
+    __global const spinorStorageType* const restrict in, __global spinorStorageType* const restrict out,
+    __global const Matrixsu3StorageType* const restrict field, const int evenodd, hmc_float kappa_in,
+    hmc_float mubar_in)
+{
+    PARALLEL_FOR (id_loop, 2 * HALO_VOL) {
+        size_t id_local = get_boundary_id_local(id_loop);
+        st_idx pos      = (evenodd == ODD) ? get_even_st_idx_local(id_local) : get_odd_st_idx_local(id_local);
+        dslash_AND_M_tm_inverse_sitediagonal_eo_for_site(in, out, field, evenodd, kappa_in, mubar_in, pos);
     }
 }
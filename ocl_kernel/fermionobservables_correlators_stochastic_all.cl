@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ @file fermion-observables: all correlators calculated from stochastic sources in a single pass over the fields
+*/
+
+// the channels in the order they are stored in the output of correlator_all_t
+#define NUM_CORRELATOR_CHANNELS 8
+#define CHANNEL_PS 0
+#define CHANNEL_SC 1
+#define CHANNEL_VX 2
+#define CHANNEL_VY 3
+#define CHANNEL_VZ 4
+#define CHANNEL_AX 5
+#define CHANNEL_AY 6
+#define CHANNEL_AZ 7
+
+/**
+ * Add the contributions of one site to the correlators of all channels.
+ *
+ * The signs are the ones of the kernels of the individual channels in fermionobservables_correlators_stochastic.cl,
+ * the normalisation is applied once per timeslice.
+ */
+void add_site_to_all_correlators(const spinor phi1, const spinor phi2, const spinor phi3, const spinor phi4,
+                                 hmc_float* const restrict correlator)
+{
+    const hmc_float n1[4] = {su3vec_squarenorm(phi1.e0), su3vec_squarenorm(phi1.e1), su3vec_squarenorm(phi1.e2),
+                             su3vec_squarenorm(phi1.e3)};
+    const hmc_float n2[4] = {su3vec_squarenorm(phi2.e0), su3vec_squarenorm(phi2.e1), su3vec_squarenorm(phi2.e2),
+                             su3vec_squarenorm(phi2.e3)};
+    const hmc_float n3[4] = {su3vec_squarenorm(phi3.e0), su3vec_squarenorm(phi3.e1), su3vec_squarenorm(phi3.e2),
+                             su3vec_squarenorm(phi3.e3)};
+    const hmc_float n4[4] = {su3vec_squarenorm(phi4.e0), su3vec_squarenorm(phi4.e1), su3vec_squarenorm(phi4.e2),
+                             su3vec_squarenorm(phi4.e3)};
+
+    // real parts of the products of the Dirac components (0,1), (1,0), (2,3) and (3,2)
+    const hmc_float r12[4] = {
+        su3vec_scalarproduct(phi1.e0, phi2.e1).re, su3vec_scalarproduct(phi1.e1, phi2.e0).re,
+        su3vec_scalarproduct(phi1.e2, phi2.e3).re, su3vec_scalarproduct(phi1.e3, phi2.e2).re};
+    const hmc_float r34[4] = {
+        su3vec_scalarproduct(phi3.e0, phi4.e1).re, su3vec_scalarproduct(phi3.e1, phi4.e0).re,
+        su3vec_scalarproduct(phi3.e2, phi4.e3).re, su3vec_scalarproduct(phi3.e3, phi4.e2).re};
+
+    correlator[CHANNEL_PS] += n1[0] + n1[1] + n1[2] + n1[3] + n2[0] + n2[1] + n2[2] + n2[3] + n3[0] + n3[1] + n3[2] +
+                              n3[3] + n4[0] + n4[1] + n4[2] + n4[3];
+    correlator[CHANNEL_SC] += -n1[0] - n1[1] + n1[2] + n1[3] - n2[0] - n2[1] + n2[2] + n2[3] + n3[0] + n3[1] - n3[2] -
+                              n3[3] + n4[0] + n4[1] - n4[2] - n4[3];
+    correlator[CHANNEL_VX] += r12[0] + r12[1] + r12[2] + r12[3] + r34[0] + r34[1] + r34[2] + r34[3];
+    correlator[CHANNEL_VY] += r12[0] - r12[1] + r12[2] - r12[3] + r34[0] - r34[1] + r34[2] - r34[3];
+    correlator[CHANNEL_VZ] += n1[0] - n1[1] + n1[2] - n1[3] - n2[0] + n2[1] - n2[2] + n2[3] + n3[0] - n3[1] + n3[2] -
+                              n3[3] - n4[0] + n4[1] - n4[2] + n4[3];
+    correlator[CHANNEL_AX] += r12[0] + r12[1] - r12[2] - r12[3] - r34[0] - r34[1] + r34[2] + r34[3];
+    correlator[CHANNEL_AY] += r12[0] - r12[1] - r12[2] + r12[3] - r34[0] + r34[1] + r34[2] - r34[3];
+    correlator[CHANNEL_AZ] += n1[0] - n1[1] - n1[2] + n1[3] - n2[0] + n2[1] + n2[2] - n2[3] - n3[0] + n3[1] + n3[2] -
+                              n3[3] + n4[0] - n4[1] - n4[2] + n4[3];
+}
+
+/**
+ * All correlators in t-direction from stochastic sources.
+ *
+ * out holds NUM_CORRELATOR_CHANNELS blocks of NTIME_GLOBAL entries, to each of which the same is added as by the
+ * kernel of the individual channel. Each work-group handles whole timeslices, such that the spinors of a site are
+ * loaded only once and the partial sums of the work-items can be reduced in local memory.
+ */
+__kernel void correlator_all_t(__global hmc_float* const restrict out, __global const spinor* const restrict phi1,
+                               __global const spinor* const restrict phi2, __global const spinor* const restrict phi3,
+                               __global const spinor* const restrict phi4,
+                               __local hmc_float* const restrict result_local)
+{
+    const int local_size = get_local_size(0);
+    const int idx        = get_local_id(0);
+
+    // one factor of 2*kappa per field, the vector and axial vector ones get the factor 2 of the individual kernels
+    const hmc_float fac = 2. * KAPPA * 2. * KAPPA / (NSPACE * NSPACE * NSPACE);
+
+    const hmc_float channel_fac[NUM_CORRELATOR_CHANNELS] = {fac,      fac,       2. * fac,  2. * fac,
+                                                            fac,      -2. * fac, -2. * fac, -fac};
+
+    for (int t = get_group_id(0); t < NTIME_LOCAL; t += get_num_groups(0)) {
+        hmc_float correlator[NUM_CORRELATOR_CHANNELS];
+        for (int i = 0; i < NUM_CORRELATOR_CHANNELS; i++) {
+            correlator[i] = 0.;
+        }
+
+        for (int nspace = idx; nspace < VOLSPACE; nspace += local_size) {
+            const int pos = get_pos(nspace, t);
+            add_site_to_all_correlators(phi1[pos], phi2[pos], phi3[pos], phi4[pos], correlator);
+        }
+
+        // perform local reduction, which does not require the local size to be a power of two
+        for (int i = 0; i < NUM_CORRELATOR_CHANNELS; i++) {
+            result_local[i * local_size + idx] = correlator[i];
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+        for (int active = local_size; active > 1;) {
+            const int half = (active + 1) / 2;
+            if (idx < active - half) {
+                for (int i = 0; i < NUM_CORRELATOR_CHANNELS; i++) {
+                    result_local[i * local_size + idx] += result_local[i * local_size + idx + half];
+                }
+            }
+            barrier(CLK_LOCAL_MEM_FENCE);
+            active = half;
+        }
+
+        if (idx == 0) {
+            for (int i = 0; i < NUM_CORRELATOR_CHANNELS; i++) {
+                out[i * NTIME_GLOBAL + NTIME_OFFSET + t] += channel_fac[i] * result_local[i * local_size];
+            }
+        }
+        // the local memory is reused for the next timeslice
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+}
@@ -46,3 +46,69 @@ convertGaugefieldFromSOA(__global Matrixsu3* const restrict out, __global const
         }
     }
 }
+
+/**
+ * Position of the first link of the given local site in the array of the contraction code.
+ *
+ * There the spatial index runs with z fastest, then y and x, the time being the slowest coordinate. Each site holds
+ * its NDIM links and each link its NC * NC elements row by row as pairs of real and imaginary part. The array of a
+ * device only holds its local timeslices, which are a contiguous part of the array of the whole lattice.
+ */
+inline size_t get_contraction_code_link_offset(const st_idx site, const dir_idx mu)
+{
+    const coord_spatial coord = get_coord_spatial(site.space);
+    const size_t site_index   = coord.z + NSPACE * (coord.y + NSPACE * (coord.x + NSPACE * site.time));
+    return 2 * NC * NC * (mu + NDIM * site_index);
+}
+
+__kernel void convertGaugefieldToContractionCode(__global hmc_float* const restrict out,
+                                                 __global const Matrixsu3StorageType* const restrict in)
+{
+    PARALLEL_FOR (id, VOL4D_LOCAL) {
+        const st_idx site = get_st_idx_from_site_idx(id);
+        for (dir_idx mu = 0; mu < NDIM; ++mu) {
+            const Matrixsu3 tmp            = get_matrixsu3(in, site.space, site.time, mu);
+            __global hmc_float* const dest = out + get_contraction_code_link_offset(site, mu);
+            dest[0]                        = tmp.e00.re;
+            dest[1]                        = tmp.e00.im;
+            dest[2]                        = tmp.e01.re;
+            dest[3]                        = tmp.e01.im;
+            dest[4]                        = tmp.e02.re;
+            dest[5]                        = tmp.e02.im;
+            dest[6]                        = tmp.e10.re;
+            dest[7]                        = tmp.e10.im;
+            dest[8]                        = tmp.e11.re;
+            dest[9]                        = tmp.e11.im;
+            dest[10]                       = tmp.e12.re;
+            dest[11]                       = tmp.e12.im;
+            dest[12]                       = tmp.e20.re;
+            dest[13]                       = tmp.e20.im;
+            dest[14]                       = tmp.e21.re;
+            dest[15]                       = tmp.e21.im;
+            dest[16]                       = tmp.e22.re;
+            dest[17]                       = tmp.e22.im;
+        }
+    }
+}
+
+__kernel void convertGaugefieldFromContractionCode(__global Matrixsu3StorageType* const restrict out,
+                                                   __global const hmc_float* const restrict in)
+{
+    PARALLEL_FOR (id, VOL4D_LOCAL) {
+        const st_idx site = get_st_idx_from_site_idx(id);
+        for (dir_idx mu = 0; mu < NDIM; ++mu) {
+            __global const hmc_float* const src = in + get_contraction_code_link_offset(site, mu);
+            Matrixsu3 tmp;
+            tmp.e00 = (hmc_complex){src[0], src[1]};
+            tmp.e01 = (hmc_complex){src[2], src[3]};
+            tmp.e02 = (hmc_complex){src[4], src[5]};
+            tmp.e10 = (hmc_complex){src[6], src[7]};
+            tmp.e11 = (hmc_complex){src[8], src[9]};
+            tmp.e12 = (hmc_complex){src[10], src[11]};
+            tmp.e20 = (hmc_complex){src[12], src[13]};
+            tmp.e21 = (hmc_complex){src[14], src[15]};
+            tmp.e22 = (hmc_complex){src[16], src[17]};
+            put_matrixsu3(out, tmp, site.space, site.time, mu);
+        }
+    }
+}
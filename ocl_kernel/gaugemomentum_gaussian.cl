@@ -40,6 +40,7 @@ __kernel void generate_gaussian_gaugemomenta(__global aeStorageType* const restr
 #endif
         site_idx site = get_site_idx(id_local >= (VOL4D_LOCAL / 2) ? get_even_st_idx_local(id_local - (VOL4D_LOCAL / 2))
                                                                    : get_odd_st_idx_local(id_local));
+        prng_enterSite(&rnd, get_global_site_idx(get_st_idx_from_site_idx(site)));
         for (uint d = 0; d < 4; ++d) {
             const link_idx id_mem = get_link_idx(d, get_st_idx_from_site_idx(site));
             // CP: THERE ARE 8 ELEMENTS IN AE
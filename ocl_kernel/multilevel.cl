@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ * Device code for the multilevel algorithm
+ */
+
+/**
+ * Add the products of the temporal links through each sublattice of this device to the accumulated ones.
+ *
+ * The local timeslices are grouped in sublattices of sublattice_extent timeslices each. For every spatial site and
+ * every sublattice the product of the temporal links from the lower to the upper boundary of the sublattice is added
+ * to transporters[sublattice * VOLSPACE + site]. All sublattices are treated in the same launch.
+ */
+__kernel void multilevel_accumulate_transporters(__global Matrix3x3* const restrict transporters,
+                                                 __global const Matrixsu3StorageType* const restrict gaugefield,
+                                                 const uint sublattice_extent)
+{
+    PARALLEL_FOR (id, VOLSPACE * (NTIME_LOCAL / sublattice_extent)) {
+        const uint site       = id % VOLSPACE;
+        const uint sublattice = id / VOLSPACE;
+
+        Matrixsu3 prod = unit_matrixsu3();
+        for (uint t = sublattice * sublattice_extent; t < (sublattice + 1) * sublattice_extent; ++t) {
+            prod = multiply_matrixsu3(prod, get_matrixsu3(gaugefield, site, t, 0));
+        }
+        transporters[id] = add_matrix3x3(transporters[id], matrix_su3to3x3(prod));
+    }
+}
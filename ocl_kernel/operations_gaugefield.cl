@@ -26,49 +26,141 @@
 
 // operations_gaugefield.cl
 
-// TODO document
+#if defined(_USE_SOA_) && (defined(_USE_REC12_) || defined(_USE_REC8_))
+/**
+ * The third row of an SU(3) matrix is the complex conjugate of the cross product of the first two rows.
+ */
+inline Matrixsu3 reconstruct_third_row(Matrixsu3 u)
+{
+    u.e20 = complexconj(complexsubtract(complexmult(u.e01, u.e12), complexmult(u.e02, u.e11)));
+    u.e21 = complexconj(complexsubtract(complexmult(u.e02, u.e10), complexmult(u.e00, u.e12)));
+    u.e22 = complexconj(complexsubtract(complexmult(u.e00, u.e11), complexmult(u.e01, u.e10)));
+    return u;
+}
+#endif
+
+#if defined(_USE_SOA_) && defined(_USE_REC8_)
+/**
+ * With reconstruct 8 a link is stored as the phases of e00 and e20 followed by e01, e02 and e10.
+ *
+ * The moduli of e00 and e20 follow from the normalization of the first row and of the first column, e11 and e12 from
+ * the orthogonality of the first two rows and from det(U) = 1. The latter step divides by |e01|^2 + |e02|^2, hence
+ * links whose first row is close to (1, 0, 0) are stored with the first two columns swapped (and one of them negated,
+ * to keep the determinant), which is flagged by shifting the stored phase of e00 by 4 PI.
+ */
+inline Matrixsu3 reconstruct8(hmc_complex phases, const hmc_complex e01, const hmc_complex e02, const hmc_complex e10)
+{
+    const bool swapped = phases.re > 2. * PI;
+    if (swapped)
+        phases.re -= 4. * PI;
+
+    Matrixsu3 u;
+    u.e01 = e01;
+    u.e02 = e02;
+    u.e10 = e10;
+
+    const hmc_float norm   = e01.re * e01.re + e01.im * e01.im + e02.re * e02.re + e02.im * e02.im;
+    const hmc_float e00abs = sqrt(fmax((hmc_float)(1. - norm), (hmc_float)0.));
+    const hmc_float e20abs = sqrt(fmax((hmc_float)(norm - e10.re * e10.re - e10.im * e10.im), (hmc_float)0.));
+    u.e00                  = (hmc_complex){e00abs * cos(phases.re), e00abs * sin(phases.re)};
+    const hmc_complex e20  = (hmc_complex){e20abs * cos(phases.im), e20abs * sin(phases.im)};
+
+    const hmc_complex tmp = complexmult(complexconj(u.e00), e10);
+    const hmc_complex e11 = complexadd(complexmult(tmp, e01), complexmult(complexconj(e02), complexconj(e20)));
+    const hmc_complex e12 = complexsubtract(complexmult(complexconj(e01), complexconj(e20)), complexmult(tmp, e02));
+    u.e11                 = (hmc_complex){-e11.re / norm, -e11.im / norm};
+    u.e12                 = (hmc_complex){e12.re / norm, e12.im / norm};
+    u                     = reconstruct_third_row(u);
+
+    if (swapped) {
+        Matrixsu3 out = u;
+        out.e00       = u.e01;
+        out.e10       = u.e11;
+        out.e20       = u.e21;
+        out.e01       = (hmc_complex){-u.e00.re, -u.e00.im};
+        out.e11       = (hmc_complex){-u.e10.re, -u.e10.im};
+        out.e21       = (hmc_complex){-u.e20.re, -u.e20.im};
+        return out;
+    }
+    return u;
+}
+
+inline hmc_float complexarg(const hmc_complex in)
+{
+    return atan2(in.im, in.re);
+}
+#endif
+
+/**
+ * Read the link at the given index of a gaugefield buffer.
+ *
+ * In SOA storage the links can be compressed, with reconstruct 12 only the first two rows are stored, with
+ * reconstruct 8 only eight real numbers (see reconstruct8), and the remaining elements are recomputed here.
+ */
 inline Matrixsu3 getSU3(__global const Matrixsu3StorageType* const restrict in, const uint idx)
 {
 #ifdef _USE_SOA_
-#    ifdef _USE_REC12_
-    // CP: this should be the most straightforward implementation
-    return (Matrixsu3){in[0 * GAUGEFIELD_STRIDE + idx],
-                       in[1 * GAUGEFIELD_STRIDE + idx],
-                       in[2 * GAUGEFIELD_STRIDE + idx],
-                       in[3 * GAUGEFIELD_STRIDE + idx],
-                       in[4 * GAUGEFIELD_STRIDE + idx],
-                       in[5 * GAUGEFIELD_STRIDE + idx],
-                       complexsubtract(complexmult(in[1 * GAUGEFIELD_STRIDE + idx], in[5 * GAUGEFIELD_STRIDE + idx]),
-                                       complexmult(in[2 * GAUGEFIELD_STRIDE + idx], in[4 * GAUGEFIELD_STRIDE + idx])),
-                       complexsubtract(complexmult(in[2 * GAUGEFIELD_STRIDE + idx], in[3 * GAUGEFIELD_STRIDE + idx]),
-                                       complexmult(in[0 * GAUGEFIELD_STRIDE + idx], in[5 * GAUGEFIELD_STRIDE + idx])),
-                       complexsubtract(complexmult(in[0 * GAUGEFIELD_STRIDE + idx], in[4 * GAUGEFIELD_STRIDE + idx]),
-                                       complexmult(in[1 * GAUGEFIELD_STRIDE + idx], in[3 * GAUGEFIELD_STRIDE + idx]))};
-#    else   // _USE_REC12_
+#    if defined(_USE_REC12_)
+    return reconstruct_third_row((Matrixsu3){in[0 * GAUGEFIELD_STRIDE + idx],
+                                             in[1 * GAUGEFIELD_STRIDE + idx],
+                                             in[2 * GAUGEFIELD_STRIDE + idx],
+                                             in[3 * GAUGEFIELD_STRIDE + idx],
+                                             in[4 * GAUGEFIELD_STRIDE + idx],
+                                             in[5 * GAUGEFIELD_STRIDE + idx],
+                                             {0., 0.},
+                                             {0., 0.},
+                                             {0., 0.}});
+#    elif defined(_USE_REC8_)
+    return reconstruct8(in[0 * GAUGEFIELD_STRIDE + idx], in[1 * GAUGEFIELD_STRIDE + idx],
+                        in[2 * GAUGEFIELD_STRIDE + idx], in[3 * GAUGEFIELD_STRIDE + idx]);
+#    else
     return (
         Matrixsu3){in[0 * GAUGEFIELD_STRIDE + idx], in[1 * GAUGEFIELD_STRIDE + idx], in[2 * GAUGEFIELD_STRIDE + idx],
                    in[3 * GAUGEFIELD_STRIDE + idx], in[4 * GAUGEFIELD_STRIDE + idx], in[5 * GAUGEFIELD_STRIDE + idx],
                    in[6 * GAUGEFIELD_STRIDE + idx], in[7 * GAUGEFIELD_STRIDE + idx], in[8 * GAUGEFIELD_STRIDE + idx]};
-#    endif  // _USE_REC12_
-#else       // _USE_SOA_
-    // printf("%i\n", idx);
+#    endif
+#else  // _USE_SOA_
     return in[idx];
 #endif
 }
 
-// TODO document
+/**
+ * Write the link at the given index of a gaugefield buffer, dropping the elements that are not stored if the links
+ * are compressed. The link is assumed to be in SU(3), which the reconstruction relies on.
+ */
 inline void putSU3(__global Matrixsu3StorageType* const restrict out, const uint idx, const Matrixsu3 val)
 {
 #ifdef _USE_SOA_
+#    if defined(_USE_REC8_)
+    const hmc_float norm = val.e01.re * val.e01.re + val.e01.im * val.e01.im + val.e02.re * val.e02.re +
+                           val.e02.im * val.e02.im;
+    if (norm < 0.5) {
+        // first row close to (1, 0, 0), store the columns (-e.1, e.0, e.2) instead, see reconstruct8
+        out[0 * GAUGEFIELD_STRIDE + idx] =
+            (hmc_complex){complexarg((hmc_complex){-val.e01.re, -val.e01.im}) + 4. * PI,
+                          complexarg((hmc_complex){-val.e21.re, -val.e21.im})};
+        out[1 * GAUGEFIELD_STRIDE + idx] = val.e00;
+        out[2 * GAUGEFIELD_STRIDE + idx] = val.e02;
+        out[3 * GAUGEFIELD_STRIDE + idx] = (hmc_complex){-val.e11.re, -val.e11.im};
+    } else {
+        out[0 * GAUGEFIELD_STRIDE + idx] = (hmc_complex){complexarg(val.e00), complexarg(val.e20)};
+        out[1 * GAUGEFIELD_STRIDE + idx] = val.e01;
+        out[2 * GAUGEFIELD_STRIDE + idx] = val.e02;
+        out[3 * GAUGEFIELD_STRIDE + idx] = val.e10;
+    }
+#    else
     out[0 * GAUGEFIELD_STRIDE + idx] = val.e00;
     out[1 * GAUGEFIELD_STRIDE + idx] = val.e01;
     out[2 * GAUGEFIELD_STRIDE + idx] = val.e02;
     out[3 * GAUGEFIELD_STRIDE + idx] = val.e10;
     out[4 * GAUGEFIELD_STRIDE + idx] = val.e11;
     out[5 * GAUGEFIELD_STRIDE + idx] = val.e12;
+#        ifndef _USE_REC12_
     out[6 * GAUGEFIELD_STRIDE + idx] = val.e20;
     out[7 * GAUGEFIELD_STRIDE + idx] = val.e21;
     out[8 * GAUGEFIELD_STRIDE + idx] = val.e22;
+#        endif
+#    endif
 #else
     out[idx] = val;
 #endif
@@ -167,6 +167,14 @@ st_idx inline get_st_idx_from_site_idx(const site_idx in)
     return tmp;
 }
 
+/**
+ * Index of a local site in the whole lattice, i.e. the same for any number of devices.
+ */
+uint inline get_global_site_idx(const st_idx in)
+{
+    return in.space + VOLSPACE * (in.time + NTIME_OFFSET);
+}
+
 /** returns eo-vector component from st_idx */
 site_idx get_eo_site_idx_from_st_idx(st_idx in);
 st_idx get_odd_st_idx(const site_idx idx);
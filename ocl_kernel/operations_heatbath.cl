@@ -61,6 +61,22 @@ inline Matrixsu2_pauli SU2Update(const hmc_float alpha, prng_state* const restri
     return out;
 }
 
+/**
+ * Spatial links on the given (global) timeslices are kept fixed by the heatbath and the overrelaxation,
+ * the temporal links are always updated.
+ */
+inline bool is_frozen_link(const int mu, const coord_temporal t_local, const int fixed_timeslice_num,
+                           __constant const int* const fixed_timeslices)
+{
+    if (mu == 0)
+        return false;
+    const coord_temporal t_GLOBAL = GRID_POS_LOCAL * T_EXTENT_LOCAL + t_local;
+    for (int i = 0; i < fixed_timeslice_num; ++i)
+        if (t_GLOBAL == fixed_timeslices[i])
+            return true;
+    return false;
+}
+
 void inline perform_heatbath(__global Matrixsu3StorageType* const restrict gaugefield, const int mu,
                              prng_state* const restrict rnd, const int pos, const int t)
 {
@@ -24,6 +24,29 @@
  *
  */
 
+#ifdef _USE_SOA_
+/**
+ * Conversion of the complex numbers of fermion fields from and to their storage type.
+ */
+inline hmc_complex load_fermion_storage(const fermionStorageComplex in)
+{
+#    ifdef _USE_SINGLEPREC_FERMION_STORAGE_
+    return (hmc_complex){in.re, in.im};
+#    else
+    return in;
+#    endif
+}
+
+inline fermionStorageComplex store_fermion_storage(const hmc_complex in)
+{
+#    ifdef _USE_SINGLEPREC_FERMION_STORAGE_
+    return (fermionStorageComplex){(float)in.re, (float)in.im};
+#    else
+    return in;
+#    endif
+}
+#endif
+
 #ifdef ENABLE_PRINTF
 void print_su3vec(su3vec in)
 {
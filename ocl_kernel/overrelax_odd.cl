@@ -24,14 +24,17 @@
  */
 
 __kernel void overrelax_odd(__global Matrixsu3StorageType* const restrict gaugefield, const int mu,
-                            __global rngStateStorageType* const restrict rngStates)
+                            __global rngStateStorageType* const restrict rngStates,
+                            const int fixed_timeslice_num, __constant const int* const fixed_timeslices)
 {
     prng_state rnd;
     prng_loadState(&rnd, rngStates);
 
     PARALLEL_FOR (id, VOL4D_LOCAL / 2) {
         st_index pos = get_odd_st_idx_local(id);
-        perform_overrelaxing(gaugefield, mu, &rnd, pos.space, pos.time);
+        prng_enterSite(&rnd, get_global_site_idx(pos));
+        if (!is_frozen_link(mu, pos.time, fixed_timeslice_num, fixed_timeslices))
+            perform_overrelaxing(gaugefield, mu, &rnd, pos.space, pos.time);
     }
 
     prng_storeState(rngStates, &rnd);
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file
+ * Counter-based Philox4x32-10 generator (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC11).
+ *
+ * A block of four random numbers is a pure function of a 64 bit key and a 128 bit counter. The state in global memory
+ * is a uint4 per work-item holding the seed, the index of the device and the number of kernel calls that drew random
+ * numbers so far. It is the same for all work-items of a device. Within a kernel, the numbers are drawn from one of
+ * two kinds of streams:
+ *  - the stream of the work-item, keyed by the seed and the global id, the device being part of the counter,
+ *  - the stream of a lattice site, keyed by the seed and the global index of the site.
+ * The numbers of a site stream thus do not depend on how the lattice is distributed over devices and work-items.
+ */
+
+#define PHILOX_M4x32_0 0xD2511F53u
+#define PHILOX_M4x32_1 0xCD9E8D57u
+#define PHILOX_W32_0 0x9E3779B9u
+#define PHILOX_W32_1 0xBB67AE85u
+#define PHILOX_ROUNDS 10
+
+typedef struct {
+    // seed, device and number of kernel calls (low and high word) as stored in global memory
+    uint4 stored;
+    // key and counter of the current stream, the counter being the block, the kernel call and the kind of stream
+    uint2 key;
+    uint4 counter;
+} philox_state;
+
+uint4 philox4x32_round(const uint4 ctr, const uint2 key)
+{
+    const uint hi0 = mul_hi(PHILOX_M4x32_0, ctr.x);
+    const uint lo0 = PHILOX_M4x32_0 * ctr.x;
+    const uint hi1 = mul_hi(PHILOX_M4x32_1, ctr.z);
+    const uint lo1 = PHILOX_M4x32_1 * ctr.z;
+    return (uint4)(hi1 ^ ctr.y ^ key.x, lo1, hi0 ^ ctr.w ^ key.y, lo0);
+}
+
+uint4 philox4x32_10(uint4 ctr, uint2 key)
+{
+    ctr = philox4x32_round(ctr, key);
+    for (int round = 1; round < PHILOX_ROUNDS; round++) {
+        key.x += PHILOX_W32_0;
+        key.y += PHILOX_W32_1;
+        ctr = philox4x32_round(ctr, key);
+    }
+    return ctr;
+}
+
+/**
+ * Start drawing from the stream of the work-item. The site streams use 0 as kind, hence the device is shifted by one.
+ */
+void philox_enter_work_item_stream(philox_state* const restrict state)
+{
+    state->key     = (uint2)(state->stored.x, get_global_id(0));
+    state->counter = (uint4)(0u, state->stored.zw, state->stored.y + 1u);
+}
+
+/**
+ * Start drawing from the stream of the site with the given global index.
+ */
+void philox_enter_site_stream(philox_state* const restrict state, const uint global_site)
+{
+    state->key     = (uint2)(state->stored.x, global_site);
+    state->counter = (uint4)(0u, state->stored.zw, 0u);
+}
+
+/**
+ * Continue as if a new kernel was called, i.e. with fresh streams.
+ */
+void philox_next_call(philox_state* const restrict state)
+{
+    state->stored.z++;
+    if (state->stored.z == 0u) {
+        state->stored.w++;
+    }
+    philox_enter_work_item_stream(state);
+}
+
+void philox_download_state(philox_state* const restrict state, __global const uint4* const restrict states)
+{
+    state->stored = states[get_global_id(0)];
+    philox_enter_work_item_stream(state);
+}
+
+/**
+ * Count the kernel call in the state of the work-item.
+ *
+ * All states of a device have to count the same number of calls, hence the first work-item also updates the states
+ * beyond the global size of the kernel, which are not touched by any other work-item.
+ */
+void philox_upload_state(philox_state* const restrict state, __global uint4* const restrict states)
+{
+    philox_next_call(state);
+    states[get_global_id(0)] = state->stored;
+    if (get_global_id(0) == 0) {
+        for (uint i = get_global_size(0); i < PRNG_NUMBER_OF_STATES; i++) {
+            states[i] = state->stored;
+        }
+    }
+}
+
+/**
+ * Draw the next block of the current stream and convert it into four floats in (0,1), end points not included as
+ * for ranluxcl.
+ */
+float4 philox_float4(philox_state* const restrict state)
+{
+    const uint4 bits = philox4x32_10(state->counter, state->key);
+    state->counter.x++;
+    // use the upper 24 bits, which are exactly representable as float
+    return (convert_float4(bits >> 8) + 0.5f) * (1.f / 16777216.f);
+}
@@ -28,6 +28,9 @@
 #ifdef USE_PRNG_RANLUX
 typedef ranluxcl_state_t prng_state;
 typedef float4 rngStateStorageType;
+#elif defined(USE_PRNG_PHILOX)
+typedef philox_state prng_state;
+typedef uint4 rngStateStorageType;
 #else  // USE_PRNG_XXX
 #    error No implemented PRNG selected
 #endif  // USE_PRNG_XXX
@@ -39,6 +42,8 @@ void prng_loadState(prng_state* const restrict state, __global rngStateStorageTy
 {
 #ifdef USE_PRNG_RANLUX
     ranluxcl_download_seed(state, states);
+#elif defined(USE_PRNG_PHILOX)
+    philox_download_state(state, states);
 #else  // USE_PRNG_XXX
 #    error No implemented PRNG selected
 #endif  // USE_PRNG_XXX
@@ -51,6 +56,8 @@ void prng_storeState(__global rngStateStorageType* const restrict states, prng_s
 {
 #ifdef USE_PRNG_RANLUX
     ranluxcl_upload_seed(state, states);
+#elif defined(USE_PRNG_PHILOX)
+    philox_upload_state(state, states);
 #else  // USE_PRNG_XXX
 #    error No implemented PRNG selected
 #endif  // USE_PRNG_XXX
@@ -68,6 +75,9 @@ uint prng_int32(uint range, prng_state* const restrict state)
 #ifdef USE_PRNG_RANLUX
     float4 tmp = ranluxcl(state);
     return tmp.x * range;
+#elif defined(USE_PRNG_PHILOX)
+    float4 tmp = philox_float4(state);
+    return tmp.x * range;
 #else  // USE_PRNG_XXX
 #    error No implemented PRNG selected
 #endif  // USE_PRNG_XXX
@@ -86,6 +96,9 @@ double prng_double(prng_state* const restrict state)
 #    ifdef USE_PRNG_RANLUX
     float4 tmp = ranluxcl(state);
     return tmp.x;
+#    elif defined(USE_PRNG_PHILOX)
+    float4 tmp = philox_float4(state);
+    return tmp.x;
 #    else  // USE_PRNG_XXX
 #        error No implemented PRNG selected
 #    endif  // USE_PRNG_XXX
@@ -104,6 +117,9 @@ float prng_float(prng_state* const restrict state)
 #ifdef USE_PRNG_RANLUX
     float4 tmp = ranluxcl(state);
     return tmp.x;
+#elif defined(USE_PRNG_PHILOX)
+    float4 tmp = philox_float4(state);
+    return tmp.x;
 #else  // USE_PRNG_XXX
 #    error No implemented PRNG selected
 #endif  // USE_PRNG_XXX
@@ -124,6 +140,9 @@ double4 prng_double4(prng_state* const restrict state)
 #    ifdef USE_PRNG_RANLUX
     float4 tmp = ranluxcl(state);
     return (double4)(tmp.x, tmp.y, tmp.z, tmp.w);
+#    elif defined(USE_PRNG_PHILOX)
+    float4 tmp = philox_float4(state);
+    return (double4)(tmp.x, tmp.y, tmp.z, tmp.w);
 #    else  // USE_PRNG_XXX
 #        error No implemented PRNG selected
 #    endif  // USE_PRNG_XXX
@@ -143,6 +162,8 @@ float4 prng_float4(prng_state* const restrict state)
 {
 #ifdef USE_PRNG_RANLUX
     return ranluxcl(state);
+#elif defined(USE_PRNG_PHILOX)
+    return philox_float4(state);
 #else  // USE_PRNG_XXX
 #    error No implemented PRNG selected
 #endif  // USE_PRNG_XXX
@@ -156,6 +177,40 @@ void prng_synchronize(prng_state* const restrict state)
 {
 #ifdef USE_PRNG_RANLUX
     ranluxcl_synchronize(state);
+#elif defined(USE_PRNG_PHILOX)
+    // nothing to do, the blocks are drawn independently of each other
+#else  // USE_PRNG_XXX
+#    error No implemented PRNG selected
+#endif  // USE_PRNG_XXX
+}
+
+/**
+ * Draw the following random numbers from the stream of the given site, identified by its index in the global lattice.
+ *
+ * With the counter-based generator, these numbers only depend on the seed, the site and the number of kernel calls
+ * so far, such that the same random field is obtained for any number of devices and work-items. RANLUX has no such
+ * streams and keeps drawing from the stream of the work-item.
+ */
+void prng_enterSite(prng_state* const restrict state, const uint global_site)
+{
+#ifdef USE_PRNG_RANLUX
+    // nothing to do, the numbers depend on the distribution of the sites anyway
+#elif defined(USE_PRNG_PHILOX)
+    philox_enter_site_stream(state, global_site);
+#else  // USE_PRNG_XXX
+#    error No implemented PRNG selected
+#endif  // USE_PRNG_XXX
+}
+
+/**
+ * Continue drawing as if the kernel had stored the state and a new kernel had loaded it again.
+ */
+void prng_nextCall(prng_state* const restrict state)
+{
+#ifdef USE_PRNG_RANLUX
+    // nothing to do, RANLUX continues the stream of the work-item
+#elif defined(USE_PRNG_PHILOX)
+    philox_next_call(state);
 #else  // USE_PRNG_XXX
 #    error No implemented PRNG selected
 #endif  // USE_PRNG_XXX
@@ -190,15 +245,17 @@ int3 prng_123(prng_state* const restrict state)
 
 #ifdef USE_PRNG_RANLUX
     float4 tmp = ranluxcl(state);
+#elif defined(USE_PRNG_PHILOX)
+    float4 tmp = philox_float4(state);
+#else  // USE_PRNG_XXX
+#    error No implemented PRNG selected
+#endif  // USE_PRNG_XXX
     int3 res;
     res.x = tmp.x * 3.f;
     res.y = (res.x + (int)(tmp.y * 2) + 1) % 3;
     res.z = 3 - res.x - res.y;
     ++res;
     return res;
-#else  // USE_PRNG_XXX
-#    error No implemented PRNG selected
-#endif  // USE_PRNG_XXX
 }
 /**
  * Get a normal distributed complex number
@@ -213,6 +270,11 @@ hmc_complex inline gaussianNormalPair(prng_state* const restrict rnd)
     // LEGEACY CODE
     // Box-Muller method, cartesian form, for extracting two independent normal standard real numbers
     float4 rands = ranluxcl(rnd);
+#elif defined(USE_PRNG_PHILOX)
+    float4 rands = philox_float4(rnd);
+#else  // USE_PRNG_XXX
+#    error No implemented PRNG selected
+#endif  // USE_PRNG_XXX
 
     // CP: if u1 == 1., p will be "inf"
     hmc_float u1 = 1.0 - rands.x;
@@ -228,9 +290,6 @@ hmc_complex inline gaussianNormalPair(prng_state* const restrict rnd)
     tmp.re = p * cos(2 * PI * u2);
     tmp.im = p * sin(2 * PI * u2);
     return tmp;
-#else  // USE_PRNG_XXX
-#    error No implemented PRNG selected
-#endif  // USE_PRNG_XXX
 }
 
 /**
@@ -247,6 +306,11 @@ hmc_complex inline Z4_complex_number(prng_state* const restrict rnd)
 
     // LEGEACY CODE
     float4 rands = ranluxcl(rnd);
+#elif defined(USE_PRNG_PHILOX)
+    float4 rands = philox_float4(rnd);
+#else  // USE_PRNG_XXX
+#    error No implemented PRNG selected
+#endif  // USE_PRNG_XXX
     // just use the first 2 floats
     hmc_complex tmp;
     if (rands.x > 0.5)
@@ -258,9 +322,6 @@ hmc_complex inline Z4_complex_number(prng_state* const restrict rnd)
     else
         tmp.im = -norm;
     return tmp;
-#else  // USE_PRNG_XXX
-#    error No implemented PRNG selected
-#endif  // USE_PRNG_XXX
 }
 
 /**
@@ -276,6 +337,11 @@ hmc_complex inline Z2_complex_number(prng_state* const restrict rnd)
 
     // LEGEACY CODE
     float4 rands = ranluxcl(rnd);
+#elif defined(USE_PRNG_PHILOX)
+    float4 rands = philox_float4(rnd);
+#else  // USE_PRNG_XXX
+#    error No implemented PRNG selected
+#endif  // USE_PRNG_XXX
     // just use the first float
     hmc_complex tmp;
     if (rands.x > 0.5)
@@ -284,7 +350,4 @@ hmc_complex inline Z2_complex_number(prng_state* const restrict rnd)
         tmp.re = -1.0;
     tmp.im = 0.0;
     return tmp;
-#else  // USE_PRNG_XXX
-#    error No implemented PRNG selected
-#endif  // USE_PRNG_XXX
 }
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Merged vector updates of one CG iteration. The coefficients are calculated by every work-item from the
+// scalars the previous kernels left on the device, hence no complex arithmetic kernels are needed in between.
+
+// alpha = omega / rho
+// x = x + alpha*p
+// r = r - alpha*v
+// the squarenorm |r|^2 is stored in "result", one partial sum per group
+__kernel void cg_update_x_r_AND_squarenorm_eo(__global spinorStorageType* const restrict x,
+                                              __global spinorStorageType* const restrict r,
+                                              __global const spinorStorageType* const restrict p,
+                                              __global const spinorStorageType* const restrict v,
+                                              __global const hmc_complex* const restrict omega,
+                                              __global const hmc_complex* const restrict rho,
+                                              __global hmc_float* const restrict result,
+                                              __local hmc_float* const restrict result_local)
+{
+    int local_size  = get_local_size(0);
+    int global_size = get_global_size(0);
+    int id          = get_global_id(0);
+    int group_id    = get_group_id(0);
+    int idx         = get_local_id(0);
+
+    hmc_float sum;
+    sum = 0.;
+
+    const hmc_complex alpha = complexdivide(complexLoadHack(omega), complexLoadHack(rho));
+    for (int id_mem = id; id_mem < EOPREC_SPINORFIELDSIZE_MEM; id_mem += global_size) {
+        spinor p_tmp = getSpinor_eo(p, id_mem);
+        spinor x_tmp = getSpinor_eo(x, id_mem);
+        x_tmp        = spinor_acc(x_tmp, spinor_times_complex(p_tmp, alpha));
+        putSpinor_eo(x, id_mem, x_tmp);
+
+        spinor v_tmp = getSpinor_eo(v, id_mem);
+        spinor r_tmp = getSpinor_eo(r, id_mem);
+        r_tmp        = spinor_dim(r_tmp, spinor_times_complex(v_tmp, alpha));
+        sum += spinor_squarenorm(r_tmp);
+        putSpinor_eo(r, id_mem, r_tmp);
+    }
+
+    // perform local reduction
+    if (local_size == 1) {
+        result[group_id] = sum;
+    } else {
+        // sync threads
+        barrier(CLK_LOCAL_MEM_FENCE);
+        // reduction
+        (result_local[idx]) = sum;
+        barrier(CLK_LOCAL_MEM_FENCE);
+        if (idx >= 64)
+            result_local[idx % 64] += result_local[idx];
+        barrier(CLK_LOCAL_MEM_FENCE);
+        if (idx >= 32)
+            result_local[idx - 32] += result_local[idx];
+        barrier(CLK_LOCAL_MEM_FENCE);
+        if (idx >= 16)
+            result_local[idx - 16] += result_local[idx];
+        barrier(CLK_LOCAL_MEM_FENCE);
+        if (idx >= 8)
+            result_local[idx - 8] += result_local[idx];
+        barrier(CLK_LOCAL_MEM_FENCE);
+        // thread 0 sums up the result_local and stores it in array result
+        if (idx == 0) {
+            if (local_size >= 8) {
+                result[group_id] = result_local[0] + result_local[1] + result_local[2] + result_local[3] +
+                                   result_local[4] + result_local[5] + result_local[6] + result_local[7];
+            } else {
+                for (int i = 0; i < local_size; i++)
+                    result[group_id] += result_local[i];
+            }
+        }
+    }
+    return;
+}
+
+// beta = rho_next / omega
+// p = r + beta*p
+__kernel void cg_update_p_eo(__global spinorStorageType* const restrict p,
+                             __global const spinorStorageType* const restrict r,
+                             __global const hmc_complex* const restrict rho_next,
+                             __global const hmc_complex* const restrict omega)
+{
+    int id          = get_global_id(0);
+    int global_size = get_global_size(0);
+
+    const hmc_complex beta = complexdivide(complexLoadHack(rho_next), complexLoadHack(omega));
+    for (int id_mem = id; id_mem < EOPREC_SPINORFIELDSIZE_MEM; id_mem += global_size) {
+        spinor p_tmp = getSpinor_eo(p, id_mem);
+        spinor r_tmp = getSpinor_eo(r, id_mem);
+        p_tmp        = spinor_acc(r_tmp, spinor_times_complex(p_tmp, beta));
+        putSpinor_eo(p, id_mem, p_tmp);
+    }
+}
@@ -40,7 +40,9 @@ __kernel void generate_gaussian_spinorfield_eo(__global spinorStorageType* const
     prng_loadState(&rnd, rngStates);
 
     for (int id_local = id; id_local < EOPREC_SPINORFIELDSIZE_LOCAL; id_local += global_size) {
-        site_idx id_mem = get_eo_site_idx_from_st_idx(get_even_st_idx_local(id_local));
+        st_index pos    = get_even_st_idx_local(id_local);
+        site_idx id_mem = get_eo_site_idx_from_st_idx(pos);
+        prng_enterSite(&rnd, get_global_site_idx(pos));
         // CP: there are 12 complex elements in the spinor
         tmp              = gaussianNormalPair(&rnd);
         out_tmp.e0.e0.re = tmp.re;
@@ -43,6 +43,7 @@ __kernel void generate_gaussian_spinorfield(__global spinor* const restrict out,
         st_index pos = (id_local < SPINORFIELDSIZE_LOCAL / 2)
                            ? get_even_st_idx_local(id_local)
                            : get_odd_st_idx_local(id_local - (SPINORFIELDSIZE_LOCAL / 2));
+        prng_enterSite(&rnd, get_global_site_idx(pos));
 
         // CP: there are 12 complex elements in the spinor
         tmp              = gaussianNormalPair(&rnd);
@@ -32,8 +32,9 @@ inline su3vec get_su3vec_from_field_eo(__global const staggeredStorageType* cons
 {
 #ifdef _USE_SOA_
     return (su3vec){// su3vec = 3 * cplx
-                    in[0 * EOPREC_SU3VECFIELD_STRIDE + idx], in[1 * EOPREC_SU3VECFIELD_STRIDE + idx],
-                    in[2 * EOPREC_SU3VECFIELD_STRIDE + idx]};
+                    load_fermion_storage(in[0 * EOPREC_SU3VECFIELD_STRIDE + idx]),
+                    load_fermion_storage(in[1 * EOPREC_SU3VECFIELD_STRIDE + idx]),
+                    load_fermion_storage(in[2 * EOPREC_SU3VECFIELD_STRIDE + idx])};
 #else
     return in[idx];
 #endif
@@ -49,9 +50,9 @@ inline void put_su3vec_to_field_eo(__global staggeredStorageType* const restrict
 {
 #ifdef _USE_SOA_
     // su3vec = 3 * cplx
-    out[0 * EOPREC_SU3VECFIELD_STRIDE + idx] = val.e0;
-    out[1 * EOPREC_SU3VECFIELD_STRIDE + idx] = val.e1;
-    out[2 * EOPREC_SU3VECFIELD_STRIDE + idx] = val.e2;
+    out[0 * EOPREC_SU3VECFIELD_STRIDE + idx] = store_fermion_storage(val.e0);
+    out[1 * EOPREC_SU3VECFIELD_STRIDE + idx] = store_fermion_storage(val.e1);
+    out[2 * EOPREC_SU3VECFIELD_STRIDE + idx] = store_fermion_storage(val.e2);
 #else
     out[idx] = val;
 #endif
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// This kernel performs the update of the solution and of the auxiliary fields of the CG-M
+// for several shifted systems at once:
+//     x[k]  = x[k] + beta[index[k]]*ps[k]
+//     ps[k] = zeta[index[k]]*r + alpha[index[k]]*ps[k]
+// The field r is loaded only once per site for all shifts. The operations are performed in the same
+// order as in saxpy_real_vec_staggered_eoprec and saxpby_real_vec_staggered_eoprec, such that the results
+// agree bit by bit with the ones of these two kernels called one after the other.
+
+// Description of variables:
+//  - r: The residuum staggered field (an su3vec per each site => vector of VOL4D/2
+//       components that are su3vec varibles)
+//  - beta, zeta, alpha: Vectors of constants of all shifted systems
+//  - x0...x7: The solution staggered fields of the shifts to be updated
+//  - ps0...ps7: The auxiliary staggered fields of the shifts to be updated
+//  - index0...index7: The index of the shift in the vectors of constants
+//  - num_shifts: The number of shifts to be updated. Unused x, ps and index arguments
+//                still have to be valid, but are not accessed.
+
+#define UPDATE_X_AND_PS_CGM_MAX_SHIFTS 8
+
+__global staggeredStorageType* get_field_of_shift(
+    __global staggeredStorageType* const f0, __global staggeredStorageType* const f1,
+    __global staggeredStorageType* const f2, __global staggeredStorageType* const f3,
+    __global staggeredStorageType* const f4, __global staggeredStorageType* const f5,
+    __global staggeredStorageType* const f6, __global staggeredStorageType* const f7, const int shift)
+{
+    switch (shift) {
+        case 0:
+            return f0;
+        case 1:
+            return f1;
+        case 2:
+            return f2;
+        case 3:
+            return f3;
+        case 4:
+            return f4;
+        case 5:
+            return f5;
+        case 6:
+            return f6;
+        default:
+            return f7;
+    }
+}
+
+__kernel void update_x_and_ps_cgm_eoprec(
+    __global const staggeredStorageType* const r, __global const hmc_float* const beta,
+    __global const hmc_float* const zeta, __global const hmc_float* const alpha,
+    __global staggeredStorageType* const x0, __global staggeredStorageType* const x1,
+    __global staggeredStorageType* const x2, __global staggeredStorageType* const x3,
+    __global staggeredStorageType* const x4, __global staggeredStorageType* const x5,
+    __global staggeredStorageType* const x6, __global staggeredStorageType* const x7,
+    __global staggeredStorageType* const ps0, __global staggeredStorageType* const ps1,
+    __global staggeredStorageType* const ps2, __global staggeredStorageType* const ps3,
+    __global staggeredStorageType* const ps4, __global staggeredStorageType* const ps5,
+    __global staggeredStorageType* const ps6, __global staggeredStorageType* const ps7, const int index0,
+    const int index1, const int index2, const int index3, const int index4, const int index5, const int index6,
+    const int index7, const int num_shifts)
+{
+    const int id          = get_global_id(0);
+    const int global_size = get_global_size(0);
+
+    const int index[UPDATE_X_AND_PS_CGM_MAX_SHIFTS] = {index0, index1, index2, index3,
+                                                       index4, index5, index6, index7};
+
+    for (int id_mem = id; id_mem < EOPREC_SPINORFIELDSIZE_MEM; id_mem += global_size) {
+        const su3vec r_tmp = get_su3vec_from_field_eo(r, id_mem);
+
+        for (int k = 0; k < num_shifts; ++k) {
+            __global staggeredStorageType* const x  = get_field_of_shift(x0, x1, x2, x3, x4, x5, x6, x7, k);
+            __global staggeredStorageType* const ps = get_field_of_shift(ps0, ps1, ps2, ps3, ps4, ps5, ps6, ps7, k);
+
+            su3vec ps_tmp = get_su3vec_from_field_eo(ps, id_mem);
+            su3vec x_tmp  = get_su3vec_from_field_eo(x, id_mem);
+
+            // x[k] = beta[k]*ps[k] + x[k]
+            su3vec tmp = su3vec_times_real(ps_tmp, beta[index[k]]);
+            x_tmp      = su3vec_acc(x_tmp, tmp);
+            put_su3vec_to_field_eo(x, id_mem, x_tmp);
+
+            // ps[k] = zeta[k]*r + alpha[k]*ps[k]
+            tmp    = su3vec_times_real(r_tmp, zeta[index[k]]);
+            ps_tmp = su3vec_times_real(ps_tmp, alpha[index[k]]);
+            ps_tmp = su3vec_acc(ps_tmp, tmp);
+            put_su3vec_to_field_eo(ps, id_mem, ps_tmp);
+        }
+    }
+}
@@ -19,6 +19,66 @@
  * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
  */
 
+hmc_complex volume_source_entry(prng_state* const rnd)
+{
+    return (SOURCE_CONTENT == 2) ? Z4_complex_number(rnd) : gaussianNormalPair(rnd);
+}
+
+/**
+ * Draw the spinor of one site of a volume source.
+ */
+spinor volume_source_spinor(prng_state* const rnd, const int id)
+{
+    spinor out_tmp;
+    /** @todo what is the norm here? */
+    const hmc_float sigma = 0.5f;
+
+    // CP: switch between source content
+    switch (SOURCE_CONTENT) {
+        case 1:  //"one"
+            out_tmp = set_spinor_cold();
+            break;
+
+        case 2:  //"z4"
+        case 3:  //"gaussian"
+            out_tmp.e0.e0 = volume_source_entry(rnd);
+            out_tmp.e0.e1 = volume_source_entry(rnd);
+            out_tmp.e0.e2 = volume_source_entry(rnd);
+            out_tmp.e1.e0 = volume_source_entry(rnd);
+            out_tmp.e1.e1 = volume_source_entry(rnd);
+            out_tmp.e1.e2 = volume_source_entry(rnd);
+            out_tmp.e2.e0 = volume_source_entry(rnd);
+            out_tmp.e2.e1 = volume_source_entry(rnd);
+            out_tmp.e2.e2 = volume_source_entry(rnd);
+            out_tmp.e3.e0 = volume_source_entry(rnd);
+            out_tmp.e3.e1 = volume_source_entry(rnd);
+            out_tmp.e3.e2 = volume_source_entry(rnd);
+            if (SOURCE_CONTENT == 3) {
+                // multiply by sigma
+                out_tmp = real_multiply_spinor(out_tmp, sqrt(sigma));
+            }
+            break;
+
+        default:
+            if (id == 0)
+                printf("Problem occured in source kernel: Selected sourcecontent not implemented! Fill with "
+                       "zero...\n");
+            out_tmp = set_spinor_zero();
+    }
+    return out_tmp;
+}
+
+void fill_volume_source(__global spinor* const restrict b, prng_state* const rnd, const int id, const int global_size)
+{
+    for (int id_local = id; id_local < SPINORFIELDSIZE_LOCAL; id_local += global_size) {
+        /** @todo this might be done more efficient */
+        st_index pos = (id_local < SPINORFIELDSIZE_LOCAL / 2)
+                           ? get_even_st_idx_local(id_local)
+                           : get_odd_st_idx_local(id_local - (SPINORFIELDSIZE_LOCAL / 2));
+        putSpinor(b, get_site_idx(pos), volume_source_spinor(rnd, id));
+    }
+}
+
 __kernel void
 create_volume_source(__global spinor* const restrict b, __global rngStateStorageType* const restrict rngStates)
 {
@@ -34,111 +94,7 @@ create_volume_source(__global spinor* const restrict b, __global rngStateStorage
     prng_state rnd;
     prng_loadState(&rnd, rngStates);
 
-    spinor out_tmp;
-    hmc_complex tmp;
-    hmc_float sigma;
-
-    for (int id_local = id; id_local < SPINORFIELDSIZE_LOCAL; id_local += global_size) {
-        /** @todo this might be done more efficient */
-        st_index pos = (id_local < SPINORFIELDSIZE_LOCAL / 2)
-                           ? get_even_st_idx_local(id_local)
-                           : get_odd_st_idx_local(id_local - (SPINORFIELDSIZE_LOCAL / 2));
-        // CP: switch between source content
-        switch (SOURCE_CONTENT) {
-            case 1:  //"one"
-                out_tmp = set_spinor_cold();
-                break;
-
-            case 2:  //"z4"
-                tmp              = Z4_complex_number(&rnd);
-                out_tmp.e0.e0.re = tmp.re;
-                out_tmp.e0.e0.im = tmp.im;
-                tmp              = Z4_complex_number(&rnd);
-                out_tmp.e0.e1.re = tmp.re;
-                out_tmp.e0.e1.im = tmp.im;
-                tmp              = Z4_complex_number(&rnd);
-                out_tmp.e0.e2.re = tmp.re;
-                out_tmp.e0.e2.im = tmp.im;
-                tmp              = Z4_complex_number(&rnd);
-                out_tmp.e1.e0.re = tmp.re;
-                out_tmp.e1.e0.im = tmp.im;
-                tmp              = Z4_complex_number(&rnd);
-                out_tmp.e1.e1.re = tmp.re;
-                out_tmp.e1.e1.im = tmp.im;
-                tmp              = Z4_complex_number(&rnd);
-                out_tmp.e1.e2.re = tmp.re;
-                out_tmp.e1.e2.im = tmp.im;
-                tmp              = Z4_complex_number(&rnd);
-                out_tmp.e2.e0.re = tmp.re;
-                out_tmp.e2.e0.im = tmp.im;
-                tmp              = Z4_complex_number(&rnd);
-                out_tmp.e2.e1.re = tmp.re;
-                out_tmp.e2.e1.im = tmp.im;
-                tmp              = Z4_complex_number(&rnd);
-                out_tmp.e2.e2.re = tmp.re;
-                out_tmp.e2.e2.im = tmp.im;
-                tmp              = Z4_complex_number(&rnd);
-                out_tmp.e3.e0.re = tmp.re;
-                out_tmp.e3.e0.im = tmp.im;
-                tmp              = Z4_complex_number(&rnd);
-                out_tmp.e3.e1.re = tmp.re;
-                out_tmp.e3.e1.im = tmp.im;
-                tmp              = Z4_complex_number(&rnd);
-                out_tmp.e3.e2.re = tmp.re;
-                out_tmp.e3.e2.im = tmp.im;
-                break;
-
-            case 3:  //"gaussian"
-                /** @todo what is the norm here? */
-                sigma            = 0.5f;
-                tmp              = gaussianNormalPair(&rnd);
-                out_tmp.e0.e0.re = tmp.re;
-                out_tmp.e0.e0.im = tmp.im;
-                tmp              = gaussianNormalPair(&rnd);
-                out_tmp.e0.e1.re = tmp.re;
-                out_tmp.e0.e1.im = tmp.im;
-                tmp              = gaussianNormalPair(&rnd);
-                out_tmp.e0.e2.re = tmp.re;
-                out_tmp.e0.e2.im = tmp.im;
-                tmp              = gaussianNormalPair(&rnd);
-                out_tmp.e1.e0.re = tmp.re;
-                out_tmp.e1.e0.im = tmp.im;
-                tmp              = gaussianNormalPair(&rnd);
-                out_tmp.e1.e1.re = tmp.re;
-                out_tmp.e1.e1.im = tmp.im;
-                tmp              = gaussianNormalPair(&rnd);
-                out_tmp.e1.e2.re = tmp.re;
-                out_tmp.e1.e2.im = tmp.im;
-                tmp              = gaussianNormalPair(&rnd);
-                out_tmp.e2.e0.re = tmp.re;
-                out_tmp.e2.e0.im = tmp.im;
-                tmp              = gaussianNormalPair(&rnd);
-                out_tmp.e2.e1.re = tmp.re;
-                out_tmp.e2.e1.im = tmp.im;
-                tmp              = gaussianNormalPair(&rnd);
-                out_tmp.e2.e2.re = tmp.re;
-                out_tmp.e2.e2.im = tmp.im;
-                tmp              = gaussianNormalPair(&rnd);
-                out_tmp.e3.e0.re = tmp.re;
-                out_tmp.e3.e0.im = tmp.im;
-                tmp              = gaussianNormalPair(&rnd);
-                out_tmp.e3.e1.re = tmp.re;
-                out_tmp.e3.e1.im = tmp.im;
-                tmp              = gaussianNormalPair(&rnd);
-                out_tmp.e3.e2.re = tmp.re;
-                out_tmp.e3.e2.im = tmp.im;
-                // multiply by sigma
-                out_tmp = real_multiply_spinor(out_tmp, sqrt(sigma));
-                break;
-
-            default:
-                if (id == 0)
-                    printf("Problem occured in source kernel: Selected sourcecontent not implemented! Fill with "
-                           "zero...\n");
-                out_tmp = set_spinor_zero();
-        }
-        putSpinor(b, get_site_idx(pos), out_tmp);
-    }
+    fill_volume_source(b, &rnd, id, global_size);
 
     prng_storeState(rngStates, &rnd);
 }
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ @file volume sources, several of them filled in one kernel launch
+ The site content is drawn by fill_volume_source from spinorfield_volume_source.cl.
+*/
+
+// number of sources filled by one launch of create_volume_sources
+#define VOLUME_SOURCES_PER_LAUNCH 4
+
+/**
+ * Fill VOLUME_SOURCES_PER_LAUNCH volume sources at once.
+ *
+ * The state of the PRNG is loaded and stored only once. Every work-item fills the sources one after the other and
+ * advances the PRNG between them as a new kernel call would do, such that the sources are exactly the ones of
+ * VOLUME_SOURCES_PER_LAUNCH subsequent launches of create_volume_source.
+ */
+__kernel void create_volume_sources(__global spinor* const restrict b1, __global spinor* const restrict b2,
+                                    __global spinor* const restrict b3, __global spinor* const restrict b4,
+                                    __global rngStateStorageType* const restrict rngStates)
+{
+    int id          = get_global_id(0);
+    int global_size = get_global_size(0);
+
+#ifdef _SAME_RND_NUMBERS_
+    if (id > 0)
+        return;
+    global_size = 1;
+#endif
+
+    prng_state rnd;
+    prng_loadState(&rnd, rngStates);
+
+    fill_volume_source(b1, &rnd, id, global_size);
+    prng_nextCall(&rnd);
+    fill_volume_source(b2, &rnd, id, global_size);
+    prng_nextCall(&rnd);
+    fill_volume_source(b3, &rnd, id, global_size);
+    prng_nextCall(&rnd);
+    fill_volume_source(b4, &rnd, id, global_size);
+
+    prng_storeState(rngStates, &rnd);
+}
@@ -42,30 +42,36 @@ namespace physics {
         class ForcesParametersInterface {
           public:
             virtual ~ForcesParametersInterface() {}
-            virtual common::action getFermact() const      = 0;
-            virtual double getSolverForcePrecision() const = 0;
-            virtual unsigned getRhoIterations() const      = 0;
-            virtual common::solver getSolver() const       = 0;
-            virtual bool getUseSmearing() const            = 0;
-            virtual bool getUseGaugeOnly() const           = 0;
-            virtual bool getUseRectangles() const          = 0;
+            virtual common::action getFermact() const          = 0;
+            virtual double getSolverForcePrecision() const     = 0;
+            virtual unsigned getSolverForceHistorySize() const = 0;
+            virtual unsigned getRhoIterations() const          = 0;
+            virtual common::solver getSolver() const           = 0;
+            virtual bool getUseSmearing() const                = 0;
+            virtual bool getUseGaugeOnly() const               = 0;
+            virtual bool getUseRectangles() const              = 0;
         };
 
         class MinMaxEigenvalueParametersInterface {
           public:
             virtual ~MinMaxEigenvalueParametersInterface() {}
-            virtual unsigned getFindMinMaxIterationBlockSize() const = 0;
-            virtual unsigned getFindMinMaxMaxValue() const           = 0;
+            virtual unsigned getFindMinMaxIterationBlockSize() const    = 0;
+            virtual unsigned getFindMinMaxMaxValue() const              = 0;
+            virtual bool getFindMinMaxUseLanczos() const                = 0;
+            virtual double getFindMinMaxReusePlaquetteTolerance() const = 0;
         };
 
         class InversionParemetersInterface {
           public:
             virtual ~InversionParemetersInterface() {}
-            virtual common::action getFermact() const = 0;
-            virtual common::solver getSolver() const  = 0;
-            virtual double getSolverPrec() const      = 0;
-            virtual bool getUseEo() const             = 0;
-            virtual bool getUseSmearing() const       = 0;
+            virtual common::action getFermact() const           = 0;
+            virtual common::solver getSolver() const            = 0;
+            virtual double getSolverPrec() const                = 0;
+            virtual bool getUseEo() const                       = 0;
+            virtual bool getUseSmearing() const                 = 0;
+            // every source of a block keeps about 9 even-odd spinorfields on the device during the batched solve
+            // (even and odd source and solution, the cg fields p, r and v and the temporaries of apply_multi)
+            virtual unsigned getSolverMultiRhsBlockSize() const = 0;
         };
 
         class IntegratorParametersInterface {
@@ -29,8 +29,36 @@
 #include "../fermionmatrix/fermionmatrix.hpp"
 #include "../lattices/util.hpp"
 #include "molecular_dynamics.hpp"
+#include "solution_history.hpp"
 #include "solvers/solvers.hpp"
 
+/**
+ * Solve fm * solution = source with the cg, starting from the minimal-residual extrapolation of the previous solutions
+ * belonging to the given pseudofermion if solution histories are registered in the interfaces handler, from a cold
+ * spinorfield otherwise.
+ */
+template<class SPINORFIELD, class FERMIONMATRIX>
+static void cg_with_solution_history(const SPINORFIELD* solution, const FERMIONMATRIX& fm,
+                                     const physics::lattices::Gaugefield& gf, const SPINORFIELD& source,
+                                     const SPINORFIELD& pseudofermion, const bool detratio,
+                                     const hardware::System& system, physics::InterfacesHandler& interfacesHandler,
+                                     const hmc_float prec, const physics::AdditionalParameters& additionalParameters)
+{
+    using physics::algorithms::SolutionHistoryScope;
+
+    SolutionHistoryScope* const scope = interfacesHandler.getSolutionHistories();
+    auto history                      = scope ? scope->getHistory(pseudofermion, detratio) : nullptr;
+    if (history) {
+        history->makeGuess(solution, fm, gf, source, additionalParameters);
+    } else {
+        solution->cold();
+    }
+    physics::algorithms::solvers::cg(solution, fm, gf, source, system, interfacesHandler, prec, additionalParameters);
+    if (history) {
+        history->store(*solution);
+    }
+}
+
 // this function takes to args kappa and mubar because one has to use it with different masses when mass-prec is used
 // and when not
 
@@ -61,17 +89,12 @@ void physics::algorithms::calc_fermion_force(const physics::lattices::Gaugemomen
          */
         logger.debug() << "\t\t\tstart solver";
 
-        /** @todo at the moment, we can only put in a cold spinorfield
-         * or a point-source spinorfield as trial-solution
-         */
+        const QplusQminus_eo fm(system, interfacesHandler.getInterface<physics::fermionmatrix::QplusQminus_eo>());
         /**
-         * Trial solution for the spinorfield
+         * The trial solution is extrapolated from the previous solutions of this trajectory, if wanted, else cold
          */
-        solution.cold();
-
-        const QplusQminus_eo fm(system, interfacesHandler.getInterface<physics::fermionmatrix::QplusQminus_eo>());
-        cg(&solution, fm, gf, phi, system, interfacesHandler, parametersInterface.getSolverForcePrecision(),
-           additionalParameters);
+        cg_with_solution_history(&solution, fm, gf, phi, phi, false, system, interfacesHandler,
+                                 parametersInterface.getSolverForcePrecision(), additionalParameters);
 
         /**
          * Y_even is now just
@@ -203,18 +226,13 @@ void physics::algorithms::calc_fermion_force(const physics::lattices::Gaugemomen
          */
         logger.debug() << "\t\t\tstart solver";
 
-        /** @todo at the moment, we can only put in a cold spinorfield
-         * or a point-source spinorfield as trial-solution
-         */
-        /**
-         * Trial solution for the spinorfield
-         */
-        solution.cold();
-
         // here, the "normal" solver can be used since the inversion is of the same structure as in the inverter
         const QplusQminus fm(system, interfacesHandler.getInterface<physics::fermionmatrix::QplusQminus>());
-        cg(&solution, fm, gf, phi, system, interfacesHandler, parametersInterface.getSolverForcePrecision(),
-           additionalParameters);
+        /**
+         * The trial solution is extrapolated from the previous solutions of this trajectory, if wanted, else cold
+         */
+        cg_with_solution_history(&solution, fm, gf, phi, phi, false, system, interfacesHandler,
+                                 parametersInterface.getSolverForcePrecision(), additionalParameters);
 
         /**
          * Y is now just
@@ -330,18 +348,13 @@ void physics::algorithms::calc_fermion_force_detratio(const physics::lattices::G
          */
         logger.debug() << "\t\t\tstart solver";
 
-        /** @todo at the moment, we can only put in a cold spinorfield
-         * or a point-source spinorfield as trial-solution
-         */
-        /**
-         * Trial solution for the spinorfield
-         */
-        solution.cold();
-
         // here, the "normal" solver can be used since the inversion is of the same structure as in the inverter
         const QplusQminus fm(system, interfacesHandler.getInterface<physics::fermionmatrix::QplusQminus>());
-        cg(&solution, fm, gf, tmp, system, interfacesHandler, parametersInterface.getSolverForcePrecision(),
-           additionalParameters);
+        /**
+         * The trial solution is extrapolated from the previous solutions of this trajectory, if wanted, else cold
+         */
+        cg_with_solution_history(&solution, fm, gf, tmp, phi_mp, true, system, interfacesHandler,
+                                 parametersInterface.getSolverForcePrecision(), additionalParameters);
 
         /**
          * Y is now just
@@ -468,17 +481,12 @@ void physics::algorithms::calc_fermion_force_detratio(const physics::lattices::G
          */
         logger.debug() << "\t\t\tstart solver";
 
-        /** @todo at the moment, we can only put in a cold spinorfield
-         * or a point-source spinorfield as trial-solution
-         */
+        const QplusQminus_eo fm(system, interfacesHandler.getInterface<physics::fermionmatrix::QplusQminus_eo>());
         /**
-         * Trial solution for the spinorfield
+         * The trial solution is extrapolated from the previous solutions of this trajectory, if wanted, else cold
          */
-        solution.cold();
-
-        const QplusQminus_eo fm(system, interfacesHandler.getInterface<physics::fermionmatrix::QplusQminus_eo>());
-        cg(&solution, fm, gf, tmp, system, interfacesHandler, parametersInterface.getSolverForcePrecision(),
-           additionalParameters);
+        cg_with_solution_history(&solution, fm, gf, tmp, phi_mp, true, system, interfacesHandler,
+                                 parametersInterface.getSolverForcePrecision(), additionalParameters);
 
         /**
          * Y_even is now just
@@ -32,6 +32,7 @@
 #include "integrator.hpp"
 #include "metropolis.hpp"
 #include "molecular_dynamics.hpp"
+#include "solution_history.hpp"
 
 #include <memory>
 
@@ -90,10 +91,14 @@ perform_hmc_step(const physics::lattices::Gaugefield* const gf, const int iter,
 
     // here, clmem_phi is inverted several times and stored in clmem_phi_inv
     logger.trace() << "\tHMC:\tcall integrator";
-    if (parametersInterface.getUseMp()) {
-        integrator(&new_p, &new_u, phi, *phi_mp.get(), system, interfacesHandler);
-    } else {
-        integrator(&new_p, &new_u, phi, system, interfacesHandler);
+    {
+        // the previous solutions are only meaningful as trial solutions along this trajectory
+        const SolutionHistoryScope solutionHistories(system, interfacesHandler);
+        if (parametersInterface.getUseMp()) {
+            integrator(&new_p, &new_u, phi, *phi_mp.get(), system, interfacesHandler);
+        } else {
+            integrator(&new_p, &new_u, phi, system, interfacesHandler);
+        }
     }
 
     // metropolis step: afterwards, the updated config is again in gaugefield and p
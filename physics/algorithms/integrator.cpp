@@ -23,6 +23,7 @@
 
 #include "integrator.hpp"
 
+#include "../../hardware/tracer.hpp"
 #include "../../meta/util.hpp"
 #include "molecular_dynamics.hpp"
 
@@ -664,6 +665,7 @@ void integrator(const physics::lattices::Gaugemomenta* const gm, const physics::
         parametersInterface = interfaceHandler.getIntegratorParametersInterface();
 
     check_integrator_params(interfaceHandler);
+    hardware::TracePhase phase(system, "integrator");
 
     // CP: actual integrator calling
     switch (parametersInterface.getIntegrator(0)) {
@@ -703,6 +705,7 @@ void integrator(const physics::lattices::Gaugemomenta* const gm, const physics::
         parametersInterface = interfaceHandler.getIntegratorParametersInterface();
 
     check_integrator_params(interfaceHandler);
+    hardware::TracePhase phase(system, "integrator");
 
     // CP: actual integrator calling
     switch (parametersInterface.getIntegrator(0)) {
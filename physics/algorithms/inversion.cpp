@@ -29,13 +29,34 @@
 #include "../lattices/util.hpp"
 #include "solvers/solvers.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <memory>
 
 static void invert_M_nf2_upperflavour(const physics::lattices::Spinorfield* result,
                                       const physics::lattices::Gaugefield& gaugefield,
                                       const physics::lattices::Spinorfield* source, const hardware::System& system,
                                       physics::InterfacesHandler& interfacesHandler);
 
+static void invert_M_nf2_upperflavour_multi(const std::vector<const physics::lattices::Spinorfield*>& results,
+                                            const physics::lattices::Gaugefield& gaugefield,
+                                            const std::vector<const physics::lattices::Spinorfield*>& sources,
+                                            const hardware::System& system,
+                                            physics::InterfacesHandler& interfacesHandler);
+static void prepare_even_source(const physics::lattices::Spinorfield_eo* source_even,
+                                const physics::lattices::Spinorfield_eo* source_odd,
+                                const physics::lattices::Gaugefield& gf, const physics::lattices::Spinorfield& source,
+                                const physics::lattices::Spinorfield_eo* tmp1,
+                                const physics::lattices::Spinorfield_eo* tmp2,
+                                physics::InterfacesHandler& interfacesHandler);
+static void reconstruct_solution(const physics::lattices::Spinorfield* result,
+                                 const physics::lattices::Gaugefield& gf,
+                                 const physics::lattices::Spinorfield_eo& result_eo,
+                                 const physics::lattices::Spinorfield_eo& source_odd,
+                                 const physics::lattices::Spinorfield_eo* tmp1,
+                                 const physics::lattices::Spinorfield_eo* tmp2,
+                                 physics::InterfacesHandler& interfacesHandler);
+
 template<class Spinorfield>
 static hmc_float print_debug_inv_field(const Spinorfield& in, std::string msg);
 template<class Spinorfield>
@@ -56,19 +77,54 @@ void physics::algorithms::perform_inversion(const std::vector<physics::lattices:
     if (parametersInterface.getUseSmearing())
         gaugefield->smear();
 
-    for (size_t k = 0; k < num_sources; k++) {
-        logger.debug() << "calling solver..";
+    const size_t block_size = parametersInterface.getSolverMultiRhsBlockSize();
+    const bool batchable    = parametersInterface.getUseEo() && parametersInterface.getSolver() == common::cg;
+    if (block_size > 1 && batchable) {
+        // solve several sources at once such that the gaugefield is streamed only once for all of them
+        for (size_t first = 0; first < num_sources; first += block_size) {
+            const size_t last = std::min(first + block_size, num_sources);
+            logger.debug() << "calling batched solver for sources " << first << " to " << last - 1 << "..";
 
-        auto source = sources[k];
-        auto res    = result->at(k);
+            std::vector<const physics::lattices::Spinorfield*> block_sources;
+            std::vector<const physics::lattices::Spinorfield*> block_results;
+            for (size_t k = first; k < last; k++) {
+                try_swap_in(sources[k]);
+                try_swap_in(result->at(k));
+                block_sources.push_back(sources[k]);
+                block_results.push_back(result->at(k));
+            }
 
-        try_swap_in(source);
-        try_swap_in(res);
+            invert_M_nf2_upperflavour_multi(block_results, *gaugefield, block_sources, system, interfacesHandler);
 
-        invert_M_nf2_upperflavour(res, *gaugefield, source, system, interfacesHandler);
+            for (size_t k = first; k < last; k++) {
+                try_swap_out(sources[k]);
+                try_swap_out(result->at(k));
+            }
+        }
+    } else {
+        if (block_size > 1) {
+            logger.warn() << "Solving several sources at once is only implemented for the cg with even-odd "
+                             "preconditioning, solving them one after the other.";
+        }
+        for (size_t k = 0; k < num_sources; k++) {
+            logger.debug() << "calling solver..";
+
+            auto source = sources[k];
+            auto res    = result->at(k);
+
+            try_swap_in(source);
+            try_swap_in(res);
+            // the transfers of the next fields overlap with this inversion
+            if (k + 1 < num_sources) {
+                try_prefetch(sources[k + 1]);
+                try_prefetch(result->at(k + 1));
+            }
 
-        try_swap_out(source);
-        try_swap_out(res);
+            invert_M_nf2_upperflavour(res, *gaugefield, source, system, interfacesHandler);
+
+            try_swap_out(source);
+            try_swap_out(res);
+        }
     }
 
     if (parametersInterface.getUseSmearing())
@@ -134,39 +190,8 @@ static void invert_M_nf2_upperflavour(const physics::lattices::Spinorfield* resu
         const Spinorfield_eo tmp1(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
         const Spinorfield_eo tmp2(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
         const Spinorfield_eo result_eo(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
-        hmc_complex one  = hmc_complex_one;
-        hmc_complex mone = {-1., 0.};
-
-        // convert source and input-vector to eoprec-format
-        /**
-         * This currently is a workaround connected to issue #387
-         * the roles of even/odd vectors are interchanged!
-         * @todo: fix
-         * original code:
-         * spinor_code->convert_to_eoprec_device(&clmem_source_even, &clmem_source_odd, source_buf);
-         * workaround:
-         */
-        convert_to_eoprec(&source_odd, &source_even, *source);
 
-        ///@todo: work over these debug outputs once the above issue is settled
-        print_debug_inv_field(source, "\tsource before inversion ");
-        print_debug_inv_field(&source_even, "\teven source before inversion ");
-        print_debug_inv_field(&source_odd, "\todd source before inversion ");
-
-        // prepare sources
-        /**
-         * This changes the even source according to (with A = M + D):
-         *  b_e = b_e - D_eo M_inv b_o
-         */
-        if (parametersInterface.getFermact() == common::action::wilson) {
-            // in this case, the diagonal matrix is just 1 and falls away.
-            dslash(&tmp1, gf, source_odd, EVEN, additionalParameters.getKappa());
-            saxpy(&source_even, one, source_even, tmp1);
-        } else if (parametersInterface.getFermact() == common::action::twistedmass) {
-            M_tm_inverse_sitediagonal(&tmp1, source_odd, additionalParameters.getMubar());
-            dslash(&tmp2, gf, tmp1, EVEN, additionalParameters.getKappa());
-            saxpy(&source_even, one, source_even, tmp2);
-        }
+        prepare_even_source(&source_even, &source_odd, gf, *source, &tmp1, &tmp2, interfacesHandler);
 
         // Trial solution
         ///@todo this should go into a more general function
@@ -200,39 +225,7 @@ static void invert_M_nf2_upperflavour(const physics::lattices::Spinorfield* resu
                                  parametersInterface.getSolverPrec(), additionalParameters);
         }
 
-        // odd solution
-        /** The odd solution is obtained from the even one according to:
-         *  x_o = M_inv b_o - M_inv D x_e
-         * @todo: find out why it must be (issue #389)
-         *  x_o = - M_inv b_o - M_inv D x_e
-         *      = -(M_inv D x_e + M_inv b_o)
-         */
-        if (parametersInterface.getFermact() == common::action::wilson) {
-            // in this case, the diagonal matrix is just 1 and falls away.
-            dslash(&tmp1, gf, result_eo, ODD, additionalParameters.getKappa());
-            saxpy(&tmp1, mone, tmp1, source_odd);
-            sax(&tmp1, mone, tmp1);
-        } else if (parametersInterface.getFermact() == common::action::twistedmass) {
-            dslash(&tmp2, gf, result_eo, ODD, additionalParameters.getKappa());
-            M_tm_inverse_sitediagonal(&tmp1, tmp2, additionalParameters.getMubar());
-            M_tm_inverse_sitediagonal(&tmp2, source_odd, additionalParameters.getMubar());
-            saxpy(&tmp1, mone, tmp1, tmp2);
-            sax(&tmp1, mone, tmp1);
-        }
-
-        /// CP: whole solution
-        // convert source and input-vector to eoprec-format
-        /**
-         * This currently is a workaround connected to issue #387
-         * the roles of even/odd vectors are interchanged!
-         * @todo: fix
-         * original code:
-         * //CP: suppose the even sol is saved in inout_eoprec, the odd one in clmem_tmp_eo_1
-         * spinor_code->convert_from_eoprec_device(&result_buf_eo, &clmem_tmp_eo_1, result_buf);
-         * workaround:
-         */
-        // CP: suppose the odd sol is saved in inout_eoprec, the even one in clmem_tmp_eo_1
-        convert_from_eoprec(result, tmp1, result_eo);
+        reconstruct_solution(result, gf, result_eo, source_odd, &tmp1, &tmp2, interfacesHandler);
     }
 
     print_debug_inv_field(result, "\tsolution ");
@@ -241,6 +234,167 @@ static void invert_M_nf2_upperflavour(const physics::lattices::Spinorfield* resu
     logger.debug() << "\t\t\tsolver solved in " << converged << " iterations!";
 }
 
+static void invert_M_nf2_upperflavour_multi(const std::vector<const physics::lattices::Spinorfield*>& results,
+                                            const physics::lattices::Gaugefield& gf,
+                                            const std::vector<const physics::lattices::Spinorfield*>& sources,
+                                            const hardware::System& system,
+                                            physics::InterfacesHandler& interfacesHandler)
+{
+    using namespace physics::lattices;
+    using namespace physics::algorithms::solvers;
+    using namespace physics::fermionmatrix;
+
+    /**
+     * Same as invert_M_nf2_upperflavour with even-odd-preconditioning, but all even systems are solved together
+     * using the batched CG on QplusQminus_eo, which profits from applying dslash to several fields at once.
+     */
+    const physics::algorithms::InversionParemetersInterface&
+        parametersInterface = interfacesHandler.getInversionParemetersInterface();
+    const physics::AdditionalParameters&
+        additionalParameters = interfacesHandler.getAdditionalParameters<physics::lattices::Spinorfield>();
+
+    const size_t num_sources = sources.size();
+
+    const Spinorfield_eo tmp1(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
+    const Spinorfield_eo tmp2(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
+    std::vector<std::unique_ptr<const Spinorfield_eo>> fields;
+    std::vector<const Spinorfield_eo*> sources_even, sources_odd, results_eo;
+    for (size_t k = 0; k < num_sources; k++) {
+        for (int i = 0; i < 3; i++) {
+            fields.emplace_back(
+                new Spinorfield_eo(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>()));
+        }
+        sources_even.push_back(fields[3 * k].get());
+        sources_odd.push_back(fields[3 * k + 1].get());
+        results_eo.push_back(fields[3 * k + 2].get());
+
+        prepare_even_source(sources_even[k], sources_odd[k], gf, *sources[k], &tmp1, &tmp2, interfacesHandler);
+        // to use cg, one needs an hermitian matrix, which is QplusQminus
+        // the source must now be gamma5 b, to obtain the desired solution in the end
+        sources_even[k]->gamma5();
+        // Trial solution
+        results_eo[k]->cold();
+    }
+
+    logger.debug() << "start batched eoprec-inversion of " << num_sources << " sources";
+    QplusQminus_eo f_eo(system, interfacesHandler.getInterface<physics::fermionmatrix::QplusQminus_eo>());
+    const int converged = cg(results_eo, f_eo, gf, sources_even, system, interfacesHandler,
+                             parametersInterface.getSolverPrec(), additionalParameters);
+
+    Qminus_eo qminus(system, interfacesHandler.getInterface<physics::fermionmatrix::Qminus_eo>());
+    for (size_t k = 0; k < num_sources; k++) {
+        // now, calc Qminus result_buf_eo to obtain x = A^⁻1 b
+        // therefore, use source as an intermediate buffer
+        qminus(sources_even[k], gf, *results_eo[k], additionalParameters);
+        copyData(results_eo[k], *sources_even[k]);
+
+        reconstruct_solution(results[k], gf, *results_eo[k], *sources_odd[k], &tmp1, &tmp2, interfacesHandler);
+        print_debug_inv_field(results[k], "\tsolution ");
+    }
+
+    logger.debug() << "\t\t\tbatched solver solved in " << converged << " iterations!";
+}
+
+static void prepare_even_source(const physics::lattices::Spinorfield_eo* source_even,
+                                const physics::lattices::Spinorfield_eo* source_odd,
+                                const physics::lattices::Gaugefield& gf, const physics::lattices::Spinorfield& source,
+                                const physics::lattices::Spinorfield_eo* tmp1,
+                                const physics::lattices::Spinorfield_eo* tmp2,
+                                physics::InterfacesHandler& interfacesHandler)
+{
+    using namespace physics::lattices;
+    using namespace physics::fermionmatrix;
+
+    const physics::algorithms::InversionParemetersInterface&
+        parametersInterface = interfacesHandler.getInversionParemetersInterface();
+    const physics::AdditionalParameters&
+        additionalParameters = interfacesHandler.getAdditionalParameters<physics::lattices::Spinorfield>();
+    hmc_complex one = hmc_complex_one;
+
+    // convert source and input-vector to eoprec-format
+    /**
+     * This currently is a workaround connected to issue #387
+     * the roles of even/odd vectors are interchanged!
+     * @todo: fix
+     * original code:
+     * spinor_code->convert_to_eoprec_device(&clmem_source_even, &clmem_source_odd, source_buf);
+     * workaround:
+     */
+    convert_to_eoprec(source_odd, source_even, source);
+
+    ///@todo: work over these debug outputs once the above issue is settled
+    print_debug_inv_field(source, "\tsource before inversion ");
+    print_debug_inv_field(source_even, "\teven source before inversion ");
+    print_debug_inv_field(source_odd, "\todd source before inversion ");
+
+    // prepare sources
+    /**
+     * This changes the even source according to (with A = M + D):
+     *  b_e = b_e - D_eo M_inv b_o
+     */
+    if (parametersInterface.getFermact() == common::action::wilson) {
+        // in this case, the diagonal matrix is just 1 and falls away.
+        dslash(tmp1, gf, *source_odd, EVEN, additionalParameters.getKappa());
+        saxpy(source_even, one, *source_even, *tmp1);
+    } else if (parametersInterface.getFermact() == common::action::twistedmass) {
+        M_tm_inverse_sitediagonal(tmp1, *source_odd, additionalParameters.getMubar());
+        dslash(tmp2, gf, *tmp1, EVEN, additionalParameters.getKappa());
+        saxpy(source_even, one, *source_even, *tmp2);
+    }
+}
+
+static void reconstruct_solution(const physics::lattices::Spinorfield* result,
+                                 const physics::lattices::Gaugefield& gf,
+                                 const physics::lattices::Spinorfield_eo& result_eo,
+                                 const physics::lattices::Spinorfield_eo& source_odd,
+                                 const physics::lattices::Spinorfield_eo* tmp1,
+                                 const physics::lattices::Spinorfield_eo* tmp2,
+                                 physics::InterfacesHandler& interfacesHandler)
+{
+    using namespace physics::lattices;
+    using namespace physics::fermionmatrix;
+
+    const physics::algorithms::InversionParemetersInterface&
+        parametersInterface = interfacesHandler.getInversionParemetersInterface();
+    const physics::AdditionalParameters&
+        additionalParameters = interfacesHandler.getAdditionalParameters<physics::lattices::Spinorfield>();
+    hmc_complex mone = {-1., 0.};
+
+    // odd solution
+    /** The odd solution is obtained from the even one according to:
+     *  x_o = M_inv b_o - M_inv D x_e
+     * @todo: find out why it must be (issue #389)
+     *  x_o = - M_inv b_o - M_inv D x_e
+     *      = -(M_inv D x_e + M_inv b_o)
+     */
+    if (parametersInterface.getFermact() == common::action::wilson) {
+        // in this case, the diagonal matrix is just 1 and falls away.
+        dslash(tmp1, gf, result_eo, ODD, additionalParameters.getKappa());
+        saxpy(tmp1, mone, *tmp1, source_odd);
+        sax(tmp1, mone, *tmp1);
+    } else if (parametersInterface.getFermact() == common::action::twistedmass) {
+        dslash(tmp2, gf, result_eo, ODD, additionalParameters.getKappa());
+        M_tm_inverse_sitediagonal(tmp1, *tmp2, additionalParameters.getMubar());
+        M_tm_inverse_sitediagonal(tmp2, source_odd, additionalParameters.getMubar());
+        saxpy(tmp1, mone, *tmp1, *tmp2);
+        sax(tmp1, mone, *tmp1);
+    }
+
+    /// CP: whole solution
+    // convert source and input-vector to eoprec-format
+    /**
+     * This currently is a workaround connected to issue #387
+     * the roles of even/odd vectors are interchanged!
+     * @todo: fix
+     * original code:
+     * //CP: suppose the even sol is saved in inout_eoprec, the odd one in clmem_tmp_eo_1
+     * spinor_code->convert_from_eoprec_device(&result_buf_eo, &clmem_tmp_eo_1, result_buf);
+     * workaround:
+     */
+    // CP: suppose the odd sol is saved in inout_eoprec, the even one in clmem_tmp_eo_1
+    convert_from_eoprec(result, *tmp1, result_eo);
+}
+
 template<class Spinorfield>
 static hmc_float print_debug_inv_field(const Spinorfield* in, std::string msg)
 {
@@ -26,6 +26,7 @@
 #include "molecular_dynamics.hpp"
 
 #include "../../hardware/code/molecular_dynamics.hpp"
+#include "../../hardware/tracer.hpp"
 #include "../../meta/util.hpp"
 #include "../fermionmatrix/fermionmatrix.hpp"
 #include "../lattices/util.hpp"
@@ -234,6 +235,7 @@ static void md_update_gaugemomentum(const physics::lattices::Gaugemomenta* const
                                     const physics::AdditionalParameters& additionalParameters)
 {
     using namespace physics::algorithms;
+    hardware::TracePhase phase(system, "force_total");
 
     physics::lattices::Gaugemomenta delta_p(system, interfacesHandler.getInterface<physics::lattices::Gaugemomenta>());
     delta_p.zero();
@@ -295,6 +297,8 @@ void physics::algorithms::md_update_gaugemomentum_gauge(const physics::lattices:
                                                         const hardware::System& system,
                                                         physics::InterfacesHandler& interfaceHandler)
 {
+    hardware::TracePhase phase(system, "force_gauge");
+
     const physics::lattices::Gaugemomenta force(system,
                                                 interfaceHandler.getInterface<physics::lattices::Gaugemomenta>());
     force.zero();
@@ -313,6 +317,7 @@ md_update_gaugemomentum_fermion(const physics::lattices::Gaugemomenta* const ino
                                 const physics::AdditionalParameters& additionalParameters)
 {
     using namespace physics::algorithms;
+    hardware::TracePhase phase(system, "force_fermion");
 
     const physics::lattices::Gaugemomenta force(system,
                                                 interfacesHandler.getInterface<physics::lattices::Gaugemomenta>());
@@ -376,6 +381,7 @@ md_update_gaugemomentum_detratio(const physics::lattices::Gaugemomenta* const in
                                  const hardware::System& system, physics::InterfacesHandler& interfacesHandler)
 {
     using namespace physics::algorithms;
+    hardware::TracePhase phase(system, "force_detratio");
 
     const physics::lattices::Gaugemomenta force(system,
                                                 interfacesHandler.getInterface<physics::lattices::Gaugemomenta>());
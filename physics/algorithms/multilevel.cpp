@@ -0,0 +1,132 @@
+/** @file
+ * Implementation of the multilevel algorithm
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "multilevel.hpp"
+
+#include "../../common_header_files/operations_complex.hpp"
+#include "../../hardware/code/heatbath.hpp"
+#include "../../hardware/device.hpp"
+#include "su3heatbath.hpp"
+
+#include <memory>
+#include <set>
+#include <stdexcept>
+
+static hmc_complex Matrix3x3::*const matrixElements[3][3] = {{&Matrix3x3::e00, &Matrix3x3::e01, &Matrix3x3::e02},
+                                                             {&Matrix3x3::e10, &Matrix3x3::e11, &Matrix3x3::e12},
+                                                             {&Matrix3x3::e20, &Matrix3x3::e21, &Matrix3x3::e22}};
+
+static Matrix3x3 unit_matrix3x3()
+{
+    Matrix3x3 out;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            out.*matrixElements[i][j] = (i == j) ? hmc_complex_one : hmc_complex_zero;
+        }
+    }
+    return out;
+}
+
+/**
+ * Multiply p with q scaled by the given real factor.
+ */
+static Matrix3x3 multiply_matrix3x3(const Matrix3x3& p, const Matrix3x3& q, const hmc_float factor)
+{
+    Matrix3x3 out;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            hmc_complex element = hmc_complex_zero;
+            for (int k = 0; k < 3; ++k) {
+                element = complexadd(element, complexmult(p.*matrixElements[i][k], q.*matrixElements[k][j]));
+            }
+            out.*matrixElements[i][j] = {element.re * factor, element.im * factor};
+        }
+    }
+    return out;
+}
+
+static void check_sublattice_extent(const physics::lattices::Gaugefield& gf, const unsigned sublatticeExtent)
+{
+    if (sublatticeExtent == 0 || gf.getParameters()->getNt() % sublatticeExtent != 0) {
+        throw std::invalid_argument("The sublattice extent has to divide the temporal extent of the lattice.");
+    }
+    for (auto buffer : gf.get_buffers()) {
+        if (buffer->get_device()->getLocalLatticeExtents().tExtent % sublatticeExtent != 0) {
+            throw std::invalid_argument("The sublattice extent has to divide the temporal extent on each device.");
+        }
+    }
+}
+
+std::vector<hmc_complex> physics::algorithms::multilevel_polyakov_loops(physics::lattices::Gaugefield& gf,
+                                                                        physics::PRNG& prng,
+                                                                        unsigned sublatticeExtent,
+                                                                        unsigned numberOfUpdates, int overrelax)
+{
+    check_sublattice_extent(gf, sublatticeExtent);
+    if (numberOfUpdates == 0) {
+        throw std::invalid_argument("The multilevel algorithm needs at least one sublattice update.");
+    }
+
+    std::set<int> boundaries;
+    for (unsigned t = 0; t < gf.getParameters()->getNt(); t += sublatticeExtent) {
+        boundaries.insert(t);
+    }
+
+    // one transporter per spatial site and sublattice on each device
+    const auto gf_buffers = gf.get_buffers();
+    std::vector<std::unique_ptr<const hardware::buffers::Plain<Matrix3x3>>> transporters;
+    for (auto gf_dev : gf_buffers) {
+        const auto localExtents = gf_dev->get_device()->getLocalLatticeExtents();
+        transporters.emplace_back(new hardware::buffers::Plain<Matrix3x3>(
+            localExtents.getSpatialLatticeVolume() * (localExtents.tExtent / sublatticeExtent), gf_dev->get_device()));
+        transporters.back()->clear();
+    }
+
+    for (unsigned update = 0; update < numberOfUpdates; ++update) {
+        su3heatbath(gf, prng, overrelax, boundaries);
+        for (size_t i = 0; i < gf_buffers.size(); ++i) {
+            auto code = gf_buffers[i]->get_device()->getHeatbathCode();
+            code->accumulate_sublattice_transporters(transporters[i].get(), gf_buffers[i], sublatticeExtent);
+        }
+    }
+
+    // the devices follow each other in time direction, such that the sublattices are met in time order
+    const size_t spatialVolume = gf_buffers[0]->get_device()->getLocalLatticeExtents().getSpatialLatticeVolume();
+    const hmc_float average    = 1. / numberOfUpdates;
+    std::vector<Matrix3x3> products(spatialVolume, unit_matrix3x3());
+    std::vector<Matrix3x3> host_transporters;
+    for (const auto& transporter : transporters) {
+        host_transporters.resize(transporter->get_elements());
+        transporter->dump(host_transporters.data());
+        for (size_t n = 0; n < host_transporters.size(); ++n) {
+            Matrix3x3& product = products[n % spatialVolume];
+            product            = multiply_matrix3x3(product, host_transporters[n], average);
+        }
+    }
+
+    std::vector<hmc_complex> polyakov_loops(spatialVolume);
+    for (size_t site = 0; site < spatialVolume; ++site) {
+        const Matrix3x3& product = products[site];
+        const hmc_complex trace  = complexadd(complexadd(product.e00, product.e11), product.e22);
+        polyakov_loops[site]     = {trace.re / NC, trace.im / NC};
+    }
+    return polyakov_loops;
+}
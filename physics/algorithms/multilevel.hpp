@@ -0,0 +1,60 @@
+/** @file
+ * Declaration of the multilevel algorithm
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PHYSICS_ALGORITHMS_MULTILEVEL_
+#define _PHYSICS_ALGORITHMS_MULTILEVEL_
+
+#include "../lattices/gaugefield.hpp"
+#include "../prng.hpp"
+
+#include <vector>
+
+namespace physics {
+
+    namespace algorithms {
+
+        /**
+         * Measure the Polyakov loop on every spatial site with the multilevel algorithm of Lüscher and Weisz.
+         *
+         * The lattice is split in time into sublattices of sublatticeExtent timeslices, whose boundaries are the
+         * timeslices 0, sublatticeExtent, 2 * sublatticeExtent and so on. With the spatial links on the boundaries
+         * kept fixed, the sublattices are updated independently of each other by heatbath and overrelaxation and the
+         * product of the temporal links through each of them is averaged over numberOfUpdates updates. The average
+         * is accumulated on the devices, all sublattices being updated and accumulated by the same kernel launches.
+         * The Polyakov loop is the trace of the product of the averages of all sublattices.
+         *
+         * @param[in,out] gf The gaugefield, which is left as after the last sublattice update
+         * @param[in,out] prng The PRNG to use
+         * @param[in] sublatticeExtent The temporal extent of the sublattices, it has to divide the temporal extent of
+         *                             the lattice on each device
+         * @param[in] numberOfUpdates The number of sublattice updates to average over
+         * @param[in] overrelax The number of overrelaxation steps of each sublattice update. Default is none.
+         * @return The Polyakov loop (normalized to NC) on each spatial site, in the order used by the device code
+         */
+        std::vector<hmc_complex> multilevel_polyakov_loops(physics::lattices::Gaugefield& gf, physics::PRNG& prng,
+                                                           unsigned sublatticeExtent, unsigned numberOfUpdates,
+                                                           int overrelax = 0);
+
+    }  // namespace algorithms
+
+}  // namespace physics
+
+#endif /* _PHYSICS_ALGORITHMS_MULTILEVEL_ */
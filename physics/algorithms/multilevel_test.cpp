@@ -0,0 +1,115 @@
+/** @file
+ * Tests of the multilevel algorithm
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "multilevel.hpp"
+
+#include "../../host_functionality/logger.hpp"
+#include "../../interfaceImplementations/hardwareParameters.hpp"
+#include "../../interfaceImplementations/interfacesHandler.hpp"
+#include "../../interfaceImplementations/openClKernelParameters.hpp"
+#include "../observables/gaugeObservables.hpp"
+
+// use the boost test framework
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE physics::algorithms::multilevel
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+
+/**
+ * With a single sublattice update, the averaged transporters are just the temporal links of the updated gaugefield,
+ * such that the multilevel Polyakov loops have to average to the plain Polyakov loop of that gaugefield.
+ */
+static void testAgainstPolyakovloop(const char* configuration, const unsigned sublatticeExtent)
+{
+    using namespace physics::lattices;
+
+    const char* _params[] = {"foo", "--nTime=4", "--nDevices=1"};
+    meta::Inputparameters params(3, _params);
+    hardware::HardwareParametersImplementation hP(&params);
+    hardware::code::OpenClKernelParametersImplementation kP(params);
+    hardware::System system(hP, kP);
+    physics::InterfacesHandlerImplementation interfacesHandler{params};
+    physics::PrngParametersImplementation prngParameters{params};
+    physics::PRNG prng{system, &prngParameters};
+
+    std::unique_ptr<Gaugefield> gf;
+    if (configuration) {
+        gf.reset(new Gaugefield(system, &interfacesHandler.getInterface<Gaugefield>(), prng,
+                                std::string(SOURCEDIR) + "/ildg_io/" + configuration));
+    } else {
+        gf.reset(new Gaugefield(system, &interfacesHandler.getInterface<Gaugefield>(), prng, false));
+    }
+
+    const auto loops = physics::algorithms::multilevel_polyakov_loops(*gf, prng, sublatticeExtent, 1);
+    BOOST_REQUIRE_EQUAL(loops.size(), params.get_nspace() * params.get_nspace() * params.get_nspace());
+    hmc_complex average = hmc_complex_zero;
+    for (const auto& loop : loops) {
+        average.re += loop.re / loops.size();
+        average.im += loop.im / loops.size();
+    }
+
+    const hmc_complex reference =
+        physics::observables::measurePolyakovloop(gf.get(), interfacesHandler.getGaugeObservablesParametersInterface());
+    logger.info() << "multilevel: " << average.re << " " << average.im;
+    logger.info() << "reference:  " << reference.re << " " << reference.im;
+    BOOST_CHECK_SMALL(average.re - reference.re, 1.e-12);
+    BOOST_CHECK_SMALL(average.im - reference.im, 1.e-12);
+}
+
+BOOST_AUTO_TEST_CASE(cold_one_sublattice)
+{
+    testAgainstPolyakovloop(nullptr, 4);
+}
+
+BOOST_AUTO_TEST_CASE(cold_two_sublattices)
+{
+    testAgainstPolyakovloop(nullptr, 2);
+}
+
+BOOST_AUTO_TEST_CASE(conf00200_one_sublattice)
+{
+    testAgainstPolyakovloop("conf.00200", 4);
+}
+
+BOOST_AUTO_TEST_CASE(conf00200_two_sublattices)
+{
+    testAgainstPolyakovloop("conf.00200", 2);
+}
+
+BOOST_AUTO_TEST_CASE(invalid_arguments)
+{
+    using namespace physics::lattices;
+
+    const char* _params[] = {"foo", "--nTime=4", "--nDevices=1"};
+    meta::Inputparameters params(3, _params);
+    hardware::HardwareParametersImplementation hP(&params);
+    hardware::code::OpenClKernelParametersImplementation kP(params);
+    hardware::System system(hP, kP);
+    physics::InterfacesHandlerImplementation interfacesHandler{params};
+    physics::PrngParametersImplementation prngParameters{params};
+    physics::PRNG prng{system, &prngParameters};
+    Gaugefield gf(system, &interfacesHandler.getInterface<Gaugefield>(), prng, false);
+
+    BOOST_CHECK_THROW(physics::algorithms::multilevel_polyakov_loops(gf, prng, 3, 1), std::invalid_argument);
+    BOOST_CHECK_THROW(physics::algorithms::multilevel_polyakov_loops(gf, prng, 0, 1), std::invalid_argument);
+    BOOST_CHECK_THROW(physics::algorithms::multilevel_polyakov_loops(gf, prng, 2, 0), std::invalid_argument);
+}
@@ -47,7 +47,8 @@ perform_rhmc_step(const physics::algorithms::Rational_Approximation& approx1,
                   const physics::algorithms::Rational_Approximation& approx2,
                   const physics::algorithms::Rational_Approximation& approx3,
                   const physics::lattices::Gaugefield* const gf, const int iter, const hmc_float rnd_number,
-                  physics::PRNG& prng, const hardware::System& system, physics::InterfacesHandler& interfacesHandler)
+                  physics::PRNG& prng, const hardware::System& system, physics::InterfacesHandler& interfacesHandler,
+                  physics::algorithms::SpectralBoundsEstimator& spectralBounds)
 {
     using namespace physics::algorithms;
     using namespace physics::lattices;
@@ -73,8 +74,8 @@ perform_rhmc_step(const physics::algorithms::Rational_Approximation& approx1,
     physics::fermionmatrix::MdagM_eo fm(system, interfacesHandler.getInterface<physics::fermionmatrix::MdagM_eo>());
     hmc_float maxEigenvalue;
     hmc_float minEigenvalue;
-    find_maxmin_eigenvalue(maxEigenvalue, minEigenvalue, fm, *gf, system, interfacesHandler,
-                           parametersInterface.getFindMinMaxPrec(), additionalParameters);
+    spectralBounds.findMaxMinEigenvalue(maxEigenvalue, minEigenvalue, fm, *gf, parametersInterface.getFindMinMaxPrec(),
+                                        additionalParameters);
     if (parametersInterface.getConservative())
         maxEigenvalue *= 1.05;
     hmc_float conditionNumber = maxEigenvalue / minEigenvalue;
@@ -111,8 +112,8 @@ perform_rhmc_step(const physics::algorithms::Rational_Approximation& approx1,
     // metropolis step: afterwards, the updated config is again in gaugefield and p
     logger.debug() << "\tRHMC [MET]:\tperform Metropolis step: ";
     // Before Metropolis test the coeff. of phi have to be set to the rescaled ones on the base of approx3
-    find_maxmin_eigenvalue(maxEigenvalue, minEigenvalue, fm, new_u, system, interfacesHandler,
-                           parametersInterface.getFindMinMaxPrec(), additionalParameters);
+    spectralBounds.findMaxMinEigenvalue(maxEigenvalue, minEigenvalue, fm, new_u,
+                                        parametersInterface.getFindMinMaxPrec(), additionalParameters);
     if (parametersInterface.getConservative())
         maxEigenvalue *= 1.05;
     phi.Rescale_Coefficients(approx3, minEigenvalue, maxEigenvalue);
@@ -154,7 +155,8 @@ hmc_observables physics::algorithms::perform_rhmc_step(const physics::algorithms
                                                        const physics::lattices::Gaugefield* const gf, const int iter,
                                                        const hmc_float rnd_number, physics::PRNG& prng,
                                                        const hardware::System& system,
-                                                       physics::InterfacesHandler& interfaceHandler)
+                                                       physics::InterfacesHandler& interfaceHandler,
+                                                       physics::algorithms::SpectralBoundsEstimator& spectralBounds)
 {
     using namespace physics::lattices;
 
@@ -162,7 +164,7 @@ hmc_observables physics::algorithms::perform_rhmc_step(const physics::algorithms
                                                                                   .getRhmcParametersInterface();
     if (parametersInterface.getUseEo()) {
         return ::perform_rhmc_step<Rooted_Staggeredfield_eo>(approx1, approx2, approx3, gf, iter, rnd_number, prng,
-                                                             system, interfaceHandler);
+                                                             system, interfaceHandler, spectralBounds);
     } else {
         throw Print_Error_Message("RHMC algorithm not implemented for non even-odd preconditioned fields!", __FILE__,
                                   __LINE__);
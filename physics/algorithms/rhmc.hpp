@@ -28,6 +28,7 @@
 #include "../lattices/gaugefield.hpp"
 #include "../prng.hpp"
 #include "rational_approximation.hpp"
+#include "spectral_bounds.hpp"
 
 namespace physics {
     namespace algorithms {
@@ -36,7 +37,8 @@ namespace physics {
                                           const Rational_Approximation& approx3,
                                           const physics::lattices::Gaugefield* gf, int iter, hmc_float rnd_number,
                                           physics::PRNG& prng, const hardware::System& system,
-                                          physics::InterfacesHandler& interfacesHandler);
+                                          physics::InterfacesHandler& interfacesHandler,
+                                          SpectralBoundsEstimator& spectralBounds);
     }
 }  // namespace physics
 
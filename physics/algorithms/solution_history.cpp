@@ -0,0 +1,206 @@
+/** @file
+ * Implementation of the solution history used to build starting guesses for the Molecular Dynamics inversions
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "solution_history.hpp"
+
+#include "../../common_header_files/operations_complex.hpp"
+#include "../../host_functionality/logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+static bool solve_galerkin_system(std::vector<hmc_complex>& G, std::vector<hmc_complex>& v, const size_t n);
+static hmc_float complexabs(const hmc_complex in) noexcept;
+
+
+template<class SPINORFIELD, class FERMIONMATRIX>
+physics::algorithms::SolutionHistory<SPINORFIELD, FERMIONMATRIX>::SolutionHistory(
+    const unsigned maxSizeIn, const hardware::System& systemIn,
+    const typename InterfaceType<SPINORFIELD>::value& spinorfieldParametersInterfaceIn)
+    : maxSize(maxSizeIn)
+    , system(systemIn)
+    , spinorfieldParametersInterface(spinorfieldParametersInterfaceIn)
+    , solutions()
+    , oldest(0)
+{
+    solutions.reserve(maxSize);
+}
+
+template<class SPINORFIELD, class FERMIONMATRIX>
+void physics::algorithms::SolutionHistory<SPINORFIELD, FERMIONMATRIX>::makeGuess(
+    const SPINORFIELD* guess, const FERMIONMATRIX& A, const physics::lattices::Gaugefield& gf, const SPINORFIELD& b,
+    const physics::AdditionalParameters& additionalParameters) const
+{
+    const size_t n = solutions.size();
+    if (n == 0) {
+        guess->cold();
+        return;
+    }
+
+    std::vector<hmc_complex> G(n * n);
+    std::vector<hmc_complex> v(n);
+    const SPINORFIELD tmp(system, spinorfieldParametersInterface);
+    for (size_t j = 0; j < n; ++j) {
+        A(&tmp, gf, *solutions[j], additionalParameters);
+        for (size_t i = 0; i < n; ++i) {
+            G[i * n + j] = physics::lattices::scalar_product(*solutions[i], tmp);
+        }
+        v[j] = physics::lattices::scalar_product(*solutions[j], b);
+    }
+
+    if (!solve_galerkin_system(G, v, n)) {
+        logger.debug() << "\t\t\tsolution history is linearly dependent, using cold trial solution";
+        guess->cold();
+        return;
+    }
+
+    // saxpy calculates y - alpha * x, therefore the coefficients enter with the opposite sign
+    guess->zero();
+    for (size_t j = 0; j < n; ++j) {
+        physics::lattices::saxpy(guess, {-v[j].re, -v[j].im}, *solutions[j], *guess);
+    }
+    logger.debug() << "\t\t\tusing extrapolation of " << n << " previous solutions as trial solution";
+}
+
+template<class SPINORFIELD, class FERMIONMATRIX>
+void physics::algorithms::SolutionHistory<SPINORFIELD, FERMIONMATRIX>::store(const SPINORFIELD& solution)
+{
+    if (maxSize == 0) {
+        return;
+    }
+    if (solutions.size() < maxSize) {
+        solutions.emplace_back(new SPINORFIELD(system, spinorfieldParametersInterface));
+        physics::lattices::sax(solutions.back().get(), {1., 0.}, solution);
+    } else {
+        physics::lattices::sax(solutions[oldest].get(), {1., 0.}, solution);
+        oldest = (oldest + 1) % maxSize;
+    }
+}
+
+template<class SPINORFIELD, class FERMIONMATRIX>
+unsigned physics::algorithms::SolutionHistory<SPINORFIELD, FERMIONMATRIX>::size() const noexcept
+{
+    return solutions.size();
+}
+
+template class physics::algorithms::SolutionHistory<physics::lattices::Spinorfield,
+                                                    physics::fermionmatrix::Fermionmatrix>;
+template class physics::algorithms::SolutionHistory<physics::lattices::Spinorfield_eo,
+                                                    physics::fermionmatrix::Fermionmatrix_eo>;
+
+physics::algorithms::SolutionHistoryScope::SolutionHistoryScope(const hardware::System& systemIn,
+                                                                physics::InterfacesHandler& interfacesHandlerIn)
+    : system(systemIn)
+    , interfacesHandler(interfacesHandlerIn)
+    , historySize(interfacesHandlerIn.getForcesParametersInterface().getSolverForceHistorySize())
+    , previous(interfacesHandlerIn.getSolutionHistories())
+    , histories()
+    , histories_eo()
+{
+    interfacesHandler.setSolutionHistories(this);
+}
+
+physics::algorithms::SolutionHistoryScope::~SolutionHistoryScope()
+{
+    interfacesHandler.setSolutionHistories(previous);
+}
+
+physics::algorithms::SolutionHistory<physics::lattices::Spinorfield, physics::fermionmatrix::Fermionmatrix>*
+physics::algorithms::SolutionHistoryScope::getHistory(const physics::lattices::Spinorfield& pseudofermion,
+                                                      const bool detratio)
+{
+    if (historySize == 0) {
+        return nullptr;
+    }
+    auto& history = histories[Key(&pseudofermion, detratio)];
+    if (!history) {
+        history.reset(new SolutionHistory<physics::lattices::Spinorfield, physics::fermionmatrix::Fermionmatrix>(
+            historySize, system, interfacesHandler.getInterface<physics::lattices::Spinorfield>()));
+    }
+    return history.get();
+}
+
+physics::algorithms::SolutionHistory<physics::lattices::Spinorfield_eo, physics::fermionmatrix::Fermionmatrix_eo>*
+physics::algorithms::SolutionHistoryScope::getHistory(const physics::lattices::Spinorfield_eo& pseudofermion,
+                                                      const bool detratio)
+{
+    if (historySize == 0) {
+        return nullptr;
+    }
+    auto& history = histories_eo[Key(&pseudofermion, detratio)];
+    if (!history) {
+        history.reset(new SolutionHistory<physics::lattices::Spinorfield_eo, physics::fermionmatrix::Fermionmatrix_eo>(
+            historySize, system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>()));
+    }
+    return history.get();
+}
+
+/**
+ * Solve G c = v by Gaussian elimination with partial pivoting, the solution c is returned in v.
+ * Returns false if G is numerically singular, which happens if the stored solutions are (almost) linearly dependent.
+ */
+static bool solve_galerkin_system(std::vector<hmc_complex>& G, std::vector<hmc_complex>& v, const size_t n)
+{
+    hmc_float scale = 0.;
+    for (size_t i = 0; i < n; ++i) {
+        scale = std::max(scale, complexabs(G[i * n + i]));
+    }
+    const hmc_float threshold = scale * n * std::numeric_limits<hmc_float>::epsilon();
+
+    for (size_t k = 0; k < n; ++k) {
+        size_t pivot = k;
+        for (size_t i = k + 1; i < n; ++i) {
+            if (complexabs(G[i * n + k]) > complexabs(G[pivot * n + k])) {
+                pivot = i;
+            }
+        }
+        if (!(complexabs(G[pivot * n + k]) > threshold)) {
+            return false;
+        }
+        if (pivot != k) {
+            for (size_t j = 0; j < n; ++j) {
+                std::swap(G[k * n + j], G[pivot * n + j]);
+            }
+            std::swap(v[k], v[pivot]);
+        }
+        for (size_t i = k + 1; i < n; ++i) {
+            const hmc_complex factor = complexdivide(G[i * n + k], G[k * n + k]);
+            for (size_t j = k; j < n; ++j) {
+                G[i * n + j] = complexsubtract(G[i * n + j], complexmult(factor, G[k * n + j]));
+            }
+            v[i] = complexsubtract(v[i], complexmult(factor, v[k]));
+        }
+    }
+
+    for (size_t k = n; k-- > 0;) {
+        for (size_t j = k + 1; j < n; ++j) {
+            v[k] = complexsubtract(v[k], complexmult(G[k * n + j], v[j]));
+        }
+        v[k] = complexdivide(v[k], G[k * n + k]);
+    }
+    return true;
+}
+
+static hmc_float complexabs(const hmc_complex in) noexcept
+{
+    return std::sqrt(in.re * in.re + in.im * in.im);
+}
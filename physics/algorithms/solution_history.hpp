@@ -0,0 +1,122 @@
+/** @file
+ * Declaration of the solution history used to build starting guesses for the Molecular Dynamics inversions
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PHYSICS_ALGORITHMS_SOLUTION_HISTORY_
+#define _PHYSICS_ALGORITHMS_SOLUTION_HISTORY_
+
+#include "../fermionmatrix/fermionmatrix.hpp"
+#include "../interfacesHandler.hpp"
+#include "../lattices/gaugefield.hpp"
+#include "../lattices/spinorfield.hpp"
+#include "../lattices/spinorfield_eo.hpp"
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace physics {
+    namespace algorithms {
+
+        /**
+         * Ring buffer with the last solutions of the hermitian positive definite system A x = b for one pseudofermion.
+         *
+         * Along a trajectory the operator A changes only slightly from one Molecular Dynamics step to the next, so the
+         * stored solutions span a space which contains a good approximation of the next solution (chronological
+         * inverter). The starting guess is the linear combination of the stored solutions which minimizes the A-norm
+         * of the error, i.e. the solution of the small Galerkin system G c = v with G_ij = <x_i, A x_j> and
+         * v_i = <x_i, b>, which is solved on the host.
+         */
+        template<class SPINORFIELD, class FERMIONMATRIX>
+        class SolutionHistory {
+          public:
+            SolutionHistory(const unsigned maxSize, const hardware::System& system,
+                            const typename InterfaceType<SPINORFIELD>::value& spinorfieldParametersInterface);
+            SolutionHistory(const SolutionHistory&) = delete;
+            SolutionHistory& operator=(const SolutionHistory&) = delete;
+
+            /**
+             * Fill guess with the minimal-residual extrapolation of the stored solutions for the system A x = b.
+             * If no solution is stored or the Galerkin system turns out to be singular, guess is set cold.
+             */
+            void makeGuess(const SPINORFIELD* guess, const FERMIONMATRIX& A, const physics::lattices::Gaugefield& gf,
+                           const SPINORFIELD& b, const physics::AdditionalParameters& additionalParameters) const;
+
+            /**
+             * Add a solution to the history, replacing the oldest one if the history is full.
+             */
+            void store(const SPINORFIELD& solution);
+
+            unsigned size() const noexcept;
+
+          private:
+            const unsigned maxSize;
+            const hardware::System& system;
+            const typename InterfaceType<SPINORFIELD>::value& spinorfieldParametersInterface;
+            std::vector<std::unique_ptr<const SPINORFIELD>> solutions;
+            unsigned oldest;
+        };
+
+        /**
+         * Owner of the solution histories of all pseudofermions of one HMC trajectory.
+         *
+         * While an object of this class is alive it is registered in the InterfacesHandler it was created with and the
+         * force calculations using that handler pick their histories from it, keyed by the pseudofermion field and by
+         * whether the determinant ratio force is computed. The histories are released together with the scope, i.e.
+         * they never outlive the pseudofermions they belong to. Without a registered scope or with a history size of 0
+         * the inversions start from a cold guess.
+         */
+        class SolutionHistoryScope {
+          public:
+            SolutionHistoryScope(const hardware::System& system, physics::InterfacesHandler& interfacesHandler);
+            ~SolutionHistoryScope();
+            SolutionHistoryScope(const SolutionHistoryScope&) = delete;
+            SolutionHistoryScope& operator=(const SolutionHistoryScope&) = delete;
+
+            /**
+             * Get the history belonging to the given pseudofermion, nullptr if no history is to be kept.
+             */
+            SolutionHistory<physics::lattices::Spinorfield, physics::fermionmatrix::Fermionmatrix>*
+            getHistory(const physics::lattices::Spinorfield& pseudofermion, const bool detratio);
+            SolutionHistory<physics::lattices::Spinorfield_eo, physics::fermionmatrix::Fermionmatrix_eo>*
+            getHistory(const physics::lattices::Spinorfield_eo& pseudofermion, const bool detratio);
+
+          private:
+            typedef std::pair<const void*, bool> Key;
+
+            const hardware::System& system;
+            physics::InterfacesHandler& interfacesHandler;
+            const unsigned historySize;
+            SolutionHistoryScope* const previous;
+            std::map<Key,
+                     std::unique_ptr<SolutionHistory<physics::lattices::Spinorfield,
+                                                     physics::fermionmatrix::Fermionmatrix>>>
+                histories;
+            std::map<Key,
+                     std::unique_ptr<SolutionHistory<physics::lattices::Spinorfield_eo,
+                                                     physics::fermionmatrix::Fermionmatrix_eo>>>
+                histories_eo;
+        };
+
+    }  // namespace algorithms
+}  // namespace physics
+
+#endif /* _PHYSICS_ALGORITHMS_SOLUTION_HISTORY_ */
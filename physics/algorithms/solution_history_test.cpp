@@ -0,0 +1,148 @@
+/** @file
+ * Tests of the solution history used to build starting guesses for the Molecular Dynamics inversions
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "solution_history.hpp"
+
+// use the boost test framework
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE physics::algorithms::solution_history
+#include "../../interfaceImplementations/hardwareParameters.hpp"
+#include "../../interfaceImplementations/interfacesHandler.hpp"
+#include "../../interfaceImplementations/openClKernelParameters.hpp"
+#include "../lattices/util.hpp"
+#include "solvers/cg.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_CASE(empty_history_gives_cold_guess)
+{
+    using namespace physics::lattices;
+    using physics::algorithms::SolutionHistory;
+    using physics::fermionmatrix::Fermionmatrix_eo;
+
+    const char* _params[] = {"foo", "--nTime=4"};
+    meta::Inputparameters params(2, _params);
+    physics::InterfacesHandlerImplementation interfacesHandler{params};
+    hardware::HardwareParametersImplementation hP(&params);
+    hardware::code::OpenClKernelParametersImplementation kP(params);
+    hardware::System system(hP, kP);
+    physics::PrngParametersImplementation prngParameters{params};
+    physics::PRNG prng{system, &prngParameters};
+
+    Gaugefield gf(system, &interfacesHandler.getInterface<physics::lattices::Gaugefield>(), prng, false);
+    const physics::fermionmatrix::QplusQminus_eo
+        fm(system, interfacesHandler.getInterface<physics::fermionmatrix::QplusQminus_eo>());
+    Spinorfield_eo b(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
+    Spinorfield_eo guess(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
+    Spinorfield_eo cold(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
+    Spinorfield src(system, interfacesHandler.getInterface<physics::lattices::Spinorfield>());
+    pseudo_randomize<Spinorfield, spinor>(&src, 21);
+    convert_to_eoprec(&b, &guess, src);
+    cold.cold();
+
+    SolutionHistory<Spinorfield_eo, Fermionmatrix_eo> history(
+        3, system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
+    BOOST_REQUIRE_EQUAL(history.size(), 0);
+    history.makeGuess(&guess, fm, gf, b, interfacesHandler.getAdditionalParameters<Spinorfield_eo>());
+    BOOST_CHECK_CLOSE(squarenorm(guess), squarenorm(cold), 1.e-8);
+}
+
+BOOST_AUTO_TEST_CASE(guess_reproduces_stored_solution)
+{
+    using namespace physics::lattices;
+    using physics::algorithms::SolutionHistory;
+    using physics::fermionmatrix::Fermionmatrix_eo;
+
+    const char* _params[] = {"foo", "--nTime=4", "--fermionAction=twistedmass", "--mu=0.1", "--solver=cg"};
+    meta::Inputparameters params(5, _params);
+    physics::InterfacesHandlerImplementation interfacesHandler{params};
+    hardware::HardwareParametersImplementation hP(&params);
+    hardware::code::OpenClKernelParametersImplementation kP(params);
+    hardware::System system(hP, kP);
+    physics::PrngParametersImplementation prngParameters{params};
+    physics::PRNG prng{system, &prngParameters};
+
+    Gaugefield gf(system, &interfacesHandler.getInterface<physics::lattices::Gaugefield>(), prng,
+                  std::string(SOURCEDIR) + "/ildg_io/conf.00200");
+    const physics::fermionmatrix::QplusQminus_eo
+        fm(system, interfacesHandler.getInterface<physics::fermionmatrix::QplusQminus_eo>());
+    const physics::AdditionalParameters& additionalParameters = interfacesHandler
+                                                                    .getAdditionalParameters<Spinorfield_eo>();
+    Spinorfield_eo b(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
+    Spinorfield_eo other(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
+    Spinorfield_eo x(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
+    Spinorfield_eo guess(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
+    Spinorfield src(system, interfacesHandler.getInterface<physics::lattices::Spinorfield>());
+    pseudo_randomize<Spinorfield, spinor>(&src, 23);
+    convert_to_eoprec(&b, &other, src);
+
+    x.cold();
+    physics::algorithms::solvers::cg(&x, fm, gf, b, system, interfacesHandler, 1.e-23, additionalParameters);
+
+    // the exact solution lies in the span of the history, so the Galerkin projection has to find it
+    SolutionHistory<Spinorfield_eo, Fermionmatrix_eo> history(
+        2, system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
+    history.store(other);
+    history.store(x);
+    BOOST_REQUIRE_EQUAL(history.size(), 2);
+    history.makeGuess(&guess, fm, gf, b, additionalParameters);
+
+    saxpy(&guess, {1., 0.}, x, guess);
+    BOOST_CHECK_SMALL(squarenorm(guess) / squarenorm(x), 1.e-10);
+
+    // storing more solutions than the history size replaces the oldest ones
+    history.store(other);
+    history.store(other);
+    BOOST_CHECK_EQUAL(history.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(scope)
+{
+    using namespace physics::lattices;
+    using physics::algorithms::SolutionHistoryScope;
+
+    for (const char* historySize : {"--solverForceHistorySize=0", "--solverForceHistorySize=3"}) {
+        const char* _params[] = {"foo", "--nTime=4", historySize};
+        meta::Inputparameters params(3, _params);
+        physics::InterfacesHandlerImplementation interfacesHandler{params};
+        hardware::HardwareParametersImplementation hP(&params);
+        hardware::code::OpenClKernelParametersImplementation kP(params);
+        hardware::System system(hP, kP);
+
+        Spinorfield_eo phi(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
+        Spinorfield_eo phi_mp(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
+
+        BOOST_REQUIRE(interfacesHandler.getSolutionHistories() == nullptr);
+        {
+            SolutionHistoryScope scope(system, interfacesHandler);
+            BOOST_REQUIRE(interfacesHandler.getSolutionHistories() == &scope);
+            if (params.get_force_solution_history_size() == 0) {
+                BOOST_CHECK(scope.getHistory(phi, false) == nullptr);
+            } else {
+                BOOST_CHECK(scope.getHistory(phi, false) != nullptr);
+                BOOST_CHECK(scope.getHistory(phi, false) == scope.getHistory(phi, false));
+                BOOST_CHECK(scope.getHistory(phi, false) != scope.getHistory(phi, true));
+                BOOST_CHECK(scope.getHistory(phi, false) != scope.getHistory(phi_mp, false));
+            }
+        }
+        BOOST_CHECK(interfacesHandler.getSolutionHistories() == nullptr);
+    }
+}
@@ -25,6 +25,7 @@
 
 #include "solver_shifted.hpp"
 
+#include "../../hardware/tracer.hpp"
 #include "../../host_functionality/logger.hpp"
 #include "../lattices/algebra_real.hpp"
 #include "../lattices/scalar_complex.hpp"
@@ -42,6 +43,7 @@ int physics::algorithms::solvers::cg_m(std::vector<std::shared_ptr<physics::latt
                                        physics::InterfacesHandler& interfacesHandler, hmc_float prec,
                                        const physics::AdditionalParameters& additionalParameters)
 {
+    hardware::TracePhase phase(system, "cg_m");
     physics::algorithms::solvers::SolverShifted<physics::lattices::Staggeredfield_eo,
                                                 physics::fermionmatrix::Fermionmatrix_stagg_eo>
         solverShifted(x, A, gf, sigma, b, system, interfacesHandler, prec, additionalParameters);
@@ -197,6 +199,30 @@ void physics::algorithms::solvers::SolverShifted<FERMIONFIELD, FERMIONMATRIX>::u
     saxpby(ps[index].get(), zeta_foll, index, r, alpha_vec, index, *ps[index]);
 }
 
+template<typename FERMIONFIELD, typename FERMIONMATRIX>
+void physics::algorithms::solvers::SolverShifted<FERMIONFIELD, FERMIONMATRIX>::updateFieldsOfNotConvergedSystems()
+{
+    // x[k] = x[k] - beta[k]*ps[k] and ps[k] = zeta_iii[k]*r + alpha[k]*ps[k] for all not converged systems at once
+    std::vector<const FERMIONFIELD*> xNotConverged, psNotConverged;
+    std::vector<int> indicesNotConverged;
+    for (unsigned int index = 0; index < numberOfEquations; index++) {
+        if (hasSingleSystemConverged(index) == false) {
+            xNotConverged.push_back(x[index].get());
+            psNotConverged.push_back(ps[index].get());
+            indicesNotConverged.push_back(index);
+        }
+    }
+    update_x_and_ps_cgm(xNotConverged, psNotConverged, indicesNotConverged, r, beta_vec, zeta_foll, alpha_vec);
+}
+
+template<typename FERMIONFIELD, typename FERMIONMATRIX>
+void physics::algorithms::solvers::SolverShifted<FERMIONFIELD, FERMIONMATRIX>::releaseAuxiliaryFieldsOfSingleSystem(
+    unsigned int index)
+{
+    // ps[k] is not needed anymore once the k-th system converged, its device memory can be given back
+    ps[index].reset();
+}
+
 template<typename FERMIONFIELD, typename FERMIONMATRIX>
 void physics::algorithms::solvers::SolverShifted<FERMIONFIELD, FERMIONMATRIX>::checkFiledsSquarenormsForPossibleNaN()
 {
@@ -206,7 +232,7 @@ void physics::algorithms::solvers::SolverShifted<FERMIONFIELD, FERMIONMATRIX>::c
                 logger.fatal() << createLogPrefix() << "NAN occurred in x[" << k << "] squarenorm!";
                 throw SolverStuck(iterationNumber, __FILE__, __LINE__);
             }
-            if (std::isnan(squarenorm(*ps[k]))) {
+            if (ps[k] && std::isnan(squarenorm(*ps[k]))) {
                 logger.fatal() << createLogPrefix() << "NAN occurred in ps[" << k << "] squarenorm!";
                 throw SolverStuck(iterationNumber, __FILE__, __LINE__);
             }
@@ -257,6 +283,7 @@ void physics::algorithms::solvers::SolverShifted<FERMIONFIELD, FERMIONMATRIX>::c
             (parametersInterface.getUseMergeKernelsSpinor() && ((*single_eq_resid_host)[index] < solverPrecision))) {
             single_system_converged[index] = true;
             single_system_iter.push_back((uint)iterationNumber);
+            releaseAuxiliaryFieldsOfSingleSystem(index);
             logger.debug() << " ===> System number " << index << " converged after " << iterationNumber
                            << " iterations! resid = " << tmp2.get();
         }
@@ -393,6 +420,8 @@ void physics::algorithms::solvers::SolverShifted<FERMIONFIELD, FERMIONMATRIX>::d
 {
     if (logger.beDebug()) {
         for (int i = 0; i < reportNumber; i++) {
+            if (!setOfFields[i])
+                continue;
             std::ostringstream messageComplete(message);
             messageComplete << "[field_" << i << "]: ";
             physics::lattices::log_squarenorm(messageComplete.str(), *setOfFields[i]);
@@ -448,10 +477,14 @@ physics::algorithms::solvers::SolverShifted<FERMIONFIELD, FERMIONMATRIX>::solve(
         updateAuxiliaryFieldP();
         updateVectorQuantities();
         calculateResiduumSingleEquation(parametersInterface.getUseMergeKernelsSpinor());
+        if (parametersInterface.getUseMergeKernelsSpinor())
+            updateFieldsOfNotConvergedSystems();
         for (uint indexEquation = 0; indexEquation < numberOfEquations; indexEquation++) {
             if (hasSingleSystemConverged(indexEquation) == false) {
-                updateSingleFieldOfSolution(indexEquation);
-                updateSingleFieldOfAuxiliaryFieldPs(indexEquation);
+                if (!parametersInterface.getUseMergeKernelsSpinor()) {
+                    updateSingleFieldOfSolution(indexEquation);
+                    updateSingleFieldOfAuxiliaryFieldPs(indexEquation);
+                }
                 calculateResiduumSingleEquation(parametersInterface.getUseMergeKernelsSpinor(), indexEquation);
                 checkIfSingleEquationConverged(indexEquation);
             }
@@ -75,6 +75,8 @@ namespace physics {
                 void updateVectorQuantities();
                 void updateSingleFieldOfSolution(unsigned int);
                 void updateSingleFieldOfAuxiliaryFieldPs(unsigned int);
+                void updateFieldsOfNotConvergedSystems();
+                void releaseAuxiliaryFieldsOfSingleSystem(unsigned int);
                 void checkFiledsSquarenormsForPossibleNaN();
                 void updateQuantitiesForFollowingIteration();
                 void calculateResiduumSingleEquation(bool, unsigned int = 0);
@@ -116,7 +118,7 @@ namespace physics {
                 // Auxiliary staggered fields
                 const FERMIONFIELD r;
                 const FERMIONFIELD p;
-                std::vector<std::shared_ptr<FERMIONFIELD>> ps;
+                std::vector<std::shared_ptr<FERMIONFIELD>> ps;  // Released as soon as the single system converged
 
                 // Auxiliary scalar vectors
                 const physics::lattices::Vector<hmc_float> zeta_prev;  // This is zeta at the step iter-1
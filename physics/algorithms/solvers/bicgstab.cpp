@@ -24,6 +24,8 @@
 
 #include "bicgstab.hpp"
 
+#include "../../../hardware/tracer.hpp"
+
 /**
  * A "save" version of the bicgstab algorithm.
  * It is explicitely checked if the true residuum also fullfills the break condition.
@@ -61,6 +63,7 @@ int physics::algorithms::solvers::bicgstab(const physics::lattices::Spinorfield*
                                            physics::InterfacesHandler& interfacesHandler, hmc_float prec,
                                            const physics::AdditionalParameters& additionalParameters)
 {
+    hardware::TracePhase phase(system, "bicgstab");
     const physics::algorithms::SolversParametersInterface& parametersInterface = interfacesHandler
                                                                                      .getSolversParametersInterface();
 
@@ -388,6 +391,7 @@ int physics::algorithms::solvers::bicgstab(const physics::lattices::Spinorfield_
                                            physics::InterfacesHandler& interfacesHandler, hmc_float prec,
                                            const physics::AdditionalParameters& additionalParameters)
 {
+    hardware::TracePhase phase(system, "bicgstab");
     const physics::algorithms::SolversParametersInterface& parametersInterface = interfacesHandler
                                                                                      .getSolversParametersInterface();
 
@@ -23,6 +23,8 @@
 
 #include "cg.hpp"
 
+#include "../../../hardware/tracer.hpp"
+
 static std::string create_log_prefix_cg(int number) noexcept;
 //@todo: move to own file
 static std::string create_log_prefix_solver(std::string name, int number) noexcept;
@@ -46,6 +48,7 @@ int physics::algorithms::solvers::cg(const physics::lattices::Spinorfield* x,
                                      const hardware::System& system, physics::InterfacesHandler& interfacesHandler,
                                      hmc_float prec, const physics::AdditionalParameters& additionalParameters)
 {
+    hardware::TracePhase phase(system, "cg");
     using physics::algorithms::solvers::SolverDidNotSolve;
     using physics::algorithms::solvers::SolverStuck;
     using physics::lattices::Spinorfield;
@@ -162,6 +165,7 @@ int physics::algorithms::solvers::cg(const physics::lattices::Spinorfield_eo* x,
                                      physics::InterfacesHandler& interfacesHandler, hmc_float prec,
                                      const physics::AdditionalParameters& additionalParameters)
 {
+    hardware::TracePhase phase(system, "cg");
     if (system.get_devices().size() > 1) {
         return cg_multidev(x, f, gf, b, system, interfacesHandler, prec, additionalParameters);
     } else {
@@ -195,7 +199,8 @@ namespace {
     class Solver {
       public:
         Solver(const hardware::System& systemIn, physics::InterfacesHandler& interfacesHandler,
-               const cl_ulong mf_flopsIn, const cl_ulong mf_bwIn)
+               const cl_ulong mf_flopsIn, const cl_ulong mf_bwIn, const bool useFusedUpdatesIn,
+               const size_t numSystemsIn = 1)
             : system(systemIn)
             , resid(0.)
             , iter(0)
@@ -205,6 +210,8 @@ namespace {
             , MINIMUM_ITERATIONS(parametersInterface.getCgMinimumIterationCount())
             , mf_flops(mf_flopsIn)
             , mf_bw(mf_bwIn)
+            , useFusedUpdates(useFusedUpdatesIn)
+            , numSystems(numSystemsIn)
         {
             if (USE_ASYNC_COPY) {
                 logger.warn() << "Asynchroneous copying in the CG is currently unimplemented!";
@@ -233,6 +240,10 @@ namespace {
 
         const cl_ulong mf_flops;
         const cl_ulong mf_bw;
+        // whether the iteration uses the fused cg_update kernels instead of the single BLAS operations
+        const bool useFusedUpdates;
+        // number of systems solved together, mf_flops and mf_bw are meant for all of them
+        const size_t numSystems;
 
         void reportPerformance(int iter)
         {
@@ -246,25 +257,44 @@ namespace {
 
                 logger.trace() << "mf_flops: " << mf_flops;
 
-                cl_ulong flops_per_iter = mf_flops + 2 * get_flops<Spinorfield_eo, scalar_product>(system) +
-                                          2 * ::get_flops<hmc_complex, complexdivide>() +
-                                          2 * ::get_flops<hmc_complex, complexmult>() +
-                                          3 * get_flops<Spinorfield_eo, saxpy>(system);
-                cl_ulong flops_per_refresh = mf_flops + get_flops<Spinorfield_eo, saxpy>(system) +
-                                             get_flops<Spinorfield_eo, scalar_product>(system);
-                cl_ulong total_flops    = iter * flops_per_iter + refreshs * flops_per_refresh;
-                cl_ulong noWarmup_flops = (iter - 1) * flops_per_iter + (refreshs - 1) * flops_per_refresh;
+                // the vector operations are performed once per system
+                cl_ulong vector_flops_per_iter;
+                if (useFusedUpdates) {
+                    vector_flops_per_iter = get_flops<Spinorfield_eo, scalar_product>(system) +
+                                            get_flops<Spinorfield_eo, cg_update_x_r_AND_squarenorm>(system) +
+                                            get_flops<Spinorfield_eo, cg_update_p>(system);
+                } else {
+                    vector_flops_per_iter = 2 * get_flops<Spinorfield_eo, scalar_product>(system) +
+                                            2 * ::get_flops<hmc_complex, complexdivide>() +
+                                            2 * ::get_flops<hmc_complex, complexmult>() +
+                                            3 * get_flops<Spinorfield_eo, saxpy>(system);
+                }
+                cl_ulong vector_flops_per_refresh =
+                    get_flops<Spinorfield_eo, saxpy>(system) + get_flops<Spinorfield_eo, scalar_product>(system);
+                cl_ulong flops_per_iter    = mf_flops + numSystems * vector_flops_per_iter;
+                cl_ulong flops_per_refresh = mf_flops + numSystems * vector_flops_per_refresh;
+                cl_ulong total_flops       = iter * flops_per_iter + refreshs * flops_per_refresh;
+                cl_ulong noWarmup_flops    = (iter - 1) * flops_per_iter + (refreshs - 1) * flops_per_refresh;
 
                 // calculate bandwidth
 
                 logger.trace() << "mf_read_write_size: " << mf_bw;
 
-                cl_ulong bw_per_iter = mf_bw + 2 * get_read_write_size<Spinorfield_eo, scalar_product>(system) +
-                                       2 * ::get_read_write_size<hmc_complex, complexdivide>() +
-                                       2 * ::get_read_write_size<hmc_complex, complexmult>() +
-                                       3 * get_read_write_size<Spinorfield_eo, saxpy>(system);
-                cl_ulong bw_per_refresh = mf_flops + get_read_write_size<Spinorfield_eo, saxpy>(system) +
-                                          get_read_write_size<Spinorfield_eo, scalar_product>(system);
+                cl_ulong vector_bw_per_iter;
+                if (useFusedUpdates) {
+                    vector_bw_per_iter = get_read_write_size<Spinorfield_eo, scalar_product>(system) +
+                                         get_read_write_size<Spinorfield_eo, cg_update_x_r_AND_squarenorm>(system) +
+                                         get_read_write_size<Spinorfield_eo, cg_update_p>(system);
+                } else {
+                    vector_bw_per_iter = 2 * get_read_write_size<Spinorfield_eo, scalar_product>(system) +
+                                         2 * ::get_read_write_size<hmc_complex, complexdivide>() +
+                                         2 * ::get_read_write_size<hmc_complex, complexmult>() +
+                                         3 * get_read_write_size<Spinorfield_eo, saxpy>(system);
+                }
+                cl_ulong vector_bw_per_refresh = get_read_write_size<Spinorfield_eo, saxpy>(system) +
+                                                 get_read_write_size<Spinorfield_eo, scalar_product>(system);
+                cl_ulong bw_per_iter    = mf_bw + numSystems * vector_bw_per_iter;
+                cl_ulong bw_per_refresh = mf_bw + numSystems * vector_bw_per_refresh;
                 cl_ulong total_bw    = iter * bw_per_iter + refreshs * bw_per_refresh;
                 cl_ulong noWarmup_bw = (iter - 1) * bw_per_iter + (refreshs - 1) * bw_per_refresh;
 
@@ -282,7 +312,8 @@ namespace {
         const cl_ulong mf_flops = f.get_flops();
         const cl_ulong mf_bw    = f.get_read_write_size();
 
-        Solver solver(system, interfacesHandler, mf_flops, mf_bw);
+        Solver solver(system, interfacesHandler, mf_flops, mf_bw,
+                      interfacesHandler.getSolversParametersInterface().getUseMergeKernelsSpinor());
         using namespace physics::lattices;
 
         const Spinorfield_eo p(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
@@ -328,19 +359,22 @@ namespace {
             log_squarenorm(create_log_prefix_cg(iter) + "v: ", v);
 
             scalar_product(&rho, p, v);
-            divide(&alpha, omega, rho);
-            multiply(&tmp1, minus_one, alpha);  // alpha = (rn, rn)/(pn, Apn) --> alpha = omega/rho
-
-            saxpy(x, tmp1, p, *x);  // xn+1 = xn + alpha*p = xn - tmp1*p = xn - (-tmp1)*p
-            log_squarenorm(create_log_prefix_cg(iter) + "x: ", *x);
 
-            // rn+1 = rn - alpha*v -> rhat
             // NOTE: for beta one needs a complex number at the moment, therefore, this is done with "rho_next" instead
             // of "resid"
             if (solver.parametersInterface.getUseMergeKernelsSpinor()) {
-                physics::lattices::saxpy_AND_squarenorm(&rn, alpha, v, rn, rho_next);
+                // alpha = omega/rho, xn+1 = xn + alpha*p and rn+1 = rn - alpha*v in one pass, rho_next = (rn+1, rn+1)
+                physics::lattices::cg_update_x_r_AND_squarenorm(x, &rn, p, v, omega, rho, rho_next);
+                log_squarenorm(create_log_prefix_cg(iter) + "x: ", *x);
                 log_squarenorm(create_log_prefix_cg(iter) + "rn: ", rn);
             } else {
+                divide(&alpha, omega, rho);
+                multiply(&tmp1, minus_one, alpha);  // alpha = (rn, rn)/(pn, Apn) --> alpha = omega/rho
+
+                saxpy(x, tmp1, p, *x);  // xn+1 = xn + alpha*p = xn - tmp1*p = xn - (-tmp1)*p
+                log_squarenorm(create_log_prefix_cg(iter) + "x: ", *x);
+
+                // rn+1 = rn - alpha*v -> rhat
                 saxpy(&rn, alpha, v, rn);
                 scalar_product(&rho_next, rn, rn);
                 log_squarenorm(create_log_prefix_cg(iter) + "rn: ", rn);
@@ -387,10 +421,14 @@ namespace {
                 }
             }
 
-            divide(&beta, rho_next, omega);  // beta = (rn+1, rn+1)/(rn, rn) --> alpha = rho_next/omega
+            if (solver.parametersInterface.getUseMergeKernelsSpinor()) {
+                physics::lattices::cg_update_p(&p, rn, rho_next, omega);  // pn+1 = rn+1 + beta*pn
+            } else {
+                divide(&beta, rho_next, omega);  // beta = (rn+1, rn+1)/(rn, rn) --> alpha = rho_next/omega
 
-            multiply(&tmp2, minus_one, beta);
-            saxpy(&p, tmp2, p, rn);  // pn+1 = rn+1 + beta*pn
+                multiply(&tmp2, minus_one, beta);
+                saxpy(&p, tmp2, p, rn);  // pn+1 = rn+1 + beta*pn
+            }
             log_squarenorm(create_log_prefix_cg(iter) + "p: ", p);
         }
 
@@ -554,8 +592,153 @@ namespace {
         throw SolverDidNotSolve(iter, __FILE__, __LINE__);
     }
 
+    /**
+     * Per system state of the batched CG
+     */
+    struct CgMultiRhsState {
+        CgMultiRhsState(const hardware::System& system, physics::InterfacesHandler& interfacesHandler)
+            : p(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>())
+            , rn(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>())
+            , v(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>())
+            , alpha(system)
+            , beta(system)
+            , omega(system)
+            , rho(system)
+            , rho_next(system)
+            , tmp1(system)
+            , tmp2(system)
+        {
+        }
+        const physics::lattices::Spinorfield_eo p;
+        const physics::lattices::Spinorfield_eo rn;
+        const physics::lattices::Spinorfield_eo v;
+        const physics::lattices::Scalar<hmc_complex> alpha;
+        const physics::lattices::Scalar<hmc_complex> beta;
+        const physics::lattices::Scalar<hmc_complex> omega;
+        const physics::lattices::Scalar<hmc_complex> rho;
+        const physics::lattices::Scalar<hmc_complex> rho_next;
+        const physics::lattices::Scalar<hmc_complex> tmp1;
+        const physics::lattices::Scalar<hmc_complex> tmp2;
+    };
+
 }  // namespace
 
+int physics::algorithms::solvers::cg(const std::vector<const physics::lattices::Spinorfield_eo*>& x,
+                                     const physics::fermionmatrix::Fermionmatrix_eo& f,
+                                     const physics::lattices::Gaugefield& gf,
+                                     const std::vector<const physics::lattices::Spinorfield_eo*>& b,
+                                     const hardware::System& system, physics::InterfacesHandler& interfacesHandler,
+                                     hmc_float prec, const physics::AdditionalParameters& additionalParameters)
+{
+    hardware::TracePhase phase(system, "cg");
+    using namespace physics::lattices;
+
+    if (x.size() != b.size()) {
+        throw std::invalid_argument("Number of solutions and sources differs");
+    }
+    const size_t num_systems = x.size();
+
+    // the batched iteration does not use the fused cg_update kernels
+    Solver solver(system, interfacesHandler, f.get_flops_multi(num_systems), f.get_read_write_size_multi(num_systems),
+                  false, num_systems);
+
+    const Scalar<hmc_complex> minus_one(system);
+    minus_one.store(hmc_complex_minusone);
+    const Scalar<hmc_complex> one(system);
+    one.store(hmc_complex_one);
+
+    std::vector<std::unique_ptr<CgMultiRhsState>> states;
+    for (size_t k = 0; k < num_systems; ++k) {
+        states.emplace_back(new CgMultiRhsState(system, interfacesHandler));
+    }
+
+    // indices of the systems which did not converge yet
+    std::vector<size_t> active(num_systems);
+    for (size_t k = 0; k < num_systems; ++k) {
+        active[k] = k;
+        log_squarenorm(create_log_prefix_cg(0) + "b (initial): ", *b[k]);
+        log_squarenorm(create_log_prefix_cg(0) + "x (initial): ", *x[k]);
+    }
+
+    int iter = 0;
+    for (iter = 0; iter < solver.maximalIterations || iter < solver.MINIMUM_ITERATIONS; iter++) {
+        std::vector<const Spinorfield_eo*> active_x, active_p, active_rn, active_v;
+        for (auto k : active) {
+            active_x.push_back(x[k]);
+            active_p.push_back(&states[k]->p);
+            active_rn.push_back(&states[k]->rn);
+            active_v.push_back(&states[k]->v);
+        }
+
+        if (iter % solver.refreshIteration == 0) {
+            f.apply_multi(active_rn, gf, active_x, additionalParameters);  // rn = A*inout
+            for (auto k : active) {
+                auto& s = *states[k];
+                saxpy(&s.rn, one, s.rn, *b[k]);  // rn = source - A*inout
+                copyData(&s.p, s.rn);            // p = rn
+                scalar_product(&s.omega, s.rn, s.rn);
+            }
+        } else {
+            for (auto k : active) {
+                copyData(&states[k]->omega, states[k]->rho_next);
+            }
+        }
+        f.apply_multi(active_v, gf, active_p, additionalParameters);  // v = A pn
+
+        for (auto k : active) {
+            auto& s = *states[k];
+            scalar_product(&s.rho, s.p, s.v);
+            divide(&s.alpha, s.omega, s.rho);
+            multiply(&s.tmp1, minus_one, s.alpha);  // alpha = (rn, rn)/(pn, Apn) --> alpha = omega/rho
+            saxpy(x[k], s.tmp1, s.p, *x[k]);        // xn+1 = xn + alpha*p = xn - tmp1*p = xn - (-tmp1)*p
+            // rn+1 = rn - alpha*v -> rhat
+            if (solver.parametersInterface.getUseMergeKernelsSpinor()) {
+                physics::lattices::saxpy_AND_squarenorm(&s.rn, s.alpha, s.v, s.rn, s.rho_next);
+            } else {
+                saxpy(&s.rn, s.alpha, s.v, s.rn);
+                scalar_product(&s.rho_next, s.rn, s.rn);
+            }
+        }
+
+        if (iter % solver.RESID_CHECK_FREQUENCY == 0) {
+            std::vector<size_t> still_active;
+            for (auto k : active) {
+                solver.resid = states[k]->rho_next.get().re;
+                logger.debug() << create_log_prefix_cg(iter) << "resid of system " << k << ": " << solver.resid;
+                testIfResiduumIsNan(solver.resid, iter);
+                if (solver.resid < prec && iter >= solver.MINIMUM_ITERATIONS) {
+                    logger.debug() << create_log_prefix_cg(iter) << "System " << k << " converged in " << iter
+                                   << " iterations! resid:\t" << solver.resid;
+                    log_squarenorm(create_log_prefix_cg(iter) + "x (final): ", *x[k]);
+                } else {
+                    still_active.push_back(k);
+                }
+            }
+            active.swap(still_active);
+
+            if (active.empty()) {
+                // the reported performance assumes that all systems stayed active in every iteration
+                solver.reportPerformance(iter);
+                return iter;
+            }
+            if (iter == 0) {
+                solver.timer_noWarmup.reset();
+            }
+        }
+
+        for (auto k : active) {
+            auto& s = *states[k];
+            divide(&s.beta, s.rho_next, s.omega);  // beta = (rn+1, rn+1)/(rn, rn) --> alpha = rho_next/omega
+            multiply(&s.tmp2, minus_one, s.beta);
+            saxpy(&s.p, s.tmp2, s.p, s.rn);  // pn+1 = rn+1 + beta*pn
+        }
+    }
+
+    logger.fatal() << create_log_prefix_cg(iter) << "Solver did not solve " << active.size() << " of " << num_systems
+                   << " systems in " << solver.maximalIterations << " iterations. Last resid: " << solver.resid;
+    throw physics::algorithms::solvers::SolverDidNotSolve(iter, __FILE__, __LINE__);
+}
+
 static std::string create_log_prefix_solver(std::string name, int number) noexcept
 {
     using namespace std;
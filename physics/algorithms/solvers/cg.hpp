@@ -55,6 +55,23 @@ namespace physics {
                    const hardware::System& system, physics::InterfacesHandler& interfacesHandler, hmc_float prec,
                    const physics::AdditionalParameters& additionalParameters);
 
+            /**
+             * Solve the linear systems A * x[k] = b[k] for several even-odd preconditioned right hand sides at once
+             *
+             * Each system is solved by its own CG recursion, but all recursions are advanced together such that the
+             * matrix is applied to all search directions at once (see Fermionmatrix_eo::apply_multi). Systems which
+             * converged drop out of the batch.
+             *
+             * \return The number of iterations performed until the last system converged
+             * \exception SolverStuck if the solver gets stuck for any of the systems
+             * \exception SolverDidNotSolve if not all systems were solved within the iteration limit
+             */
+            int cg(const std::vector<const physics::lattices::Spinorfield_eo*>& x,
+                   const physics::fermionmatrix::Fermionmatrix_eo& A, const physics::lattices::Gaugefield& gf,
+                   const std::vector<const physics::lattices::Spinorfield_eo*>& b, const hardware::System& system,
+                   physics::InterfacesHandler& interfacesHandler, hmc_float prec,
+                   const physics::AdditionalParameters& additionalParameters);
+
         }  // namespace solvers
     }      // namespace algorithms
 }  // namespace physics
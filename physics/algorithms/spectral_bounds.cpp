@@ -0,0 +1,282 @@
+/** @file
+ * Implementation of the estimator of the spectral bounds of the staggered fermion matrix
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "spectral_bounds.hpp"
+
+#include "../../host_functionality/logger.hpp"
+#include "../../klepsydra/klepsydra.hpp"
+#include "../lattices/util.hpp"
+#include "../observables/gaugeObservables.hpp"
+#include "find_minmax_eigenvalue.hpp"
+#include "solvers/exceptions.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+typedef std::vector<std::vector<hmc_float>> HostMatrix;
+typedef std::vector<std::unique_ptr<const physics::lattices::Staggeredfield_eo>> LanczosBasis;
+
+static void diagonalize(HostMatrix matrix, std::vector<hmc_float>* eigenvalues, HostMatrix* eigenvectors);
+static void calculate_ritz_vector(const physics::lattices::Staggeredfield_eo* out, const LanczosBasis& basis,
+                                  const HostMatrix& coefficients, const size_t column, const size_t size);
+
+physics::algorithms::SpectralBoundsEstimator::SpectralBoundsEstimator(const hardware::System& systemIn,
+                                                                      physics::InterfacesHandler& interfacesHandlerIn)
+    : system(systemIn)
+    , interfacesHandler(interfacesHandlerIn)
+    , maxEigenvector()
+    , minEigenvector()
+    , haveBounds(false)
+    , lastMax(0.)
+    , lastMin(0.)
+    , lastPlaquette(0.)
+{
+}
+
+void physics::algorithms::SpectralBoundsEstimator::findMaxMinEigenvalue(
+    hmc_float& max, hmc_float& min, const physics::fermionmatrix::Fermionmatrix_stagg_eo& A,
+    const physics::lattices::Gaugefield& gf, hmc_float prec, const physics::AdditionalParameters& additionalParameters)
+{
+    const physics::algorithms::MinMaxEigenvalueParametersInterface&
+        parametersInterface         = interfacesHandler.getMinMaxEigenvalueParametersInterface();
+    const double plaquetteTolerance = parametersInterface.getFindMinMaxReusePlaquetteTolerance();
+
+    hmc_float plaquette = 0.;
+    if (plaquetteTolerance > 0.) {
+        plaquette = physics::observables::measurePlaquette(&gf,
+                                                           interfacesHandler.getGaugeObservablesParametersInterface());
+        if (haveBounds && std::abs(plaquette - lastPlaquette) < plaquetteTolerance) {
+            logger.debug() << "Reusing eigenvalue bounds [" << lastMin << ", " << lastMax
+                           << "], plaquette changed by " << std::abs(plaquette - lastPlaquette);
+            max = lastMax;
+            min = lastMin;
+            return;
+        }
+    }
+
+    if (parametersInterface.getFindMinMaxUseLanczos()) {
+        // This timer is to know how long this function takes
+        klepsydra::Monotonic timer;
+
+        findMaxMinEigenvalueLanczos(max, min, A, gf, prec, additionalParameters);
+        if (additionalParameters.getConservative()) {
+            min = A.getThresholdForMinimumEigenvalue(additionalParameters.getMass());
+            max *= 1.05;
+        }
+
+        const uint64_t duration = timer.getTime();
+        logger.debug() << "Find_maxmin_eig (Lanczos) completed in " << duration / 1000.f << " ms.";
+    } else {
+        find_maxmin_eigenvalue(max, min, A, gf, system, interfacesHandler, prec, additionalParameters);
+    }
+
+    haveBounds    = true;
+    lastMax       = max;
+    lastMin       = min;
+    lastPlaquette = plaquette;
+}
+
+void physics::algorithms::SpectralBoundsEstimator::findMaxMinEigenvalueLanczos(
+    hmc_float& max, hmc_float& min, const physics::fermionmatrix::Fermionmatrix_stagg_eo& A,
+    const physics::lattices::Gaugefield& gf, hmc_float prec, const physics::AdditionalParameters& additionalParameters)
+{
+    using namespace physics::lattices;
+
+    if (!(A.isHermitian()))
+        throw std::invalid_argument("Unable to deal with non-hermitian matrices in the Lanczos iteration!");
+
+    const physics::algorithms::MinMaxEigenvalueParametersInterface&
+        parametersInterface = interfacesHandler.getMinMaxEigenvalueParametersInterface();
+
+    const auto& staggeredfieldEoParametersInterface = interfacesHandler.getInterface<Staggeredfield_eo>();
+
+    // Two Ritz vectors are kept at a restart, at least two new Lanczos vectors must fit into the basis
+    const size_t basisSize = std::max<size_t>(parametersInterface.getFindMinMaxIterationBlockSize(), 4);
+    const size_t keptSize  = 2;
+
+    // One vector more than the basis size is needed for the residual direction
+    LanczosBasis basis;
+    for (size_t i = 0; i <= basisSize; i++)
+        basis.emplace_back(new Staggeredfield_eo(system, staggeredfieldEoParametersInterface));
+
+    // Start from the eigenvectors of the previous call, if any, otherwise from a random vector which has
+    // (almost surely) a non zero component along the eigenvectors we look for
+    if (maxEigenvector) {
+        saxpy(basis[0].get(), {1., 0.}, *maxEigenvector, *minEigenvector);
+    } else {
+        maxEigenvector.reset(new Staggeredfield_eo(system, staggeredfieldEoParametersInterface));
+        minEigenvector.reset(new Staggeredfield_eo(system, staggeredfieldEoParametersInterface));
+        pseudo_randomize<Staggeredfield_eo, su3vec>(basis[0].get(), 123);
+    }
+    sax(basis[0].get(), {1. / sqrt(squarenorm(*basis[0])), 0.}, *basis[0]);
+
+    // Projection of A onto the basis, tridiagonal apart from the couplings of the kept Ritz vectors
+    HostMatrix projection(basisSize, std::vector<hmc_float>(basisSize, 0.));
+    std::vector<hmc_float> ritzValues;
+    HostMatrix ritzCoefficients;
+    size_t first        = 0;
+    unsigned iterations = 0;
+    // With the conservative strategy the minimum is replaced by a threshold, as in the power method it is not searched
+    const bool minimumNeeded = !additionalParameters.getConservative();
+
+    while (true) {
+        size_t size    = basisSize;
+        hmc_float beta = 0.;
+        for (size_t j = first; j < basisSize; j++) {
+            const Staggeredfield_eo* w = basis[j + 1].get();
+            A(w, gf, *basis[j], &additionalParameters);
+            iterations++;
+            for (size_t i = 0; i < j; i++) {
+                if (projection[i][j] != 0.)
+                    saxpy(w, {-projection[i][j], 0.}, *basis[i], *w);
+            }
+            const hmc_float alpha = scalar_product(*basis[j], *w).re;
+            projection[j][j]      = alpha;
+            saxpy(w, {-alpha, 0.}, *basis[j], *w);
+            beta = sqrt(squarenorm(*w));
+            if (beta <= std::numeric_limits<hmc_float>::epsilon() * std::abs(alpha)) {
+                // The basis spans an invariant subspace, hence its Ritz values are exact eigenvalues
+                size = j + 1;
+                beta = 0.;
+                break;
+            }
+            sax(w, {1. / beta, 0.}, *w);
+            if (j + 1 < basisSize) {
+                projection[j][j + 1] = beta;
+                projection[j + 1][j] = beta;
+            }
+        }
+
+        HostMatrix activeProjection(size, std::vector<hmc_float>(size));
+        for (size_t i = 0; i < size; i++)
+            std::copy(projection[i].begin(), projection[i].begin() + size, activeProjection[i].begin());
+        diagonalize(activeProjection, &ritzValues, &ritzCoefficients);
+        const size_t iMin = std::min_element(ritzValues.begin(), ritzValues.end()) - ritzValues.begin();
+        const size_t iMax = std::max_element(ritzValues.begin(), ritzValues.end()) - ritzValues.begin();
+        // The residuum of a Ritz pair is beta times the last component of its coefficients
+        const hmc_float residMin = std::abs(beta * ritzCoefficients[size - 1][iMin]);
+        const hmc_float residMax = std::abs(beta * ritzCoefficients[size - 1][iMax]);
+
+        logger.debug() << "\tLANCZOS [" << iterations << "]: min = " << ritzValues[iMin] << " (resid = " << residMin
+                       << "), max = " << ritzValues[iMax] << " (resid = " << residMax << ")";
+
+        const bool minimumConverged = !minimumNeeded || residMin <= prec * std::abs(ritzValues[iMin]);
+        if (minimumConverged && residMax <= prec * std::abs(ritzValues[iMax])) {
+            calculate_ritz_vector(maxEigenvector.get(), basis, ritzCoefficients, iMax, size);
+            calculate_ritz_vector(minEigenvector.get(), basis, ritzCoefficients, iMin, size);
+            max = ritzValues[iMax] + residMax;
+            min = ritzValues[iMin] - residMin;
+            logger.debug() << "Lanczos iteration converged after " << iterations << " iterations.";
+            return;
+        }
+        if (iterations >= parametersInterface.getFindMinMaxMaxValue()) {
+            logger.fatal() << "Lanczos iteration failed in finding max and min eigenvalue in " << iterations
+                           << " iterations. Last resid: " << residMin << " (min), " << residMax << " (max)";
+            throw solvers::SolverDidNotSolve(iterations, __FILE__, __LINE__);
+        }
+
+        // Thick restart: the new basis is made of the two extremal Ritz vectors and the residual direction
+        calculate_ritz_vector(maxEigenvector.get(), basis, ritzCoefficients, iMax, size);
+        calculate_ritz_vector(minEigenvector.get(), basis, ritzCoefficients, iMin, size);
+        copyData(basis[0].get(), *maxEigenvector);
+        copyData(basis[1].get(), *minEigenvector);
+        basis[keptSize].swap(basis[basisSize]);
+        for (auto& row : projection)
+            std::fill(row.begin(), row.end(), 0.);
+        const size_t kept[] = {iMax, iMin};
+        for (size_t i = 0; i < keptSize; i++) {
+            projection[i][i]        = ritzValues[kept[i]];
+            projection[i][keptSize] = beta * ritzCoefficients[size - 1][kept[i]];
+            projection[keptSize][i] = projection[i][keptSize];
+        }
+        first = keptSize;
+    }
+}
+
+/**
+ * Diagonalize a small symmetric matrix with the cyclic Jacobi method, the k-th eigenvector is the k-th column.
+ */
+static void diagonalize(HostMatrix matrix, std::vector<hmc_float>* eigenvalues, HostMatrix* eigenvectors)
+{
+    const size_t n = matrix.size();
+    eigenvectors->assign(n, std::vector<hmc_float>(n, 0.));
+    for (size_t i = 0; i < n; i++)
+        (*eigenvectors)[i][i] = 1.;
+
+    for (int sweep = 0; sweep < 100; sweep++) {
+        hmc_float offDiagonal = 0.;
+        hmc_float diagonal    = 0.;
+        for (size_t p = 0; p < n; p++) {
+            diagonal += matrix[p][p] * matrix[p][p];
+            for (size_t q = p + 1; q < n; q++)
+                offDiagonal += matrix[p][q] * matrix[p][q];
+        }
+        if (offDiagonal <= std::numeric_limits<hmc_float>::epsilon() * std::numeric_limits<hmc_float>::epsilon() *
+                               diagonal)
+            break;
+
+        for (size_t p = 0; p < n; p++) {
+            for (size_t q = p + 1; q < n; q++) {
+                if (matrix[p][q] == 0.)
+                    continue;
+                // Rotation in the (p,q) plane which annihilates matrix[p][q]
+                const hmc_float theta = (matrix[q][q] - matrix[p][p]) / (2. * matrix[p][q]);
+                const hmc_float t     = (theta >= 0. ? 1. : -1.) / (std::abs(theta) + std::sqrt(theta * theta + 1.));
+                const hmc_float c     = 1. / std::sqrt(t * t + 1.);
+                const hmc_float s     = t * c;
+                for (size_t k = 0; k < n; k++) {
+                    const hmc_float kp = matrix[k][p];
+                    const hmc_float kq = matrix[k][q];
+                    matrix[k][p]       = c * kp - s * kq;
+                    matrix[k][q]       = s * kp + c * kq;
+                }
+                for (size_t k = 0; k < n; k++) {
+                    const hmc_float pk = matrix[p][k];
+                    const hmc_float qk = matrix[q][k];
+                    matrix[p][k]       = c * pk - s * qk;
+                    matrix[q][k]       = s * pk + c * qk;
+                }
+                for (size_t k = 0; k < n; k++) {
+                    const hmc_float kp    = (*eigenvectors)[k][p];
+                    const hmc_float kq    = (*eigenvectors)[k][q];
+                    (*eigenvectors)[k][p] = c * kp - s * kq;
+                    (*eigenvectors)[k][q] = s * kp + c * kq;
+                }
+            }
+        }
+    }
+
+    eigenvalues->resize(n);
+    for (size_t i = 0; i < n; i++)
+        (*eigenvalues)[i] = matrix[i][i];
+}
+
+static void calculate_ritz_vector(const physics::lattices::Staggeredfield_eo* out, const LanczosBasis& basis,
+                                  const HostMatrix& coefficients, const size_t column, const size_t size)
+{
+    using namespace physics::lattices;
+
+    sax(out, {coefficients[0][column], 0.}, *basis[0]);
+    for (size_t j = 1; j < size; j++)
+        saxpy(out, {coefficients[j][column], 0.}, *basis[j], *out);
+}
@@ -0,0 +1,87 @@
+/** @file
+ * Declaration of the estimator of the spectral bounds of the staggered fermion matrix
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PHYSICS_ALGORITHMS_SPECTRAL_BOUNDS_
+#define _PHYSICS_ALGORITHMS_SPECTRAL_BOUNDS_
+
+#include "../fermionmatrix/fermionmatrix_stagg.hpp"
+#include "../interfacesHandler.hpp"
+#include "../lattices/gaugefield.hpp"
+#include "../lattices/staggeredfield_eo.hpp"
+
+#include <memory>
+
+namespace physics {
+
+    namespace algorithms {
+
+        /**
+         * Estimator of the minimum and maximum eigenvalue of a hermitian operator along a Markov chain.
+         *
+         * The eigenvalues are found either with the power method of find_maxmin_eigenvalue or with a thick-restart
+         * Lanczos iteration, which gets both ends of the spectrum out of the same Krylov space. Every
+         * getFindMinMaxIterationBlockSize() iterations the Lanczos basis is restarted keeping only the two extremal
+         * Ritz vectors. These are also kept from one call to the next and their sum is the starting vector of the
+         * following call, since the gaugefield changes only slightly between calls.
+         *
+         * Optionally, the bounds of the previous call are reused as long as the plaquette of the gaugefield changed
+         * less than getFindMinMaxReusePlaquetteTolerance() since then.
+         */
+        class SpectralBoundsEstimator {
+          public:
+            SpectralBoundsEstimator(const hardware::System& system, physics::InterfacesHandler& interfacesHandler);
+            SpectralBoundsEstimator(const SpectralBoundsEstimator&) = delete;
+            SpectralBoundsEstimator& operator=(const SpectralBoundsEstimator&) = delete;
+
+            /**
+             * Find both the minimum and the maximum eigenvalue of the operator A, the arguments and the treatment
+             * of the conservative strategy are those of find_maxmin_eigenvalue.
+             *
+             * @note With the Lanczos iteration the Ritz values are widened by their residuum, which bounds their
+             *       distance from an eigenvalue of A, such that the returned interval is on the safe side. With the
+             *       conservative strategy only the maximum has to converge, since the minimum is replaced anyway.
+             */
+            void findMaxMinEigenvalue(hmc_float& max, hmc_float& min,
+                                      const physics::fermionmatrix::Fermionmatrix_stagg_eo& A,
+                                      const physics::lattices::Gaugefield& gf, hmc_float prec,
+                                      const physics::AdditionalParameters& additionalParameters);
+
+          private:
+            void findMaxMinEigenvalueLanczos(hmc_float& max, hmc_float& min,
+                                             const physics::fermionmatrix::Fermionmatrix_stagg_eo& A,
+                                             const physics::lattices::Gaugefield& gf, hmc_float prec,
+                                             const physics::AdditionalParameters& additionalParameters);
+
+            const hardware::System& system;
+            physics::InterfacesHandler& interfacesHandler;
+            std::unique_ptr<const physics::lattices::Staggeredfield_eo> maxEigenvector;
+            std::unique_ptr<const physics::lattices::Staggeredfield_eo> minEigenvector;
+            bool haveBounds;
+            hmc_float lastMax;
+            hmc_float lastMin;
+            hmc_float lastPlaquette;
+        };
+
+    }  // namespace algorithms
+
+}  // namespace physics
+
+#endif /* _PHYSICS_ALGORITHMS_SPECTRAL_BOUNDS_ */
@@ -0,0 +1,140 @@
+/** @file
+ * Tests of the estimator of the spectral bounds of the staggered fermion matrix
+ *
+ * Copyright (c) 2026 agent
+ *
+ * This file is part of CL2QCD.
+ *
+ * CL2QCD is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * CL2QCD is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with CL2QCD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "spectral_bounds.hpp"
+
+#include "../../host_functionality/logger.hpp"
+#include "../../interfaceImplementations/hardwareParameters.hpp"
+#include "../../interfaceImplementations/interfacesHandler.hpp"
+#include "../../interfaceImplementations/openClKernelParameters.hpp"
+#include "../lattices/staggeredfield_eo.hpp"
+
+// use the boost test framework
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE physics::algorithms::spectral_bounds
+#include <boost/test/unit_test.hpp>
+
+// Same configuration and reference values as the maxmin test of find_minmax_eigenvalue
+static void testLanczos(const int numberOfParameters, const char* parameters[], const bool reuse)
+{
+    using namespace physics::lattices;
+    using namespace physics::algorithms;
+
+    hmc_float ref_max_eig = 5.2827838704124030;
+    hmc_float ref_min_eig = 0.3485295092571166;
+
+    meta::Inputparameters params(numberOfParameters, parameters);
+    hardware::HardwareParametersImplementation hP(&params);
+    hardware::code::OpenClKernelParametersImplementation kP(params);
+    hardware::System system(hP, kP);
+    physics::InterfacesHandlerImplementation interfacesHandler{params};
+    physics::PrngParametersImplementation prngParameters{params};
+    physics::PRNG prng{system, &prngParameters};
+
+    physics::fermionmatrix::MdagM_eo matrix(system, interfacesHandler.getInterface<physics::fermionmatrix::MdagM_eo>());
+    Gaugefield gf(system, &interfacesHandler.getInterface<physics::lattices::Gaugefield>(), prng,
+                  std::string(SOURCEDIR) + "/ildg_io/conf.00200");
+
+    SpectralBoundsEstimator estimator(system, interfacesHandler);
+    hmc_float max, min;
+    estimator.findMaxMinEigenvalue(max, min, matrix, gf, 1.e-6,
+                                   interfacesHandler.getAdditionalParameters<Staggeredfield_eo>());
+
+    logger.info() << " ref_max_eig = " << std::setprecision(16) << ref_max_eig;
+    logger.info() << "     max_eig = " << std::setprecision(16) << max;
+    logger.info() << " ref_min_eig = " << std::setprecision(16) << ref_min_eig;
+    logger.info() << "     min_eig = " << std::setprecision(16) << min;
+
+    BOOST_REQUIRE_SMALL(params.get_mass() * params.get_mass(), min);
+    BOOST_CHECK_CLOSE(ref_max_eig, max, 1.e-3);
+    BOOST_CHECK_CLOSE(ref_min_eig, min, 1.e-3);
+
+    // The second call either reuses the bounds or starts from the eigenvectors found before
+    hmc_float max_again, min_again;
+    estimator.findMaxMinEigenvalue(max_again, min_again, matrix, gf, 1.e-6,
+                                   interfacesHandler.getAdditionalParameters<Staggeredfield_eo>());
+    if (reuse) {
+        BOOST_CHECK_EQUAL(max, max_again);
+        BOOST_CHECK_EQUAL(min, min_again);
+    } else {
+        BOOST_CHECK_CLOSE(ref_max_eig, max_again, 1.e-3);
+        BOOST_CHECK_CLOSE(ref_min_eig, min_again, 1.e-3);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(lanczos)
+{
+    const char* _params[] = {"foo",          "--nTime=4",   "--fermionAction=rooted_stagg", "--mass=0.567",
+                             "--nDevices=1", "--findminmaxUseLanczos=true"};
+    testLanczos(6, _params, false);
+}
+
+BOOST_AUTO_TEST_CASE(lanczos_reuse)
+{
+    const char* _params[] = {"foo",
+                             "--nTime=4",
+                             "--fermionAction=rooted_stagg",
+                             "--mass=0.567",
+                             "--nDevices=1",
+                             "--findminmaxUseLanczos=true",
+                             "--findminmaxReuseBoundsPlaquetteTolerance=1.e-8"};
+    testLanczos(7, _params, true);
+}
+
+BOOST_AUTO_TEST_CASE(lanczos_conservative)
+{
+    using namespace physics::lattices;
+    using namespace physics::algorithms;
+
+    // Only the maximum is searched, the minimum is the threshold of the operator
+    hmc_float ref_max_eig = 5.2827838704124030 * 1.05;
+
+    const char* _params[] = {"foo",
+                             "--nTime=4",
+                             "--fermionAction=rooted_stagg",
+                             "--mass=0.567",
+                             "--nDevices=1",
+                             "--findminmaxUseLanczos=true",
+                             "--conservative=true"};
+    meta::Inputparameters params(7, _params);
+    hardware::HardwareParametersImplementation hP(&params);
+    hardware::code::OpenClKernelParametersImplementation kP(params);
+    hardware::System system(hP, kP);
+    physics::InterfacesHandlerImplementation interfacesHandler{params};
+    physics::PrngParametersImplementation prngParameters{params};
+    physics::PRNG prng{system, &prngParameters};
+
+    physics::fermionmatrix::MdagM_eo matrix(system, interfacesHandler.getInterface<physics::fermionmatrix::MdagM_eo>());
+    Gaugefield gf(system, &interfacesHandler.getInterface<physics::lattices::Gaugefield>(), prng,
+                  std::string(SOURCEDIR) + "/ildg_io/conf.00200");
+
+    SpectralBoundsEstimator estimator(system, interfacesHandler);
+    hmc_float max, min;
+    estimator.findMaxMinEigenvalue(max, min, matrix, gf, 1.e-6,
+                                   interfacesHandler.getAdditionalParameters<Staggeredfield_eo>());
+
+    logger.info() << " ref_max_eig = " << std::setprecision(16) << ref_max_eig;
+    logger.info() << "     max_eig = " << std::setprecision(16) << max;
+    logger.info() << "     min_eig = " << std::setprecision(16) << min;
+
+    BOOST_CHECK_CLOSE(ref_max_eig, max, 1.e-3);
+    BOOST_CHECK_EQUAL(min, matrix.getThresholdForMinimumEigenvalue(params.get_mass()));
+}
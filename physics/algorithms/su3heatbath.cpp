@@ -27,47 +27,91 @@
 #include "../../hardware/code/heatbath.hpp"
 #include "../../hardware/device.hpp"
 
-#include <set>
-#include <vector>
 #include <cassert>
 #include <exception>
+#include <memory>
+#include <set>
+#include <vector>
+
+/**
+ * Even and odd sites have to be the same globally for the checkerboard update to be valid across devices.
+ */
+static void check_checkerboard_across_devices(const std::vector<const hardware::buffers::SU3*>& buffers)
+{
+    if (buffers.size() > 1 && buffers[0]->get_device()->getLocalLatticeExtents().tExtent % 2 != 0) {
+        throw std::logic_error("Heatbath on several devices requires an even local temporal extent");
+    }
+}
+
+/**
+ * The kernels take the list of fixed timeslices from a buffer on each device, an empty list is passed as a single
+ * timeslice that does not exist.
+ */
+static std::vector<std::unique_ptr<const hardware::buffers::Plain<int>>>
+upload_fixed_timeslices(const std::vector<const hardware::buffers::SU3*>& buffers,
+                        const std::set<int>& fixed_timeslices)
+{
+    std::vector<int> fixed_timeslices_vec(fixed_timeslices.begin(), fixed_timeslices.end());
+    if (fixed_timeslices_vec.empty())
+        fixed_timeslices_vec.push_back(-1);
+    std::vector<std::unique_ptr<const hardware::buffers::Plain<int>>> fixed_timeslices_bufs;
+    for (auto buffer : buffers) {
+        fixed_timeslices_bufs.emplace_back(
+            new hardware::buffers::Plain<int>(fixed_timeslices_vec.size(), buffer->get_device()));
+        fixed_timeslices_bufs.back()->load(fixed_timeslices_vec.data());
+    }
+    return fixed_timeslices_bufs;
+}
 
 void physics::algorithms::su3heatbath(physics::lattices::Gaugefield& gf, physics::PRNG& prng, int overrelax,
-		const std::set<int>& fixed_timeslices)
+                                      const std::set<int>& fixed_timeslices)
 {
     assert(overrelax >= 0);
-    assert(gf.get_buffers().size() == 1);
 
-    // run su3heatbath
-    auto gf_dev   = gf.get_buffers()[0];
-    auto prng_dev = prng.get_buffers()[0];
-    auto code     = gf_dev->get_device()->getHeatbathCode();
+    const auto gf_buffers   = gf.get_buffers();
+    const auto prng_buffers = prng.get_buffers();
+    assert(gf_buffers.size() == prng_buffers.size());
+    check_checkerboard_across_devices(gf_buffers);
 
-    std::vector<int> fixed_timeslices_vec(fixed_timeslices.begin(), fixed_timeslices.end());
-    if(fixed_timeslices_vec.empty())
-        fixed_timeslices_vec.push_back(-1);
-    hardware::buffers::Plain<int> fixed_timeslices_buf(fixed_timeslices_vec.size(), gf_dev->get_device());
-    fixed_timeslices_buf.load(fixed_timeslices_vec.data());
+    const auto fixed_timeslices_bufs = upload_fixed_timeslices(gf_buffers, fixed_timeslices);
 
-    code->run_heatbath(gf_dev, prng_dev, fixed_timeslices_buf);
+    // run su3heatbath, all devices update the same sublattice at a time and exchange it before the next one
+    for (int evenodd : {EVEN, ODD}) {
+        for (cl_int mu = 0; mu < NDIM; ++mu) {
+            for (size_t i = 0; i < gf_buffers.size(); ++i) {
+                auto code = gf_buffers[i]->get_device()->getHeatbathCode();
+                code->run_heatbath(gf_buffers[i], prng_buffers[i], *fixed_timeslices_bufs[i], evenodd, mu);
+            }
+            gf.update_halo();
+        }
+    }
 
     // add overrelaxation
     if (overrelax > 0) {
-	if(!fixed_timeslices.empty())
-		throw std::logic_error("Overrelaxation with fixed timeslices is not implemented");
-        physics::algorithms::overrelax(gf, prng, overrelax);
+        physics::algorithms::overrelax(gf, prng, overrelax, fixed_timeslices);
     }
 }
 
-void physics::algorithms::overrelax(physics::lattices::Gaugefield& gf, physics::PRNG& prng, int steps)
+void physics::algorithms::overrelax(physics::lattices::Gaugefield& gf, physics::PRNG& prng, int steps,
+                                    const std::set<int>& fixed_timeslices)
 {
     assert(steps > 0);
-    assert(gf.get_buffers().size() == 1);
 
-    auto gf_dev   = gf.get_buffers()[0];
-    auto prng_dev = prng.get_buffers()[0];
-    auto code     = gf_dev->get_device()->getHeatbathCode();
+    const auto gf_buffers   = gf.get_buffers();
+    const auto prng_buffers = prng.get_buffers();
+    assert(gf_buffers.size() == prng_buffers.size());
+    check_checkerboard_across_devices(gf_buffers);
+    const auto fixed_timeslices_bufs = upload_fixed_timeslices(gf_buffers, fixed_timeslices);
 
-    for (int i = 0; i < steps; ++i)
-        code->run_overrelax(gf_dev, prng_dev);
+    for (int step = 0; step < steps; ++step) {
+        for (int evenodd : {EVEN, ODD}) {
+            for (cl_int mu = 0; mu < NDIM; ++mu) {
+                for (size_t i = 0; i < gf_buffers.size(); ++i) {
+                    auto code = gf_buffers[i]->get_device()->getHeatbathCode();
+                    code->run_overrelax(gf_buffers[i], prng_buffers[i], *fixed_timeslices_bufs[i], evenodd, mu);
+                }
+                gf.update_halo();
+            }
+        }
+    }
 }
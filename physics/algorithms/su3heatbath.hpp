@@ -36,14 +36,17 @@ namespace physics {
         /**
          * Perform one heatbath step on the given gaugefield.
          *
-         * Optionally includes overrelaxation.
+         * Optionally includes overrelaxation. The gaugefield may be distributed over several devices, each of them
+         * updating its own part of the lattice with its own PRNG state.
          *
          * @param[in,out] gf The gaugefield to heatbath
          * @param[in,out] prng The PRNG to use
          * @param[in] overrelax The number of overrelaxation steps to perform. Default is none.
+         * @param[in] fixed_timeslices Global timeslices whose spatial links are not updated, neither by the heatbath
+         *                             nor by the overrelaxation. Default is none.
          */
         void su3heatbath(physics::lattices::Gaugefield& gf, physics::PRNG& prng, int overrelax = 0,
-        		const std::set<int>& fixed_timeslices = std::set<int>());
+                         const std::set<int>& fixed_timeslices = std::set<int>());
 
         /**
          * Perform one overrelaxation step on the given gaugefield.
@@ -51,8 +54,10 @@ namespace physics {
          * @param[in,out] gf The gaugefield to heatbath
          * @param[in,out] prng The PRNG to use
          * @param[in] steps The number of overrelaxation steps to perform. Default is 1.
+         * @param[in] fixed_timeslices Global timeslices whose spatial links are not updated. Default is none.
          */
-        void overrelax(physics::lattices::Gaugefield& gf, physics::PRNG& prng, int steps = 1);
+        void overrelax(physics::lattices::Gaugefield& gf, physics::PRNG& prng, int steps = 1,
+                       const std::set<int>& fixed_timeslices = std::set<int>());
 
     }  // namespace algorithms
 
@@ -23,6 +23,8 @@
 
 #include "fermionmatrix.hpp"
 
+#include <algorithm>
+
 void physics::fermionmatrix::M_wilson(const physics::lattices::Spinorfield* out,
                                       const physics::lattices::Gaugefield& gf, const physics::lattices::Spinorfield& in,
                                       hmc_float kappa)
@@ -182,6 +184,42 @@ void physics::fermionmatrix::M_tm_sitediagonal_minus(const physics::lattices::Sp
     }
 }
 
+/**
+ * Apply a hopping term kernel to all buffers, hiding the halo exchange of the input field behind the work on the inner
+ * sites if asynchronous halo updates are enabled.
+ *
+ * @param inner Callable enqueueing the kernel restricted to the inner sites of buffer i
+ * @param boundary Callable enqueueing the kernel restricted to the boundary sites of buffer i
+ * @param full Callable enqueueing the kernel on all sites of buffer i
+ */
+template<typename Inner, typename Boundary, typename Full>
+static void apply_overlapping_halo_update(const physics::lattices::Spinorfield_eo& in, const size_t num_bufs,
+                                          Inner inner, Boundary boundary, Full full)
+{
+#ifdef ASYNC_HALO_UPDATES
+    (void)full;
+    auto update = in.require_halo_async(1);
+
+    for (size_t i = 0; i < num_bufs; ++i) {
+        inner(i);
+    }
+
+    update.finalize();
+
+    for (size_t i = 0; i < num_bufs; ++i) {
+        boundary(i);
+    }
+#else
+    (void)inner;
+    (void)boundary;
+    in.require_halo(1);
+
+    for (size_t i = 0; i < num_bufs; ++i) {
+        full(i);
+    }
+#endif
+}
+
 void physics::fermionmatrix::dslash(const physics::lattices::Spinorfield_eo* out,
                                     const physics::lattices::Gaugefield& gf,
                                     const physics::lattices::Spinorfield_eo& in, int evenodd, hmc_float kappa)
@@ -195,28 +233,132 @@ void physics::fermionmatrix::dslash(const physics::lattices::Spinorfield_eo* out
         throw std::invalid_argument("Given lattices do not use the same devices");
     }
 
-#ifdef ASYNC_HALO_UPDATES
-    auto update = in.require_halo_async(1);
+    apply_overlapping_halo_update(
+        in, num_bufs,
+        [&](size_t i) {
+            auto fermion_code = out_bufs[i]->get_device()->getFermionCode();
+            fermion_code->dslash_eo_inner(in_bufs[i], out_bufs[i], gf_bufs[i], evenodd, kappa);
+        },
+        [&](size_t i) {
+            auto fermion_code = out_bufs[i]->get_device()->getFermionCode();
+            fermion_code->dslash_eo_boundary(in_bufs[i], out_bufs[i], gf_bufs[i], evenodd, kappa);
+        },
+        [&](size_t i) {
+            auto fermion_code = out_bufs[i]->get_device()->getFermionCode();
+            fermion_code->dslash_eo_device(in_bufs[i], out_bufs[i], gf_bufs[i], evenodd, kappa);
+        });
 
-    for (size_t i = 0; i < num_bufs; ++i) {
-        auto fermion_code = out_bufs[i]->get_device()->getFermionCode();
-        fermion_code->dslash_eo_inner(in_bufs[i], out_bufs[i], gf_bufs[i], evenodd, kappa);
-    }
+    out->mark_halo_dirty();
+}
 
-    update.finalize();
+void physics::fermionmatrix::dslash_AND_M_tm_inverse_sitediagonal(const physics::lattices::Spinorfield_eo* out,
+                                                                  const physics::lattices::Gaugefield& gf,
+                                                                  const physics::lattices::Spinorfield_eo& in,
+                                                                  int evenodd, hmc_float kappa, hmc_float mubar)
+{
+    auto out_bufs = out->get_buffers();
+    auto gf_bufs  = gf.get_buffers();
+    auto in_bufs  = in.get_buffers();
 
-    for (size_t i = 0; i < num_bufs; ++i) {
-        auto fermion_code = out_bufs[i]->get_device()->getFermionCode();
-        fermion_code->dslash_eo_boundary(in_bufs[i], out_bufs[i], gf_bufs[i], evenodd, kappa);
+    size_t num_bufs = out_bufs.size();
+    if (num_bufs != gf_bufs.size() || num_bufs != in_bufs.size()) {
+        throw std::invalid_argument("Given lattices do not use the same devices");
     }
-#else
-    in.require_halo(1);
 
-    for (size_t i = 0; i < num_bufs; ++i) {
-        auto fermion_code = out_bufs[i]->get_device()->getFermionCode();
-        fermion_code->dslash_eo_device(in_bufs[i], out_bufs[i], gf_bufs[i], evenodd, kappa);
+    apply_overlapping_halo_update(
+        in, num_bufs,
+        [&](size_t i) {
+            auto fermion_code = out_bufs[i]->get_device()->getFermionCode();
+            fermion_code->dslash_AND_M_tm_inverse_sitediagonal_eo_inner(in_bufs[i], out_bufs[i], gf_bufs[i], evenodd,
+                                                                        kappa, mubar);
+        },
+        [&](size_t i) {
+            auto fermion_code = out_bufs[i]->get_device()->getFermionCode();
+            fermion_code->dslash_AND_M_tm_inverse_sitediagonal_eo_boundary(in_bufs[i], out_bufs[i], gf_bufs[i],
+                                                                           evenodd, kappa, mubar);
+        },
+        [&](size_t i) {
+            auto fermion_code = out_bufs[i]->get_device()->getFermionCode();
+            fermion_code->dslash_AND_M_tm_inverse_sitediagonal_eo_device(in_bufs[i], out_bufs[i], gf_bufs[i],
+                                                                         evenodd, kappa, mubar);
+        });
+
+    out->mark_halo_dirty();
+}
+
+void physics::fermionmatrix::dslash_AND_M_tm_inverse_sitediagonal_minus(const physics::lattices::Spinorfield_eo* out,
+                                                                        const physics::lattices::Gaugefield& gf,
+                                                                        const physics::lattices::Spinorfield_eo& in,
+                                                                        int evenodd, hmc_float kappa, hmc_float mubar)
+{
+    auto out_bufs = out->get_buffers();
+    auto gf_bufs  = gf.get_buffers();
+    auto in_bufs  = in.get_buffers();
+
+    size_t num_bufs = out_bufs.size();
+    if (num_bufs != gf_bufs.size() || num_bufs != in_bufs.size()) {
+        throw std::invalid_argument("Given lattices do not use the same devices");
     }
-#endif
+
+    apply_overlapping_halo_update(
+        in, num_bufs,
+        [&](size_t i) {
+            auto fermion_code = out_bufs[i]->get_device()->getFermionCode();
+            fermion_code->dslash_AND_M_tm_inverse_sitediagonal_minus_eo_inner(in_bufs[i], out_bufs[i], gf_bufs[i],
+                                                                              evenodd, kappa, mubar);
+        },
+        [&](size_t i) {
+            auto fermion_code = out_bufs[i]->get_device()->getFermionCode();
+            fermion_code->dslash_AND_M_tm_inverse_sitediagonal_minus_eo_boundary(in_bufs[i], out_bufs[i], gf_bufs[i],
+                                                                                 evenodd, kappa, mubar);
+        },
+        [&](size_t i) {
+            auto fermion_code = out_bufs[i]->get_device()->getFermionCode();
+            fermion_code->dslash_AND_M_tm_inverse_sitediagonal_minus_eo_device(in_bufs[i], out_bufs[i], gf_bufs[i],
+                                                                               evenodd, kappa, mubar);
+        });
 
     out->mark_halo_dirty();
 }
+
+void physics::fermionmatrix::dslash_multi(const std::vector<const physics::lattices::Spinorfield_eo*>& out,
+                                          const physics::lattices::Gaugefield& gf,
+                                          const std::vector<const physics::lattices::Spinorfield_eo*>& in,
+                                          int evenodd, hmc_float kappa)
+{
+    if (out.size() != in.size()) {
+        throw std::invalid_argument("Number of input and output fields differs");
+    }
+
+    auto gf_bufs          = gf.get_buffers();
+    const size_t num_bufs = gf_bufs.size();
+    const size_t max_rhs  = hardware::code::Fermions::DSLASH_EO_MULTI_MAX_RHS;
+
+    for (auto field : in) {
+        field->require_halo(1);
+    }
+
+    // the kernel can only take a limited number of fields, therefore they are processed in chunks
+    for (size_t first = 0; first < in.size(); first += max_rhs) {
+        const size_t last = std::min(first + max_rhs, in.size());
+        for (size_t i = 0; i < num_bufs; ++i) {
+            std::vector<const hardware::buffers::Spinor*> in_bufs;
+            std::vector<const hardware::buffers::Spinor*> out_bufs;
+            for (size_t k = first; k < last; ++k) {
+                auto in_k  = in[k]->get_buffers();
+                auto out_k = out[k]->get_buffers();
+                if (num_bufs != in_k.size() || num_bufs != out_k.size()) {
+                    throw std::invalid_argument("Given lattices do not use the same devices");
+                }
+                in_bufs.push_back(in_k[i]);
+                out_bufs.push_back(out_k[i]);
+            }
+            auto fermion_code = gf_bufs[i]->get_device()->getFermionCode();
+            fermion_code->dslash_eo_multi_device(in_bufs, out_bufs, gf_bufs[i], evenodd, kappa);
+        }
+    }
+
+    for (auto field : out) {
+        field->mark_halo_dirty();
+    }
+}
@@ -361,3 +361,90 @@ BOOST_AUTO_TEST_CASE(dslash)
         BOOST_CHECK_CLOSE(squarenorm(sf1), 75.926255640020059, 0.01);
     }
 }
+
+BOOST_AUTO_TEST_CASE(dslash_multi)
+{
+    // void dslash_multi(const std::vector<const physics::lattices::Spinorfield_eo*>& out, const
+    // physics::lattices::Gaugefield& gf, const std::vector<const physics::lattices::Spinorfield_eo*>& in, int evenodd,
+    // hmc_float kappa);
+
+    using namespace physics::lattices;
+    const char* _params[] = {"foo", "--nTime=4"};
+    meta::Inputparameters params(2, _params);
+    hardware::HardwareParametersImplementation hP(&params);
+    hardware::code::OpenClKernelParametersImplementation kP(params);
+    hardware::System system(hP, kP);
+    physics::InterfacesHandlerImplementation interfacesHandler{params};
+    physics::PrngParametersImplementation prngParameters{params};
+    physics::PRNG prng{system, &prngParameters};
+
+    Gaugefield gf(system, &interfacesHandler.getInterface<physics::lattices::Gaugefield>(), prng,
+                  std::string(SOURCEDIR) + "/ildg_io/conf.00200");
+    Spinorfield src(system, interfacesHandler.getInterface<physics::lattices::Spinorfield>());
+    Spinorfield_eo ref(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
+
+    // use more fields than the kernel can handle at once to also check the splitting into chunks
+    const size_t num_fields = hardware::code::Fermions::DSLASH_EO_MULTI_MAX_RHS + 1;
+    std::vector<std::unique_ptr<const Spinorfield_eo>> fields;
+    std::vector<const Spinorfield_eo*> in, out;
+    for (size_t k = 0; k < num_fields; ++k) {
+        fields.emplace_back(
+            new Spinorfield_eo(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>()));
+        fields.emplace_back(
+            new Spinorfield_eo(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>()));
+        in.push_back(fields[2 * k].get());
+        out.push_back(fields[2 * k + 1].get());
+        pseudo_randomize<Spinorfield, spinor>(&src, 28 + k);
+        convert_to_eoprec(in[k], &ref, src);
+    }
+
+    for (int evenodd : {EVEN, ODD}) {
+        physics::fermionmatrix::dslash_multi(out, gf, in, evenodd, params.get_kappa());
+        for (size_t k = 0; k < num_fields; ++k) {
+            physics::fermionmatrix::dslash(&ref, gf, *in[k], evenodd, params.get_kappa());
+            BOOST_CHECK_EQUAL(squarenorm(*out[k]), squarenorm(ref));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(dslash_AND_M_tm_inverse_sitediagonal)
+{
+    // void dslash_AND_M_tm_inverse_sitediagonal(const physics::lattices::Spinorfield_eo* out, const
+    // physics::lattices::Gaugefield& gf, const physics::lattices::Spinorfield_eo& in, int evenodd, hmc_float kappa,
+    // hmc_float mubar);
+
+    using namespace physics::lattices;
+    const char* _params[] = {"foo", "--nTime=4", "--useKernelMergingFermionMatrix=true"};
+    meta::Inputparameters params(3, _params);
+    hardware::HardwareParametersImplementation hP(&params);
+    hardware::code::OpenClKernelParametersImplementation kP(params);
+    hardware::System system(hP, kP);
+    physics::InterfacesHandlerImplementation interfacesHandler{params};
+    physics::PrngParametersImplementation prngParameters{params};
+    physics::PRNG prng{system, &prngParameters};
+
+    Gaugefield gf(system, &interfacesHandler.getInterface<physics::lattices::Gaugefield>(), prng,
+                  std::string(SOURCEDIR) + "/ildg_io/conf.00200");
+    Spinorfield src(system, interfacesHandler.getInterface<physics::lattices::Spinorfield>());
+    Spinorfield_eo sf1(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
+    Spinorfield_eo sf2(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
+    Spinorfield_eo merged(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
+    Spinorfield_eo tmp(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
+    Spinorfield_eo ref(system, interfacesHandler.getInterface<physics::lattices::Spinorfield_eo>());
+
+    pseudo_randomize<Spinorfield, spinor>(&src, 31);
+    convert_to_eoprec(&sf1, &sf2, src);
+
+    for (int evenodd : {EVEN, ODD}) {
+        physics::fermionmatrix::dslash(&tmp, gf, sf1, evenodd, params.get_kappa());
+        physics::fermionmatrix::M_tm_inverse_sitediagonal(&ref, tmp, meta::get_mubar(params));
+        physics::fermionmatrix::dslash_AND_M_tm_inverse_sitediagonal(&merged, gf, sf1, evenodd, params.get_kappa(),
+                                                                     meta::get_mubar(params));
+        BOOST_CHECK_CLOSE(squarenorm(merged), squarenorm(ref), 1e-8);
+
+        physics::fermionmatrix::M_tm_inverse_sitediagonal_minus(&ref, tmp, meta::get_mubar(params));
+        physics::fermionmatrix::dslash_AND_M_tm_inverse_sitediagonal_minus(
+            &merged, gf, sf1, evenodd, params.get_kappa(), meta::get_mubar(params));
+        BOOST_CHECK_CLOSE(squarenorm(merged), squarenorm(ref), 1e-8);
+    }
+}
@@ -38,6 +38,135 @@ const hardware::System& physics::fermionmatrix::Fermionmatrix_basic::get_system(
     return system;
 }
 
+void physics::fermionmatrix::Fermionmatrix_eo::apply_multi(
+    const std::vector<const physics::lattices::Spinorfield_eo*>& out, const physics::lattices::Gaugefield& gf,
+    const std::vector<const physics::lattices::Spinorfield_eo*>& in,
+    const physics::AdditionalParameters& additionalParameters) const
+{
+    if (out.size() != in.size()) {
+        throw std::invalid_argument("Number of input and output fields differs");
+    }
+    for (size_t k = 0; k < in.size(); ++k) {
+        (*this)(out[k], gf, *in[k], additionalParameters);
+    }
+}
+cl_ulong physics::fermionmatrix::Fermionmatrix_eo::get_flops_multi(size_t num_fields) const
+{
+    return num_fields * get_flops();
+}
+cl_ulong physics::fermionmatrix::Fermionmatrix_eo::get_read_write_size_multi(size_t num_fields) const
+{
+    return num_fields * get_read_write_size();
+}
+
+/**
+ * Batched version of Aee (minus == false) and Aee_minus (minus == true), tmp and tmp2 must hold one field per input.
+ */
+static void aee_multi(const std::vector<const physics::lattices::Spinorfield_eo*>& out,
+                      const physics::lattices::Gaugefield& gf,
+                      const std::vector<const physics::lattices::Spinorfield_eo*>& in,
+                      const std::vector<const physics::lattices::Spinorfield_eo*>& tmp,
+                      const std::vector<const physics::lattices::Spinorfield_eo*>& tmp2, const common::action fermact,
+                      const bool minus, const physics::AdditionalParameters& additionalParameters)
+{
+    using namespace physics::fermionmatrix;
+
+    hmc_float kappa = additionalParameters.getKappa();
+
+    switch (fermact) {
+        case common::action::wilson:
+            // in this case, the diagonal matrix is just 1 and falls away.
+            dslash_multi(tmp, gf, in, ODD, kappa);
+            dslash_multi(out, gf, tmp, EVEN, kappa);
+            for (size_t k = 0; k < in.size(); ++k) {
+                saxpy(out[k], {1., 0.}, *out[k], *in[k]);
+            }
+            break;
+        case common::action::twistedmass: {
+            hmc_float mubar = additionalParameters.getMubar();
+            dslash_multi(tmp, gf, in, ODD, kappa);
+            for (size_t k = 0; k < in.size(); ++k) {
+                if (minus) {
+                    M_tm_inverse_sitediagonal_minus(tmp2[k], *tmp[k], mubar);
+                } else {
+                    M_tm_inverse_sitediagonal(tmp2[k], *tmp[k], mubar);
+                }
+            }
+            dslash_multi(out, gf, tmp2, EVEN, kappa);
+            for (size_t k = 0; k < in.size(); ++k) {
+                if (minus) {
+                    M_tm_sitediagonal_minus(tmp[k], *in[k], mubar);
+                } else {
+                    M_tm_sitediagonal(tmp[k], *in[k], mubar);
+                }
+                saxpy(out[k], {1., 0.}, *out[k], *tmp[k]);
+            }
+            break;
+        }
+        default:
+            throw Invalid_Parameters("Unkown fermion action!", "wilson or twistedmass", fermact);
+    }
+}
+
+/**
+ * Net flops of aee_multi on num_fields fields.
+ */
+static cl_ulong
+aee_multi_flops(const hardware::System& system, const common::action fermact, const bool minus, const size_t num_fields)
+{
+    auto devices      = system.get_devices();
+    auto spinor_code  = devices[0]->getSpinorCode();
+    auto fermion_code = devices[0]->getFermionCode();
+
+    cl_ulong res;
+    switch (fermact) {
+        case common::action::wilson:
+            res = 2 * fermion_code->get_flop_size("dslash_eo_multi", num_fields);
+            res += num_fields * spinor_code->get_flop_size("saxpy_eoprec");
+            break;
+        case common::action::twistedmass:
+            res = 2 * fermion_code->get_flop_size("dslash_eo_multi", num_fields);
+            res += fermion_code->get_flop_size(minus ? "M_tm_inverse_sitediagonal_minus" : "M_tm_inverse_sitediagonal",
+                                               num_fields);
+            res += fermion_code->get_flop_size(minus ? "M_tm_sitediagonal_minus" : "M_tm_sitediagonal", num_fields);
+            res += num_fields * spinor_code->get_flop_size("saxpy_eoprec");
+            break;
+        default:
+            throw Invalid_Parameters("Unkown fermion action!", "wilson or twistedmass", fermact);
+    }
+    return res;
+}
+
+/**
+ * Net read-write-size of aee_multi on num_fields fields.
+ */
+static cl_ulong aee_multi_read_write_size(const hardware::System& system, const common::action fermact,
+                                          const bool minus, const size_t num_fields)
+{
+    auto devices      = system.get_devices();
+    auto spinor_code  = devices[0]->getSpinorCode();
+    auto fermion_code = devices[0]->getFermionCode();
+
+    cl_ulong res;
+    switch (fermact) {
+        case common::action::wilson:
+            res = 2 * fermion_code->get_read_write_size("dslash_eo_multi", num_fields);
+            res += num_fields * spinor_code->get_read_write_size("saxpy_eoprec");
+            break;
+        case common::action::twistedmass:
+            res = 2 * fermion_code->get_read_write_size("dslash_eo_multi", num_fields);
+            res += fermion_code->get_read_write_size(
+                minus ? "M_tm_inverse_sitediagonal_minus" : "M_tm_inverse_sitediagonal", num_fields);
+            res += fermion_code->get_read_write_size(minus ? "M_tm_sitediagonal_minus" : "M_tm_sitediagonal",
+                                                     num_fields);
+            res += num_fields * spinor_code->get_read_write_size("saxpy_eoprec");
+            break;
+        default:
+            throw Invalid_Parameters("Unkown fermion action!", "wilson or twistedmass", fermact);
+    }
+    return res;
+}
+
 void physics::fermionmatrix::M::
 operator()(const physics::lattices::Spinorfield* out, const physics::lattices::Gaugefield& gf,
            const physics::lattices::Spinorfield& in, const physics::AdditionalParameters& additionalParameters) const
@@ -341,8 +470,7 @@ operator()(const physics::lattices::Spinorfield_eo* out, const physics::lattices
                                            // the same time
         {
             hmc_float mubar = additionalParameters.getMubar();
-            dslash(&tmp, gf, in, ODD, kappa);
-            M_tm_inverse_sitediagonal(&tmp2, tmp, mubar);
+            dslash_AND_M_tm_inverse_sitediagonal(&tmp2, gf, in, ODD, kappa, mubar);
             dslash(out, gf, tmp2, EVEN, kappa);
             M_tm_sitediagonal(&tmp, in, mubar);
             saxpy_AND_gamma5_eo(out, {1., 0.}, *out, tmp);
@@ -367,8 +495,8 @@ cl_ulong physics::fermionmatrix::Aee_AND_gamma5_eo::get_flops() const
             res += spinor_code->get_flop_size("saxpy_AND_gamma5_eo");
             break;
         case common::action::twistedmass:
-            res = 2 * fermion_code->get_flop_size("dslash_eo");
-            res += fermion_code->get_flop_size("M_tm_inverse_sitediagonal");
+            res = fermion_code->get_flop_size("dslash_AND_M_tm_inverse_sitediagonal_eo");
+            res += fermion_code->get_flop_size("dslash_eo");
             res += fermion_code->get_flop_size("M_tm_sitediagonal");
             res += spinor_code->get_flop_size("saxpy_AND_gamma5_eo");
             break;
@@ -393,8 +521,8 @@ cl_ulong physics::fermionmatrix::Aee_AND_gamma5_eo::get_read_write_size() const
             res += spinor_code->get_read_write_size("saxpy_AND_gamma5_eo");
             break;
         case common::action::twistedmass:
-            res = 2 * fermion_code->get_read_write_size("dslash_eo");
-            res += fermion_code->get_read_write_size("M_tm_inverse_sitediagonal");
+            res = fermion_code->get_read_write_size("dslash_AND_M_tm_inverse_sitediagonal_eo");
+            res += fermion_code->get_read_write_size("dslash_eo");
             res += fermion_code->get_read_write_size("M_tm_sitediagonal");
             res += spinor_code->get_read_write_size("saxpy_AND_gamma5_eo");
             break;
@@ -525,8 +653,7 @@ operator()(const physics::lattices::Spinorfield_eo* out, const physics::lattices
                                            // the same time
         {
             hmc_float mubar = additionalParameters.getMubar();
-            dslash(&tmp, gf, in, ODD, kappa);
-            M_tm_inverse_sitediagonal_minus(&tmp2, tmp, mubar);
+            dslash_AND_M_tm_inverse_sitediagonal_minus(&tmp2, gf, in, ODD, kappa, mubar);
             dslash(out, gf, tmp2, EVEN, kappa);
             M_tm_sitediagonal_minus(&tmp, in, mubar);
             saxpy_AND_gamma5_eo(out, {1., 0.}, *out, tmp);
@@ -551,8 +678,8 @@ cl_ulong physics::fermionmatrix::Aee_minus_AND_gamma5_eo::get_flops() const
             res += spinor_code->get_flop_size("saxpy_AND_gamma5_eo");
             break;
         case common::action::twistedmass:
-            res = 2 * fermion_code->get_flop_size("dslash_eo");
-            res += fermion_code->get_flop_size("M_tm_inverse_sitediagonal_minus");
+            res = fermion_code->get_flop_size("dslash_AND_M_tm_inverse_sitediagonal_minus_eo");
+            res += fermion_code->get_flop_size("dslash_eo");
             res += fermion_code->get_flop_size("M_tm_sitediagonal_minus");
             res += spinor_code->get_flop_size("saxpy_AND_gamma5_eo");
             break;
@@ -577,8 +704,8 @@ cl_ulong physics::fermionmatrix::Aee_minus_AND_gamma5_eo::get_read_write_size()
             res += spinor_code->get_read_write_size("saxpy_AND_gamma5_eo");
             break;
         case common::action::twistedmass:
-            res = 2 * fermion_code->get_read_write_size("dslash_eo");
-            res += fermion_code->get_read_write_size("M_tm_inverse_sitediagonal_minus");
+            res = fermion_code->get_read_write_size("dslash_AND_M_tm_inverse_sitediagonal_minus_eo");
+            res += fermion_code->get_read_write_size("dslash_eo");
             res += fermion_code->get_read_write_size("M_tm_sitediagonal_minus");
             res += spinor_code->get_read_write_size("saxpy_AND_gamma5_eo");
             break;
@@ -662,6 +789,38 @@ operator()(const physics::lattices::Spinorfield_eo* out, const physics::lattices
     q_minus(&tmp, gf, in, additionalParameters);
     q_plus(out, gf, tmp, additionalParameters);
 }
+void physics::fermionmatrix::QplusQminus_eo::apply_multi(
+    const std::vector<const physics::lattices::Spinorfield_eo*>& out, const physics::lattices::Gaugefield& gf,
+    const std::vector<const physics::lattices::Spinorfield_eo*>& in,
+    const physics::AdditionalParameters& additionalParameters) const
+{
+    if (out.size() != in.size()) {
+        throw std::invalid_argument("Number of input and output fields differs");
+    }
+
+    const size_t num_fields = in.size();
+    while (multi_tmp.size() < 3 * num_fields) {
+        multi_tmp.emplace_back(new physics::lattices::Spinorfield_eo(get_system(), fermionEoParametersInterface));
+    }
+    std::vector<const physics::lattices::Spinorfield_eo*> qminus_out, tmp1, tmp2;
+    for (size_t k = 0; k < num_fields; ++k) {
+        qminus_out.push_back(multi_tmp[3 * k].get());
+        tmp1.push_back(multi_tmp[3 * k + 1].get());
+        tmp2.push_back(multi_tmp[3 * k + 2].get());
+    }
+
+    const common::action fermact = fermionmatrixParametersInterface.getFermionicActionType();
+    // Qminus_eo = gamma5 Aee_minus
+    aee_multi(qminus_out, gf, in, tmp1, tmp2, fermact, true, additionalParameters);
+    for (auto field : qminus_out) {
+        field->gamma5();
+    }
+    // Qplus_eo = gamma5 Aee
+    aee_multi(out, gf, qminus_out, tmp1, tmp2, fermact, false, additionalParameters);
+    for (auto field : out) {
+        field->gamma5();
+    }
+}
 cl_ulong physics::fermionmatrix::QplusQminus_eo::get_flops() const
 {
     cl_ulong res = q_minus.get_flops() + q_plus.get_flops();
@@ -674,3 +833,27 @@ cl_ulong physics::fermionmatrix::QplusQminus_eo::get_read_write_size() const
     logger.trace() << "QplusQminus_eo read-write size: " << res;
     return res;
 }
+cl_ulong physics::fermionmatrix::QplusQminus_eo::get_flops_multi(size_t num_fields) const
+{
+    const hardware::System& system = get_system();
+    auto fermion_code              = system.get_devices()[0]->getFermionCode();
+    const common::action fermact   = fermionmatrixParametersInterface.getFermionicActionType();
+
+    cl_ulong res =
+        aee_multi_flops(system, fermact, true, num_fields) + aee_multi_flops(system, fermact, false, num_fields);
+    res += fermion_code->get_flop_size("gamma5_eo", 2 * num_fields);
+    logger.trace() << "QplusQminus_eo flops for " << num_fields << " fields: " << res;
+    return res;
+}
+cl_ulong physics::fermionmatrix::QplusQminus_eo::get_read_write_size_multi(size_t num_fields) const
+{
+    const hardware::System& system = get_system();
+    auto fermion_code              = system.get_devices()[0]->getFermionCode();
+    const common::action fermact   = fermionmatrixParametersInterface.getFermionicActionType();
+
+    cl_ulong res = aee_multi_read_write_size(system, fermact, true, num_fields) +
+                   aee_multi_read_write_size(system, fermact, false, num_fields);
+    res += fermion_code->get_read_write_size("gamma5_eo", 2 * num_fields);
+    logger.trace() << "QplusQminus_eo read-write size for " << num_fields << " fields: " << res;
+    return res;
+}
@@ -33,6 +33,9 @@
 #include "../lattices/spinorfield.hpp"
 #include "../lattices/spinorfield_eo.hpp"
 
+#include <memory>
+#include <vector>
+
 /**
  * this is the definition of the class "Fermionmatrix"
  */
@@ -59,6 +62,28 @@ namespace physics {
                                      const physics::lattices::Spinorfield_eo& in, hmc_float mubar);
         void dslash(const physics::lattices::Spinorfield_eo* out, const physics::lattices::Gaugefield& gf,
                     const physics::lattices::Spinorfield_eo& in, int evenodd, hmc_float kappa);
+        /**
+         * Apply dslash followed by M_tm_inverse_sitediagonal(_minus) using a single merged kernel.
+         *
+         * Like dslash, the halo exchange of the input field is overlapped with the work on the inner sites if
+         * asynchronous halo updates are enabled. Requires the merged fermion kernels to be enabled.
+         */
+        void dslash_AND_M_tm_inverse_sitediagonal(const physics::lattices::Spinorfield_eo* out,
+                                                  const physics::lattices::Gaugefield& gf,
+                                                  const physics::lattices::Spinorfield_eo& in, int evenodd,
+                                                  hmc_float kappa, hmc_float mubar);
+        void dslash_AND_M_tm_inverse_sitediagonal_minus(const physics::lattices::Spinorfield_eo* out,
+                                                        const physics::lattices::Gaugefield& gf,
+                                                        const physics::lattices::Spinorfield_eo& in, int evenodd,
+                                                        hmc_float kappa, hmc_float mubar);
+        /**
+         * Apply dslash to several fields at once, such that the gaugefield has to be loaded only once for up to
+         * hardware::code::Fermions::DSLASH_EO_MULTI_MAX_RHS fields.
+         */
+        void dslash_multi(const std::vector<const physics::lattices::Spinorfield_eo*>& out,
+                          const physics::lattices::Gaugefield& gf,
+                          const std::vector<const physics::lattices::Spinorfield_eo*>& in, int evenodd,
+                          hmc_float kappa);
 
         /**
          * A generic fermion matrix
@@ -127,6 +152,24 @@ namespace physics {
                                     const physics::lattices::Gaugefield& gf,
                                     const physics::lattices::Spinorfield_eo& in,
                                     const physics::AdditionalParameters& additionalParameters) const = 0;
+            /**
+             * Invoke the matrix function on several fields at once, i.e. out[k] = A in[k].
+             *
+             * The default implementation applies the matrix to one field after the other. Matrices which profit
+             * from a batched application (e.g. via dslash_multi) override it.
+             */
+            virtual void apply_multi(const std::vector<const physics::lattices::Spinorfield_eo*>& out,
+                                     const physics::lattices::Gaugefield& gf,
+                                     const std::vector<const physics::lattices::Spinorfield_eo*>& in,
+                                     const physics::AdditionalParameters& additionalParameters) const;
+            /**
+             * Get the net flops performed by apply_multi on the given number of fields.
+             */
+            virtual cl_ulong get_flops_multi(size_t num_fields) const;
+            /**
+             * Get the net read-write-size used by apply_multi on the given number of fields.
+             */
+            virtual cl_ulong get_read_write_size_multi(size_t num_fields) const;
             virtual ~Fermionmatrix_eo(){};
 
           protected:
@@ -296,17 +339,39 @@ namespace physics {
                 : Fermionmatrix_eo(true, system, fermionEoParametersInterface)
                 , q_plus(system, fermionEoParametersInterface)
                 , q_minus(system, fermionEoParametersInterface)
-                , tmp(system, fermionEoParametersInterface){};
+                , tmp(system, fermionEoParametersInterface)
+                , fermionEoParametersInterface(fermionEoParametersInterface)
+                , multi_tmp(){};
             void operator()(const physics::lattices::Spinorfield_eo* out, const physics::lattices::Gaugefield& gf,
                             const physics::lattices::Spinorfield_eo& in,
                             const physics::AdditionalParameters& additionalParameters) const override;
+            /**
+             * Batched application of Qplus_eo Qminus_eo using dslash_multi.
+             *
+             * The merged fermionic kernels are not used here, the results are the same as of operator() up to
+             * rounding.
+             */
+            void apply_multi(const std::vector<const physics::lattices::Spinorfield_eo*>& out,
+                             const physics::lattices::Gaugefield& gf,
+                             const std::vector<const physics::lattices::Spinorfield_eo*>& in,
+                             const physics::AdditionalParameters& additionalParameters) const override;
             cl_ulong get_flops() const override;
             cl_ulong get_read_write_size() const override;
+            cl_ulong get_flops_multi(size_t num_fields) const override;
+            cl_ulong get_read_write_size_multi(size_t num_fields) const override;
 
           private:
             const Qplus_eo q_plus;
             const Qminus_eo q_minus;
             physics::lattices::Spinorfield_eo tmp;
+            const FermionEoParametersInterface& fermionEoParametersInterface;
+            /**
+             * Temporary fields for apply_multi, three per field, allocated on first use.
+             *
+             * They are only released together with the matrix, which therefore should live only as long as the
+             * batched solve it is used in (see InversionParemetersInterface::getSolverMultiRhsBlockSize).
+             */
+            mutable std::vector<std::unique_ptr<const physics::lattices::Spinorfield_eo>> multi_tmp;
         };
     }  // namespace fermionmatrix
 }  // namespace physics
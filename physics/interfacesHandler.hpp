@@ -31,6 +31,10 @@
 
 namespace physics {
 
+    namespace algorithms {
+        class SolutionHistoryScope;
+    }  // namespace algorithms
+
     namespace lattices {
         class Gaugefield;
         class Gaugemomenta;
@@ -168,6 +172,12 @@ namespace physics {
 
         virtual const physics::SourcesParametersInterface& getSourcesParametersInterface() = 0;
 
+        // NOTE: The solution histories are not parameters, but the state shared by the force calculations of one HMC
+        //      trajectory. They are registered here by their owner, such that they reach the force calculations
+        //      together with the parameters and without a change of the integrator call chain.
+        virtual physics::algorithms::SolutionHistoryScope* getSolutionHistories() const noexcept = 0;
+        virtual void setSolutionHistories(physics::algorithms::SolutionHistoryScope* histories) noexcept = 0;
+
       private:
         virtual const physics::lattices::GaugefieldParametersInterface& getGaugefieldParametersInterface()       = 0;
         virtual const physics::lattices::GaugemomentaParametersInterface& getGaugemomentaParametersInterface()   = 0;
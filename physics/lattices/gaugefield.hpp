@@ -119,8 +119,11 @@ namespace physics {
             const physics::PRNG* getPrng() const;
             const hardware::System* getSystem() const;
             const GaugefieldParametersInterface* getParameters() const;
-            void copyToContractionCodeArray(double* gauge_field); //const missing due to non-const fetch_gaugefield_from_buffers
-
+            /**
+             * Copy the gaugefield from and to the array of the contraction code, which is converted on the devices
+             * and transferred without any intermediate copy on the host.
+             */
+            void copyToContractionCodeArray(double* gauge_field);
             void setToContractionCodeArray(const double* gauge_field);
             void readFromILDGSourcefile(std::string filename);
 
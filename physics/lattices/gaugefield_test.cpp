@@ -23,6 +23,10 @@
 
 #include "gaugefield.hpp"
 
+#include "../../contractioncode_io/contractioncode_io.hpp"
+#include "../../hardware/code/gaugefield.hpp"
+#include "../../hardware/device.hpp"
+
 // use the boost test framework
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE physics::lattice::Gaugefield
@@ -36,7 +40,9 @@
 #include "../observables/gaugeObservables.hpp"
 
 #include <boost/test/unit_test.hpp>
+#include <memory>
 #include <stdexcept>
+#include <vector>
 
 BOOST_AUTO_TEST_CASE(initialization)
 {
@@ -191,6 +197,54 @@ BOOST_AUTO_TEST_CASE(polyakov)
     }
 }
 
+static void checkCompressedStorage(const char* compressionOption, const size_t storedLinkElements,
+                                   const std::string configuration)
+{
+    using namespace physics::lattices;
+
+    hmc_float plaquettes[2];
+    hmc_complex polyakovloops[2];
+    for (int compressed = 0; compressed < 2; compressed++) {
+        const char* _params[] = {"foo", "--nTime=4", compressed ? compressionOption : "--useReconstruct12=false"};
+        meta::Inputparameters params(3, _params);
+        const GaugefieldParametersImplementation parametersTmp{&params};
+        hardware::HardwareParametersImplementation hP(&params);
+        hardware::code::OpenClKernelParametersImplementation kP(params);
+        hardware::System system(hP, kP);
+        physics::PrngParametersImplementation prngParameters(params);
+        physics::PRNG prng(system, &prngParameters);
+        physics::observables::GaugeObservablesParametersImplementation gaugeobservablesParameters(params);
+
+        // links are only compressed in SOA buffers
+        for (const auto device : system.get_devices()) {
+            BOOST_CHECK_EQUAL(device->getNumberOfStoredLinkElements(),
+                              (compressed && device->get_prefers_soa()) ? storedLinkElements : NC * NC);
+        }
+
+        std::unique_ptr<Gaugefield> gf;
+        if (configuration.empty()) {
+            gf.reset(new Gaugefield(system, &parametersTmp, prng, false));
+        } else {
+            gf.reset(new Gaugefield(system, &parametersTmp, prng, configuration));
+        }
+        plaquettes[compressed]    = physics::observables::measurePlaquette(gf.get(), gaugeobservablesParameters);
+        polyakovloops[compressed] = physics::observables::measurePolyakovloop(gf.get(), gaugeobservablesParameters);
+    }
+
+    BOOST_CHECK_CLOSE(plaquettes[1], plaquettes[0], 1.e-8);
+    BOOST_CHECK_SMALL(polyakovloops[1].re - polyakovloops[0].re, 1.e-10);
+    BOOST_CHECK_SMALL(polyakovloops[1].im - polyakovloops[0].im, 1.e-10);
+}
+
+BOOST_AUTO_TEST_CASE(compressed_storage)
+{
+    const std::string conf00200 = std::string(SOURCEDIR) + "/ildg_io/conf.00200";
+    checkCompressedStorage("--useReconstruct12=true", 6, "");
+    checkCompressedStorage("--useReconstruct12=true", 6, conf00200);
+    checkCompressedStorage("--useReconstruct8=true", 4, "");
+    checkCompressedStorage("--useReconstruct8=true", 4, conf00200);
+}
+
 BOOST_AUTO_TEST_CASE(halo_update)
 {
     using namespace physics::lattices;
@@ -275,3 +329,72 @@ BOOST_AUTO_TEST_CASE(halo_update)
         BOOST_CHECK_EQUAL(orig_pol, new_pol);
     }
 }
+
+BOOST_AUTO_TEST_CASE(contraction_code_array)
+{
+    using namespace physics::lattices;
+
+    const char* _params[] = {"foo", "--nTime=4", "--nDevices=1"};
+    meta::Inputparameters params(3, _params);
+    const GaugefieldParametersImplementation parametersTmp{&params};
+    hardware::HardwareParametersImplementation hP(&params);
+    hardware::code::OpenClKernelParametersImplementation kP(params);
+    hardware::System system(hP, kP);
+    physics::PrngParametersImplementation prngParameters(params);
+    physics::PRNG prng(system, &prngParameters);
+    physics::observables::GaugeObservablesParametersImplementation gaugeobservablesParameters(params);
+
+    Gaugefield gf(system, &parametersTmp, prng, std::string(SOURCEDIR) + "/ildg_io/conf.00200");
+    const size_t numberOfElements = parametersTmp.getNumberOfElements();
+
+    // the conversion on the device has to agree with the one on the host
+    std::vector<double> array(numberOfElements * 2 * NC * NC);
+    gf.copyToContractionCodeArray(array.data());
+
+    std::vector<Matrixsu3> host_gf(numberOfElements);
+    const auto buffer = gf.get_buffers().at(0);
+    buffer->get_device()->getGaugefieldCode()->exportGaugefield(host_gf.data(), buffer);
+    std::vector<double> reference(array.size());
+    contractioncode_io::writeGaugefieldToArray(reference.data(), host_gf.data(), &parametersTmp);
+    BOOST_CHECK_EQUAL_COLLECTIONS(array.begin(), array.end(), reference.begin(), reference.end());
+
+    // and the way back has to restore the gaugefield
+    Gaugefield gf2(system, &parametersTmp, prng, false);
+    gf2.setToContractionCodeArray(array.data());
+    BOOST_CHECK_EQUAL(physics::observables::measurePlaquette(&gf, gaugeobservablesParameters),
+                      physics::observables::measurePlaquette(&gf2, gaugeobservablesParameters));
+    BOOST_CHECK_EQUAL(physics::observables::measurePolyakovloop(&gf, gaugeobservablesParameters),
+                      physics::observables::measurePolyakovloop(&gf2, gaugeobservablesParameters));
+}
+
+BOOST_AUTO_TEST_CASE(smearing)
+{
+    using namespace physics::lattices;
+
+    for (const char* steps : {"--nSmearingSteps=2", "--nSmearingSteps=3"}) {
+        const char* _params[] = {"foo", "--nTime=4", "--useSmearing=true", "--smearingFactor=0.1", steps};
+        meta::Inputparameters params(5, _params);
+        const GaugefieldParametersImplementation parametersTmp{&params};
+        hardware::HardwareParametersImplementation hP(&params);
+        hardware::code::OpenClKernelParametersImplementation kP(params);
+        hardware::System system(hP, kP);
+        physics::PrngParametersImplementation prngParameters(params);
+        physics::PRNG prng(system, &prngParameters);
+        physics::observables::GaugeObservablesParametersImplementation gaugeobservablesParameters(params);
+
+        Gaugefield gf(system, &parametersTmp, prng, std::string(SOURCEDIR) + "/ildg_io/conf.00200");
+        const hmc_float unsmeared_plaq = physics::observables::measurePlaquette(&gf, gaugeobservablesParameters);
+
+        gf.smear();
+        const hmc_float smeared_plaq = physics::observables::measurePlaquette(&gf, gaugeobservablesParameters);
+        BOOST_CHECK_GT(smeared_plaq, unsmeared_plaq);
+        gf.unsmear();
+        BOOST_CHECK_EQUAL(physics::observables::measurePlaquette(&gf, gaugeobservablesParameters), unsmeared_plaq);
+
+        // the second time the buffers of the first one are reused
+        gf.smear();
+        BOOST_CHECK_EQUAL(physics::observables::measurePlaquette(&gf, gaugeobservablesParameters), smeared_plaq);
+        gf.unsmear();
+        BOOST_CHECK_EQUAL(physics::observables::measurePlaquette(&gf, gaugeobservablesParameters), unsmeared_plaq);
+    }
+}
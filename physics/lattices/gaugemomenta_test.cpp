@@ -127,6 +127,42 @@ BOOST_AUTO_TEST_CASE(gaussian)
     BOOST_REQUIRE_NE(squarenorm(gm), 0.);
 }
 
+#ifdef USE_PRNG_PHILOX
+static std::vector<ae> draw_gaussian_gaugemomenta(const std::string useSameRandomNumbers)
+{
+    using namespace physics::lattices;
+
+    std::vector<std::string> parameters{{"foo", "--nDevices=1", "--useSameRandomNumbers=" + useSameRandomNumbers}};
+    std::vector<const char*> c_parameters{};
+    for (auto& string : parameters)
+        c_parameters.push_back(string.c_str());
+
+    meta::Inputparameters params(c_parameters.size(), c_parameters.data());
+    physics::lattices::GaugemomentaParametersImplementation gaugemomentaParametersInterface{params};
+    hardware::HardwareParametersImplementation hP(&params);
+    hardware::code::OpenClKernelParametersImplementation kP(params);
+    hardware::System system(hP, kP);
+
+    Gaugemomenta gm(system, gaugemomentaParametersInterface);
+    physics::PrngParametersImplementation prngParameters(params);
+    physics::PRNG prng(system, &prngParameters);
+    gm.gaussian(prng);
+
+    auto buffer = gm.get_buffers().at(0);
+    std::vector<ae> host_mem(buffer->get_elements());
+    buffer->get_device()->getGaugemomentumCode()->exportGaugemomentumBuffer(host_mem.data(), buffer);
+    return host_mem;
+}
+
+BOOST_AUTO_TEST_CASE(gaussian_independent_of_work_items)
+{
+    // the random numbers are drawn per site, hence a single work-item has to draw the very same momenta as all of them
+    const auto parallel = draw_gaussian_gaugemomenta("false");
+    const auto serial   = draw_gaussian_gaugemomenta("true");
+    BOOST_CHECK_EQUAL_COLLECTIONS(parallel.begin(), parallel.end(), serial.begin(), serial.end());
+}
+#endif /* USE_PRNG_PHILOX */
+
 BOOST_AUTO_TEST_CASE(squarenorm)
 {
     using namespace physics::lattices;
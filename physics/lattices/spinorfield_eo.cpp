@@ -243,6 +243,69 @@ void physics::lattices::saxpy_AND_squarenorm(const Spinorfield_eo* out, const Sc
     }
 }
 
+void physics::lattices::cg_update_x_r_AND_squarenorm(const Spinorfield_eo* x, const Spinorfield_eo* r,
+                                                     const Spinorfield_eo& p, const Spinorfield_eo& v,
+                                                     const Scalar<hmc_complex>& omega, const Scalar<hmc_complex>& rho,
+                                                     const Scalar<hmc_complex>& squarenorm)
+{
+    auto x_bufs          = x->get_buffers();
+    auto r_bufs          = r->get_buffers();
+    auto p_bufs          = p.get_buffers();
+    auto v_bufs          = v.get_buffers();
+    auto omega_bufs      = omega.get_buffers();
+    auto rho_bufs        = rho.get_buffers();
+    auto squarenorm_bufs = squarenorm.get_buffers();
+
+    if (x_bufs.size() != r_bufs.size() || x_bufs.size() != p_bufs.size() || x_bufs.size() != v_bufs.size()) {
+        throw std::invalid_argument("Output buffers does not use same devices as input buffers");
+    }
+
+    for (size_t i = 0; i < x_bufs.size(); ++i) {
+        auto device = x_bufs[i]->get_device();
+        device->getSpinorCode()->cg_update_x_r_AND_squarenorm_eo_device(x_bufs[i], r_bufs[i], p_bufs[i], v_bufs[i],
+                                                                        omega_bufs[i], rho_bufs[i],
+                                                                        squarenorm_bufs[i]);
+    }
+
+    auto const valid_halo_width_x = std::min(x->get_valid_halo_width(), p.get_valid_halo_width());
+    if (valid_halo_width_x) {
+        x->mark_halo_clean(valid_halo_width_x);
+    } else {
+        x->mark_halo_dirty();
+    }
+    auto const valid_halo_width_r = std::min(r->get_valid_halo_width(), v.get_valid_halo_width());
+    if (valid_halo_width_r) {
+        r->mark_halo_clean(valid_halo_width_r);
+    } else {
+        r->mark_halo_dirty();
+    }
+}
+
+void physics::lattices::cg_update_p(const Spinorfield_eo* p, const Spinorfield_eo& r,
+                                    const Scalar<hmc_complex>& rho_next, const Scalar<hmc_complex>& omega)
+{
+    auto p_bufs        = p->get_buffers();
+    auto r_bufs        = r.get_buffers();
+    auto rho_next_bufs = rho_next.get_buffers();
+    auto omega_bufs    = omega.get_buffers();
+
+    if (p_bufs.size() != r_bufs.size()) {
+        throw std::invalid_argument("Output buffers does not use same devices as input buffers");
+    }
+
+    for (size_t i = 0; i < p_bufs.size(); ++i) {
+        auto device = p_bufs[i]->get_device();
+        device->getSpinorCode()->cg_update_p_eo_device(p_bufs[i], r_bufs[i], rho_next_bufs[i], omega_bufs[i]);
+    }
+
+    auto const valid_halo_width = std::min(p->get_valid_halo_width(), r.get_valid_halo_width());
+    if (valid_halo_width) {
+        p->mark_halo_clean(valid_halo_width);
+    } else {
+        p->mark_halo_dirty();
+    }
+}
+
 void physics::lattices::saxpy(const Spinorfield_eo* out, const Scalar<hmc_complex>& alpha, const Spinorfield_eo& x,
                               const Spinorfield_eo& y)
 {
@@ -509,6 +572,45 @@ size_t physics::lattices::get_read_write_size<physics::lattices::Spinorfield_eo,
     return spinor_code->get_read_write_size("saxsbypz_eoprec");
 }
 
+template<>
+size_t physics::lattices::get_flops<physics::lattices::Spinorfield_eo, physics::lattices::cg_update_x_r_AND_squarenorm>(
+    const hardware::System& system)
+{
+    // assert single system
+    auto devices     = system.get_devices();
+    auto spinor_code = devices[0]->getSpinorCode();
+    return spinor_code->get_flop_size("cg_update_x_r_AND_squarenorm_eo");
+}
+template<>
+size_t physics::lattices::get_read_write_size<physics::lattices::Spinorfield_eo,
+                                              physics::lattices::cg_update_x_r_AND_squarenorm>(
+    const hardware::System& system)
+{
+    // assert single system
+    auto devices     = system.get_devices();
+    auto spinor_code = devices[0]->getSpinorCode();
+    return spinor_code->get_read_write_size("cg_update_x_r_AND_squarenorm_eo");
+}
+
+template<>
+size_t physics::lattices::get_flops<physics::lattices::Spinorfield_eo, physics::lattices::cg_update_p>(
+    const hardware::System& system)
+{
+    // assert single system
+    auto devices     = system.get_devices();
+    auto spinor_code = devices[0]->getSpinorCode();
+    return spinor_code->get_flop_size("cg_update_p_eo");
+}
+template<>
+size_t physics::lattices::get_read_write_size<physics::lattices::Spinorfield_eo, physics::lattices::cg_update_p>(
+    const hardware::System& system)
+{
+    // assert single system
+    auto devices     = system.get_devices();
+    auto spinor_code = devices[0]->getSpinorCode();
+    return spinor_code->get_read_write_size("cg_update_p_eo");
+}
+
 void physics::lattices::log_squarenorm(const std::string& msg, const physics::lattices::Spinorfield_eo& x)
 {
     if (logger.beDebug()) {
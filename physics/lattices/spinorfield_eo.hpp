@@ -302,6 +302,46 @@ namespace physics {
 
         void saxpy_AND_squarenorm(const Spinorfield_eo* out, const Scalar<hmc_complex>& alpha, const Spinorfield_eo& x,
                                   const Spinorfield_eo& y, const Scalar<hmc_complex>& squarenorm);
+
+        /**
+         * The vector updates of one CG iteration, keeping the coefficient on the device.
+         *
+         * x = x + alpha*p and r = r - alpha*v with alpha = omega/rho, squarenorm = |r|^2
+         */
+        void cg_update_x_r_AND_squarenorm(const Spinorfield_eo* x, const Spinorfield_eo* r, const Spinorfield_eo& p,
+                                          const Spinorfield_eo& v, const Scalar<hmc_complex>& omega,
+                                          const Scalar<hmc_complex>& rho, const Scalar<hmc_complex>& squarenorm);
+        /**
+         * The update of the CG search direction, keeping the coefficient on the device.
+         *
+         * p = r + beta*p with beta = rho_next/omega
+         */
+        void cg_update_p(const Spinorfield_eo* p, const Spinorfield_eo& r, const Scalar<hmc_complex>& rho_next,
+                         const Scalar<hmc_complex>& omega);
+
+        template<typename S, void (*T)(const S*, const S*, const S&, const S&, const Scalar<hmc_complex>&,
+                                       const Scalar<hmc_complex>&, const Scalar<hmc_complex>&)>
+        size_t get_flops(const hardware::System&);
+        template<>
+        size_t get_flops<physics::lattices::Spinorfield_eo, physics::lattices::cg_update_x_r_AND_squarenorm>(
+            const hardware::System&);
+        template<typename S, void (*T)(const S*, const S*, const S&, const S&, const Scalar<hmc_complex>&,
+                                       const Scalar<hmc_complex>&, const Scalar<hmc_complex>&)>
+        size_t get_read_write_size(const hardware::System&);
+        template<>
+        size_t get_read_write_size<physics::lattices::Spinorfield_eo, physics::lattices::cg_update_x_r_AND_squarenorm>(
+            const hardware::System&);
+
+        template<typename S, void (*T)(const S*, const S&, const Scalar<hmc_complex>&, const Scalar<hmc_complex>&)>
+        size_t get_flops(const hardware::System&);
+        template<>
+        size_t get_flops<physics::lattices::Spinorfield_eo, physics::lattices::cg_update_p>(const hardware::System&);
+        template<typename S, void (*T)(const S*, const S&, const Scalar<hmc_complex>&, const Scalar<hmc_complex>&)>
+        size_t get_read_write_size(const hardware::System&);
+        template<>
+        size_t
+        get_read_write_size<physics::lattices::Spinorfield_eo, physics::lattices::cg_update_p>(const hardware::System&);
+
         void saxpy_AND_gamma5_eo(const Spinorfield_eo* out, const hmc_complex alpha, const Spinorfield_eo& x,
                                  const Spinorfield_eo& y);
 
@@ -27,6 +27,7 @@
 #include "../../hardware/code/spinors.hpp"  //For hardware::code::get_eoprec_spinorfieldsize()
 #include "../../hardware/code/spinors_staggered.hpp"
 
+#include <algorithm>
 #include <cassert>
 
 physics::lattices::Staggeredfield_eo::Staggeredfield_eo(
@@ -533,6 +534,43 @@ void physics::lattices::sax_vec_and_squarenorm(const Vector<hmc_float>* res, con
     // res->sum();
 }
 
+void physics::lattices::update_x_and_ps_cgm(const std::vector<const Staggeredfield_eo*>& x,
+                                            const std::vector<const Staggeredfield_eo*>& ps,
+                                            const std::vector<int>& shift_indices, const Staggeredfield_eo& r,
+                                            const Vector<hmc_float>& beta, const Vector<hmc_float>& zeta,
+                                            const Vector<hmc_float>& alpha)
+{
+    if (x.size() != ps.size() || x.size() != shift_indices.size()) {
+        throw std::invalid_argument("Number of solution fields, auxiliary fields and shifts differs");
+    }
+
+    auto r_bufs     = r.get_buffers();
+    auto beta_bufs  = beta.get_buffers();
+    auto zeta_bufs  = zeta.get_buffers();
+    auto alpha_bufs = alpha.get_buffers();
+    size_t num_bufs = r_bufs.size();
+
+    if (num_bufs != beta_bufs.size() || num_bufs != zeta_bufs.size() || num_bufs != alpha_bufs.size()) {
+        throw std::invalid_argument("The given lattices do not use the same number of devices.");
+    }
+
+    const size_t max_shifts = hardware::code::Spinors_staggered::UPDATE_X_AND_PS_CGM_MAX_SHIFTS;
+    for (size_t first = 0; first < x.size(); first += max_shifts) {
+        const size_t last = std::min(first + max_shifts, x.size());
+        const std::vector<int> chunk_indices(shift_indices.begin() + first, shift_indices.begin() + last);
+        for (size_t i = 0; i < num_bufs; ++i) {
+            std::vector<const hardware::buffers::SU3vec*> x_bufs, ps_bufs;
+            for (size_t k = first; k < last; ++k) {
+                x_bufs.push_back(x[k]->get_buffers().at(i));
+                ps_bufs.push_back(ps[k]->get_buffers().at(i));
+            }
+            auto spinor_code = r_bufs[i]->get_device()->getSpinorStaggeredCode();
+            spinor_code->update_x_and_ps_cgm_eoprec_device(x_bufs, ps_bufs, chunk_indices, r_bufs[i], beta_bufs[i],
+                                                           zeta_bufs[i], alpha_bufs[i]);
+        }
+    }
+}
+
 template<>
 size_t
 physics::lattices::get_flops<physics::lattices::Staggeredfield_eo, hmc_complex, physics::lattices::scalar_product>(
@@ -245,6 +245,18 @@ namespace physics {
         void sax_vec_and_squarenorm(const Vector<hmc_float>* res, const Vector<hmc_float>& alpha,
                                     const Staggeredfield_eo& x);
 
+        /**
+         * Perform the update of solutions and auxiliary fields of the CG-M for a set of shifted systems,
+         * using as few kernel calls as possible.
+         *
+         * x[k]  = x[k] + beta[shift_indices[k]] * ps[k]
+         * ps[k] = zeta[shift_indices[k]] * r + alpha[shift_indices[k]] * ps[k]
+         */
+        void update_x_and_ps_cgm(const std::vector<const Staggeredfield_eo*>& x,
+                                 const std::vector<const Staggeredfield_eo*>& ps, const std::vector<int>& shift_indices,
+                                 const Staggeredfield_eo& r, const Vector<hmc_float>& beta,
+                                 const Vector<hmc_float>& zeta, const Vector<hmc_float>& alpha);
+
         /**
          * A utility function to log the tracenorm.
          *
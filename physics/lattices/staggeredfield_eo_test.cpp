@@ -29,6 +29,7 @@
 // use the boost test framework
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE physics::lattice::Staggeredfield_eo
+#include "../../hardware/code/spinors_staggered.hpp"
 #include "../../host_functionality/logger.hpp"
 #include "../../interfaceImplementations/hardwareParameters.hpp"
 #include "../../interfaceImplementations/interfacesHandler.hpp"
@@ -443,6 +444,67 @@ BOOST_AUTO_TEST_CASE(sax_vec_and_squarenorm)
         BOOST_CHECK_CLOSE(result_host[i], reference[i], 1.e-8);
 }
 
+BOOST_AUTO_TEST_CASE(update_x_and_ps_cgm)
+{
+    using physics::lattices::Staggeredfield_eo;
+
+    const char* _params[] = {"foo", "--fermionAction=rooted_stagg", "--nDevices=1"};
+    meta::Inputparameters params(3, _params);
+    hardware::HardwareParametersImplementation hP(&params);
+    hardware::code::OpenClKernelParametersImplementation kP(params);
+    hardware::System system(hP, kP);
+    physics::InterfacesHandlerImplementation interfacesHandler{params};
+    physics::PrngParametersImplementation prngParameters(params);
+    physics::PRNG prng(system, &prngParameters);
+
+    // use more shifts than the kernel can handle at once to also check the splitting into chunks
+    const size_t num_shifts = hardware::code::Spinors_staggered::UPDATE_X_AND_PS_CGM_MAX_SHIFTS + 2;
+    std::vector<hmc_float> beta_host, zeta_host, alpha_host;
+    for (size_t k = 0; k < num_shifts; k++) {
+        beta_host.push_back(-0.1 * (k + 1));
+        zeta_host.push_back(1. / (k + 2));
+        alpha_host.push_back(0.3 + 0.05 * k);
+    }
+    physics::lattices::Vector<hmc_float> beta(num_shifts, system);
+    physics::lattices::Vector<hmc_float> zeta(num_shifts, system);
+    physics::lattices::Vector<hmc_float> alpha(num_shifts, system);
+    beta.store(beta_host);
+    zeta.store(zeta_host);
+    alpha.store(alpha_host);
+
+    Staggeredfield_eo r(system, interfacesHandler.getInterface<physics::lattices::Staggeredfield_eo>());
+    physics::lattices::pseudo_randomize<Staggeredfield_eo, su3vec>(&r, 123);
+
+    // skip one shift to check that the indices into the vectors of constants are respected
+    std::vector<std::unique_ptr<const Staggeredfield_eo>> fields;
+    std::vector<const Staggeredfield_eo*> x, ps, x_ref, ps_ref;
+    std::vector<int> shift_indices;
+    for (size_t k = 0; k < num_shifts; k++) {
+        if (k == 1)
+            continue;
+        for (int i = 0; i < 4; i++)
+            fields.emplace_back(
+                new Staggeredfield_eo(system, interfacesHandler.getInterface<physics::lattices::Staggeredfield_eo>()));
+        x.push_back(fields[fields.size() - 4].get());
+        ps.push_back(fields[fields.size() - 3].get());
+        x_ref.push_back(fields[fields.size() - 2].get());
+        ps_ref.push_back(fields[fields.size() - 1].get());
+        physics::lattices::pseudo_randomize<Staggeredfield_eo, su3vec>(x.back(), 200 + k);
+        physics::lattices::pseudo_randomize<Staggeredfield_eo, su3vec>(ps.back(), 300 + k);
+        physics::lattices::copyData(x_ref.back(), *x.back());
+        physics::lattices::copyData(ps_ref.back(), *ps.back());
+        shift_indices.push_back(k);
+    }
+
+    physics::lattices::update_x_and_ps_cgm(x, ps, shift_indices, r, beta, zeta, alpha);
+    for (size_t k = 0; k < shift_indices.size(); k++) {
+        physics::lattices::saxpy(x_ref[k], beta, shift_indices[k], *ps_ref[k], *x_ref[k]);
+        physics::lattices::saxpby(ps_ref[k], zeta, shift_indices[k], r, alpha, shift_indices[k], *ps_ref[k]);
+        BOOST_CHECK_EQUAL(physics::lattices::squarenorm(*x[k]), physics::lattices::squarenorm(*x_ref[k]));
+        BOOST_CHECK_EQUAL(physics::lattices::squarenorm(*ps[k]), physics::lattices::squarenorm(*ps_ref[k]));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(pseudorandomize)
 {
     using physics::lattices::Staggeredfield_eo;
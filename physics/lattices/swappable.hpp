@@ -37,6 +37,14 @@ namespace physics {
              */
             virtual void swap_in() = 0;
 
+            /**
+             * Start making the data available on the device without waiting for it.
+             *
+             * This allows to overlap the transfer with work on other fields. swap_in() must still be called before
+             * the data is used.
+             */
+            virtual void prefetch() = 0;
+
             /**
              * Ensure the data does not take up space on the device.
              *
@@ -56,6 +64,11 @@ namespace physics {
          */
         template<class C>
         void try_swap_out(C* field);
+        /**
+         * Start swapping in the given field if it is a Swapable.
+         */
+        template<class C>
+        void try_prefetch(C* field);
     }  // namespace lattices
 }  // namespace physics
 
@@ -78,5 +91,13 @@ void physics::lattices::try_swap_out(C* field)
         swappable->swap_out();
     }
 }
+template<class C>
+void physics::lattices::try_prefetch(C* field)
+{
+    auto swappable = dynamic_cast<Swappable*>(field);
+    if (swappable) {
+        swappable->prefetch();
+    }
+}
 
 #endif /* _PHYSICS_LATTICES_SWAPPABLE_ */
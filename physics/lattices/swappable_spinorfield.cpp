@@ -27,19 +27,33 @@ physics::lattices::SwappableSpinorfield::SwappableSpinorfield(
     const hardware::System& system,
     const physics::lattices::SpinorfieldParametersInterface& spinorfieldParametersInterface, const bool place_on_host)
     : Spinorfield(system, spinorfieldParametersInterface, place_on_host)
+    , swapManager(system.getSwapManager())
+    , swap()
+    , pendingLoads()
 {
     // nothing to do
 }
 
 physics::lattices::SwappableSpinorfield::~SwappableSpinorfield()
 {
-    for (auto host_mem : swap) {
-        delete[] host_mem;
+    for (auto& host_mem : swap) {
+        swapManager->release(std::move(host_mem));
     }
     swap.clear();
 }
 
 void physics::lattices::SwappableSpinorfield::swap_in()
+{
+    prefetch();
+
+    auto buffers = get_buffers();
+    for (size_t i = 0; i < pendingLoads.size(); ++i) {
+        buffers[i]->get_device()->enqueueBarrier(pendingLoads[i]);
+    }
+    pendingLoads.clear();
+}
+
+void physics::lattices::SwappableSpinorfield::prefetch()
 {
     if (get_buffers().size() != 0) {
         return;
@@ -56,9 +70,7 @@ void physics::lattices::SwappableSpinorfield::swap_in()
     }
 
     for (size_t i = 0; i < num_bufs; ++i) {
-        spinor* host_mem = swap[i];
-        buffers[i]->load(host_mem);
-        delete[] host_mem;
+        pendingLoads.push_back(swapManager->swapIn(buffers[i], std::move(swap[i])));
     }
     swap.clear();
 }
@@ -70,10 +82,10 @@ void physics::lattices::SwappableSpinorfield::swap_out()
         return;
     }
 
+    // a pending load is executed before the dump, both being on the transfer queue of the device
+    pendingLoads.clear();
     for (auto buffer : buffers) {
-        spinor* host_mem = new spinor[buffer->get_elements()];
-        buffer->dump(host_mem);
-        swap.push_back(host_mem);
+        swap.push_back(swapManager->swapOut(buffer));
     }
 
     clear_buffers();
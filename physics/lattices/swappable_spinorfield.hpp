@@ -24,6 +24,7 @@
 #ifndef _PHYSICS_LATTICES_SWAPPABLESPINORFIELD_
 #define _PHYSICS_LATTICES_SWAPPABLESPINORFIELD_
 
+#include "../../hardware/swap_manager.hpp"
 #include "../interfacesHandler.hpp"
 #include "spinorfield.hpp"
 #include "swappable.hpp"
@@ -60,6 +61,13 @@ namespace physics {
              */
             void swap_in();
 
+            /**
+             * Start copying the data to the device on the transfer queue of the swap manager.
+             *
+             * If the data is already available on the device simply fail over.
+             */
+            void prefetch();
+
             /**
              * Ensure the data does not take up space on the device.
              *
@@ -69,8 +77,12 @@ namespace physics {
             void swap_out();
 
           private:
-            // TODO list would probably be better
-            std::vector<spinor*> swap;
+            hardware::SwapManager* const swapManager;
+            std::vector<std::unique_ptr<hardware::SwapManager::HostMemory>> swap;
+            /**
+             * Transfers of a prefetch the device has not been told to wait for yet.
+             */
+            std::vector<hardware::SynchronizationEvent> pendingLoads;
         };
 
         /**
@@ -29,6 +29,7 @@
 #include "../../interfaceImplementations/hardwareParameters.hpp"
 #include "../../interfaceImplementations/interfacesHandler.hpp"
 #include "../../interfaceImplementations/openClKernelParameters.hpp"
+#include "util.hpp"
 
 #include <boost/test/unit_test.hpp>
 
@@ -68,3 +69,36 @@ BOOST_AUTO_TEST_CASE(swap)
     sf.swap_in();
     BOOST_REQUIRE_LT(0, sf.get_buffers().size());
 }
+
+BOOST_AUTO_TEST_CASE(prefetch)
+{
+    using namespace physics::lattices;
+
+    const char* _params[] = {"foo"};
+    meta::Inputparameters params(1, _params);
+    hardware::HardwareParametersImplementation hP(&params);
+    hardware::code::OpenClKernelParametersImplementation kP(params);
+    hardware::System system(hP, kP);
+    physics::InterfacesHandlerImplementation interfacesHandler{params};
+    logger.debug() << "Devices: " << system.get_devices().size();
+
+    SwappableSpinorfield sf(system, interfacesHandler.getInterface<physics::lattices::Spinorfield>());
+    SwappableSpinorfield sf2(system, interfacesHandler.getInterface<physics::lattices::Spinorfield>());
+    pseudo_randomize<Spinorfield, spinor>(&sf, 123);
+    const hmc_float norm = squarenorm(sf);
+
+    sf.swap_out();
+    sf2.swap_out();
+    BOOST_REQUIRE_EQUAL(0, sf.get_buffers().size());
+
+    sf2.swap_in();
+    sf.prefetch();
+    BOOST_REQUIRE_LT(0, sf.get_buffers().size());
+    sf.swap_in();
+    BOOST_CHECK_CLOSE(norm, squarenorm(sf), 1.e-8);
+
+    // reuses the host memory of the pool
+    sf.swap_out();
+    sf.swap_in();
+    BOOST_CHECK_CLOSE(norm, squarenorm(sf), 1.e-8);
+}
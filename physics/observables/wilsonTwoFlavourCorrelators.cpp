@@ -93,22 +93,25 @@ static void flavour_doublet_correlators(
         throw File_Exception(corr_fn);
     }
 
-    auto result_ps = physics::observables::wilson::calculate_correlator("ps", result, sources, system,
-                                                                        interfacesHandler);
-    auto result_sc = physics::observables::wilson::calculate_correlator("sc", result, sources, system,
-                                                                        interfacesHandler);
-    auto result_vx = physics::observables::wilson::calculate_correlator("vx", result, sources, system,
-                                                                        interfacesHandler);
-    auto result_vy = physics::observables::wilson::calculate_correlator("vy", result, sources, system,
-                                                                        interfacesHandler);
-    auto result_vz = physics::observables::wilson::calculate_correlator("vz", result, sources, system,
-                                                                        interfacesHandler);
-    auto result_ax = physics::observables::wilson::calculate_correlator("ax", result, sources, system,
-                                                                        interfacesHandler);
-    auto result_ay = physics::observables::wilson::calculate_correlator("ay", result, sources, system,
-                                                                        interfacesHandler);
-    auto result_az = physics::observables::wilson::calculate_correlator("az", result, sources, system,
-                                                                        interfacesHandler);
+    // all channels in a single pass over the fields if possible, otherwise one pass per channel
+    const auto all_correlators = physics::observables::wilson::calculate_all_correlators(result, interfacesHandler);
+
+    auto get_correlator = [&](const std::string& type) {
+        auto correlator = all_correlators.find(type);
+        if (correlator != all_correlators.end()) {
+            return correlator->second;
+        }
+        return physics::observables::wilson::calculate_correlator(type, result, sources, system, interfacesHandler);
+    };
+
+    auto result_ps = get_correlator("ps");
+    auto result_sc = get_correlator("sc");
+    auto result_vx = get_correlator("vx");
+    auto result_vy = get_correlator("vy");
+    auto result_vz = get_correlator("vz");
+    auto result_ax = get_correlator("ax");
+    auto result_ay = get_correlator("ay");
+    auto result_az = get_correlator("az");
 
     if (parametersInterface.printToScreen())
         parametersInterface.printInformationOfFlavourDoubletCorrelator();
@@ -286,6 +289,11 @@ static std::vector<hmc_float> calculate_correlator_componentwise(
     }
 
     for (size_t i = 0; i < corr.size(); i++) {
+        // the transfers of the next fields overlap with this correlator
+        if (i + 1 < corr.size()) {
+            try_prefetch(corr.at(i + 1));
+            try_prefetch(sources.at(i + 1));
+        }
         calculate_correlator(type, results, corr.at(i), sources.at(i), system, parametersInterface, interfacesHandler);
     }
 
@@ -387,6 +395,83 @@ physics::observables::wilson::calculate_correlator(const std::string& type,
     }
 }
 
+std::map<std::string, std::vector<hmc_float>>
+physics::observables::wilson::calculate_all_correlators(const std::vector<physics::lattices::Spinorfield*>& corr,
+                                                        physics::InterfacesHandler& interfacesHandler)
+{
+    // the order in which the kernel stores the channels
+    const std::vector<std::string> channels = {"ps", "sc", "vx", "vy", "vz", "ax", "ay", "az"};
+    const physics::observables::WilsonTwoFlavourCorrelatorsParametersInterface&
+        parametersInterface = interfacesHandler.getWilsonTwoFlavourCorrelatorsParametersInterface();
+
+    std::map<std::string, std::vector<hmc_float>> correlators;
+    // the kernel handles the fields in groups of four, as the colorwise correlators do
+    if (corr.empty() || corr.size() % 4 != 0) {
+        return correlators;
+    }
+
+    auto first_corr = corr.at(0);
+    try_swap_in(first_corr);
+    auto first_field_buffers      = first_corr->get_buffers();
+    const size_t num_buffers      = first_field_buffers.size();
+    const size_t num_corr_entries = get_num_corr_entries(parametersInterface);
+    for (auto buffer : first_field_buffers) {
+        if (!buffer->get_device()->getCorrelatorCode()->get_correlator_kernel("all")) {
+            try_swap_out(first_corr);
+            return correlators;
+        }
+    }
+
+    std::vector<const hardware::buffers::Plain<hmc_float>*> results(num_buffers);
+    for (size_t i = 0; i < num_buffers; ++i) {
+        auto device = first_field_buffers[i]->get_device();
+        results[i]  = new hardware::buffers::Plain<hmc_float>(channels.size() * num_corr_entries, device);
+        results[i]->clear();
+    }
+
+    for (size_t i = 0; i < corr.size(); i += 4) {
+        for (size_t k = i; k < i + 4; ++k) {
+            try_swap_in(corr[k]);
+        }
+        // the transfers of the next fields overlap with this group
+        for (size_t k = i + 4; k < std::min(i + 8, corr.size()); ++k) {
+            try_prefetch(corr[k]);
+        }
+
+        auto corr1_bufs = corr[i]->get_buffers();
+        auto corr2_bufs = corr[i + 1]->get_buffers();
+        auto corr3_bufs = corr[i + 2]->get_buffers();
+        auto corr4_bufs = corr[i + 3]->get_buffers();
+        if (num_buffers != corr1_bufs.size() || num_buffers != corr2_bufs.size() ||
+            num_buffers != corr3_bufs.size() || num_buffers != corr4_bufs.size()) {
+            throw std::invalid_argument("The arguments are using different devices.");
+        }
+        for (size_t j = 0; j < num_buffers; ++j) {
+            auto code = results[j]->get_device()->getCorrelatorCode();
+            code->all_correlators(results[j], corr1_bufs[j], corr2_bufs[j], corr3_bufs[j], corr4_bufs[j]);
+        }
+
+        for (size_t k = i; k < i + 4; ++k) {
+            try_swap_out(corr[k]);
+        }
+    }
+
+    std::vector<hmc_float> host_result(channels.size() * num_corr_entries, 0.);
+    for (auto result : results) {
+        std::vector<hmc_float> out(channels.size() * num_corr_entries);
+        result->dump(out.data());
+        for (size_t i = 0; i < out.size(); ++i) {
+            host_result[i] += out[i];
+        }
+        delete result;
+    }
+    for (size_t c = 0; c < channels.size(); ++c) {
+        correlators[channels[c]] = std::vector<hmc_float>(host_result.begin() + c * num_corr_entries,
+                                                          host_result.begin() + (c + 1) * num_corr_entries);
+    }
+    return correlators;
+}
+
 void physics::observables::wilson::measureTwoFlavourDoubletCorrelatorsOnGaugefieldAndWriteToFile(
     const physics::lattices::Gaugefield* gaugefield, std::string currentConfigurationName,
     physics::InterfacesHandler& interfacesHandler)
@@ -29,6 +29,8 @@
 #include "../lattices/spinorfield.hpp"
 #include "observablesInterfaces.hpp"
 
+#include <map>
+
 namespace physics {
     namespace observables {
         namespace wilson {
@@ -37,6 +39,16 @@ namespace physics {
             calculate_correlator(const std::string& type, const std::vector<physics::lattices::Spinorfield*>& corr,
                                  const std::vector<physics::lattices::Spinorfield*>& sources,
                                  const hardware::System& system, physics::InterfacesHandler& interfacesHandler);
+            /**
+             * Calculate the correlators of all channels (ps, sc, vx, vy, vz, ax, ay, az) in a single pass over the
+             * fields.
+             *
+             * The map is empty if the device code offers no such kernel, which is the case for point sources and
+             * correlators in z-direction, or if the number of fields is not a multiple of four.
+             */
+            std::map<std::string, std::vector<hmc_float>>
+            calculate_all_correlators(const std::vector<physics::lattices::Spinorfield*>& corr,
+                                      physics::InterfacesHandler& interfacesHandler);
             void measureTwoFlavourDoubletCorrelatorsOnGaugefieldAndWriteToFile(
                 const physics::lattices::Gaugefield* gaugefield, std::string currentConfigurationName,
                 physics::InterfacesHandler& interfacesHandler);
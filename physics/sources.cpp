@@ -29,6 +29,7 @@
 #include "../hardware/code/correlator.hpp"
 #include "../hardware/code/correlator_staggered.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <stdexcept>
 
@@ -76,6 +77,33 @@ void physics::set_volume_source(const physics::lattices::Spinorfield* spinorfiel
     spinorfield->update_halo();
 }
 
+void physics::set_volume_sources(const std::vector<const physics::lattices::Spinorfield*>& spinorfields,
+                                 const PRNG& prng)
+{
+    const size_t sourcesPerLaunch = 4;
+    const size_t numberOfBatched  = spinorfields.size() - spinorfields.size() % sourcesPerLaunch;
+
+    for (size_t k = 0; k < numberOfBatched; k += sourcesPerLaunch) {
+        for (size_t j = k; j < k + sourcesPerLaunch; ++j) {
+            spinorfields[j]->zero();
+        }
+        for (size_t i = 0; i < spinorfields[k]->get_buffers().size(); ++i) {
+            auto prng_buffer = prng.get_buffers().at(i);
+            auto buffer      = spinorfields[k]->get_buffers()[i];
+
+            buffer->get_device()->getCorrelatorCode()->create_volume_sources_device(
+                buffer, spinorfields[k + 1]->get_buffers()[i], spinorfields[k + 2]->get_buffers()[i],
+                spinorfields[k + 3]->get_buffers()[i], prng_buffer);
+        }
+        for (size_t j = k; j < k + sourcesPerLaunch; ++j) {
+            spinorfields[j]->update_halo();
+        }
+    }
+    for (size_t k = numberOfBatched; k < spinorfields.size(); ++k) {
+        set_volume_source(spinorfields[k], prng);
+    }
+}
+
 void physics::set_timeslice_source(const physics::lattices::Spinorfield* spinorfield, const PRNG& prng, int t_pos)
 {
     spinorfield->zero();
@@ -130,9 +158,35 @@ static void fill_sources(const std::vector<physics::lattices::Spinorfield*>& sou
 {
     using namespace physics;
 
+    if (params.getSourceType() == common::sourcetypes::volume) {
+        // the sources are swapped in and filled in batches, such that one kernel launch fills several of them
+        const size_t batchSize = 4;
+        for (size_t k = 0; k < sources.size(); k += batchSize) {
+            const size_t end = std::min(k + batchSize, sources.size());
+            const std::vector<const lattices::Spinorfield*> batch(sources.begin() + k, sources.begin() + end);
+            for (size_t j = k; j < end; ++j) {
+                try_swap_in(sources[j]);
+            }
+            for (size_t j = end; j < std::min(end + batchSize, sources.size()); ++j) {
+                try_prefetch(sources[j]);
+            }
+
+            logger.debug() << "start creating " << batch.size() << " volume-sources...";
+            set_volume_sources(batch, prng);
+
+            for (size_t j = k; j < end; ++j) {
+                try_swap_out(sources[j]);
+            }
+        }
+        return;
+    }
+
     for (size_t k = 0; k < sources.size(); k++) {
         auto source = sources[k];
         try_swap_in(source);
+        if (k + 1 < sources.size()) {
+            try_prefetch(sources[k + 1]);
+        }
 
         switch (params.getSourceType()) {
             case common::point:
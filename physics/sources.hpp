@@ -57,6 +57,12 @@ namespace physics {
     void
     set_point_source(const physics::lattices::Spinorfield*, int k, const physics::SourcesParametersInterface& params);
     void set_volume_source(const physics::lattices::Spinorfield*, const PRNG& prng);
+    /**
+     * Fill volume sources in batches of four per kernel launch, giving the same sources as subsequent calls of
+     * set_volume_source. Each source continues the PRNG stream where the previous one stopped, there are no
+     * independent per-source stream offsets.
+     */
+    void set_volume_sources(const std::vector<const physics::lattices::Spinorfield*>& spinorfields, const PRNG& prng);
     void set_timeslice_source(const physics::lattices::Spinorfield*, const PRNG& prng, int t);
     void set_zslice_source(const physics::lattices::Spinorfield*, const PRNG& prng, int z);
     // Staggered sources
@@ -85,6 +85,43 @@ static void test_staggered_sources(const std::string type, int num_sources)
     release_staggeredfields_eo(staggered_sources);
 }
 
+static void test_batched_volume_sources(const std::string content, const int num_sources)
+{
+    using namespace physics::lattices;
+
+    std::vector<std::string> parameters{{"foo", "--sourceType=volume", "--sourceContent=" + content}};
+    std::vector<const char*> c_parameters{};
+    for (auto& string : parameters)
+        c_parameters.push_back(string.c_str());
+
+    meta::Inputparameters params(c_parameters.size(), c_parameters.data());
+    hardware::HardwareParametersImplementation hP(&params);
+    hardware::code::OpenClKernelParametersImplementation kP(params);
+    hardware::System system(hP, kP);
+    physics::InterfacesHandlerImplementation interfacesHandler{params};
+    physics::PrngParametersImplementation prngParameters{params};
+    physics::PRNG prngBatched{system, &prngParameters};
+    physics::PRNG prngSequential{system, &prngParameters};
+
+    auto batched    = create_spinorfields(system, num_sources, interfacesHandler);
+    auto sequential = create_spinorfields(system, num_sources, interfacesHandler);
+
+    set_volume_sources(std::vector<const Spinorfield*>(batched.begin(), batched.end()), prngBatched);
+    for (auto source : sequential)
+        set_volume_source(source, prngSequential);
+
+    // the batched sources must be the very same as the ones created one after the other
+    Spinorfield difference(system, interfacesHandler.getInterface<Spinorfield>());
+    for (int i = 0; i < num_sources; ++i) {
+        BOOST_REQUIRE_NE(squarenorm(*sequential[i]), 0.);
+        saxpy(&difference, {-1., 0.}, *sequential[i], *batched[i]);
+        BOOST_CHECK_EQUAL(squarenorm(difference), 0.);
+    }
+
+    release_spinorfields(batched);
+    release_spinorfields(sequential);
+}
+
 static void test_volume_source_stagg(std::string content)
 {
     using namespace physics::lattices;
@@ -137,6 +174,12 @@ BOOST_AUTO_TEST_CASE(sources)
     test_sources("zslice", 1);
 }
 
+BOOST_AUTO_TEST_CASE(batched_volume_sources)
+{
+    test_batched_volume_sources("z4", 4);
+    test_batched_volume_sources("gaussian", 6);
+}
+
 BOOST_AUTO_TEST_CASE(sources_staggered)
 {
     test_staggered_sources("point", 15);